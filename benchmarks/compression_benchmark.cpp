@@ -0,0 +1,117 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "tixi.h"
+#include "tixiInternal.h"
+#include "compression.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static const char* compressionFilenames[] = {"compression.xml", "compression.xml.gz", "compression.xml.zst"};
+
+// A document of about 10 MB with many small elements, like point lists of a CPACS file
+static TixiDocumentHandle createLargeDocument()
+{
+  std::string text = "<points>\n";
+  char point[256];
+  for (int i = 0; i < 100000; ++i) {
+    snprintf(point, sizeof(point), "  <point>\n    <x>%.12g</x>\n    <y>%.12g</y>\n    <z>%.12g</z>\n  </point>\n",
+             i * 0.001, i * 0.002, i * 0.003);
+    text += point;
+  }
+  text += "</points>\n";
+
+  TixiDocumentHandle handle = -1;
+  tixiImportFromString(text.c_str(), &handle);
+  return handle;
+}
+
+static long fileSize(const char* filename)
+{
+  FILE* file = fopen(filename, "rb");
+  long size = 0;
+  if (file) {
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fclose(file);
+  }
+  return size;
+}
+
+// Saving with the given number of compression threads, 0 for one per processor
+static void Compression_Save(benchmark::State& state)
+{
+  const char* filename = compressionFilenames[state.range(0)];
+  if (!compressionSupported(compressionFormat(filename))) {
+    state.SkipWithError("Compression format not supported");
+    return;
+  }
+
+  TixiDocumentHandle handle = createLargeDocument();
+  xmlDocPtr doc = getDocument(handle)->docPtr;
+  char* text = NULL;
+  tixiExportDocumentAsString(handle, &text);
+  const size_t documentSize = strlen(text);
+
+  for (auto _ : state) {
+    compressionSaveDocument(filename, doc, 1, (int) state.range(1));
+  }
+  state.SetBytesProcessed(state.iterations() * documentSize);
+  state.counters["ratio"] = (double) documentSize / (double) fileSize(filename);
+
+  tixiCloseDocument(handle);
+  remove(filename);
+}
+BENCHMARK(Compression_Save)
+    ->ArgNames({"format", "threads"})
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Args({1, 0})
+    ->Args({2, 1})
+    ->Args({2, 0})
+    ->UseRealTime();
+
+static void Compression_Open(benchmark::State& state)
+{
+  const char* filename = compressionFilenames[state.range(0)];
+  if (!compressionSupported(compressionFormat(filename))) {
+    state.SkipWithError("Compression format not supported");
+    return;
+  }
+
+  TixiDocumentHandle handle = createLargeDocument();
+  char* text = NULL;
+  tixiExportDocumentAsString(handle, &text);
+  const size_t documentSize = strlen(text);
+  tixiSaveDocument(handle, filename);
+  tixiCloseDocument(handle);
+
+  for (auto _ : state) {
+    TixiDocumentHandle opened = -1;
+    tixiOpenDocument(filename, &opened);
+    tixiCloseDocument(opened);
+  }
+  state.SetBytesProcessed(state.iterations() * documentSize);
+
+  remove(filename);
+}
+BENCHMARK(Compression_Open)->ArgName("format")->DenseRange(0, 2)->UseRealTime();
@@ -0,0 +1,309 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "tixi.h"
+#include "tixiInternal.h"
+#include "vectorCache.h"
+#include "cpacs_generator.h"
+
+#include <string>
+#include <vector>
+
+// Benchmarks of the frequently used functions on synthetic CPACS documents.
+// The document size is given by the number of wings and sections per wing.
+
+static CpacsOptions wingOptions(const benchmark::State& state)
+{
+  CpacsOptions options;
+  options.wings = (int) state.range(0);
+  options.sectionsPerWing = (int) state.range(1);
+  return options;
+}
+
+static void wingArguments(benchmark::internal::Benchmark* benchmark)
+{
+  benchmark->ArgNames({"wings", "sections"});
+  benchmark->Args({1, 10})->Args({4, 20})->Args({16, 40});
+}
+
+static std::string writeDocument(const CpacsOptions& options, const char* prefix)
+{
+  std::string filename = std::string(prefix) + "_" + std::to_string(options.wings) + "_" +
+                         std::to_string(options.sectionsPerWing) + "_" + std::to_string(options.externalAirfoils) + ".xml";
+  writeCpacsDocument(createCpacsDocument(options), filename);
+  return filename;
+}
+
+static TixiDocumentHandle importDocument(benchmark::State& state, const CpacsOptions& options)
+{
+  TixiDocumentHandle handle = -1;
+  if (tixiImportFromString(createCpacsDocument(options).xml.c_str(), &handle) != SUCCESS) {
+    state.SkipWithError("Cannot import document");
+  }
+  return handle;
+}
+
+static void CPACS_Open(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  std::string filename = writeDocument(options, "cpacs");
+
+  for (auto _ : state) {
+    TixiDocumentHandle handle = -1;
+    if (tixiOpenDocument(filename.c_str(), &handle) != SUCCESS) {
+      state.SkipWithError("Cannot open document");
+      break;
+    }
+    tixiCloseDocument(handle);
+  }
+}
+BENCHMARK(CPACS_Open)->Apply(wingArguments);
+
+static void CPACS_OpenRecursive(benchmark::State& state)
+{
+  CpacsOptions options;
+  options.airfoils = 16;
+  options.externalAirfoils = (int) state.range(0);
+  std::string filename = writeDocument(options, "cpacs_external");
+
+  for (auto _ : state) {
+    TixiDocumentHandle handle = -1;
+    if (tixiOpenDocumentRecursive(filename.c_str(), &handle, OPENMODE_RECURSIVE) != SUCCESS) {
+      state.SkipWithError("Cannot open document");
+      break;
+    }
+    tixiCloseDocument(handle);
+  }
+}
+BENCHMARK(CPACS_OpenRecursive)->ArgName("includes")->Arg(0)->Arg(4)->Arg(16);
+
+static void CPACS_ImportFromString(benchmark::State& state)
+{
+  std::string xml = createCpacsDocument(wingOptions(state)).xml;
+
+  for (auto _ : state) {
+    TixiDocumentHandle handle = -1;
+    tixiImportFromString(xml.c_str(), &handle);
+    tixiCloseDocument(handle);
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t) xml.size());
+}
+BENCHMARK(CPACS_ImportFromString)->Apply(wingArguments);
+
+static void CPACS_Save(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::string filename = "cpacs_save_" + std::to_string(options.wings) + "_" + std::to_string(options.sectionsPerWing) + ".xml";
+
+  for (auto _ : state) {
+    tixiSaveDocument(handle, filename.c_str());
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_Save)->Apply(wingArguments);
+
+static void CPACS_ExportAsString(benchmark::State& state)
+{
+  TixiDocumentHandle handle = importDocument(state, wingOptions(state));
+
+  for (auto _ : state) {
+    char* text = NULL;
+    tixiExportDocumentAsString(handle, &text);
+    benchmark::DoNotOptimize(text);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_ExportAsString)->Apply(wingArguments);
+
+// Reads the translation of each element via an indexed path
+static void CPACS_GetDoubleElement(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::vector<std::string> paths;
+  for (int wing = 1; wing <= options.wings; ++wing) {
+    for (int section = 1; section <= options.sectionsPerWing; ++section) {
+      paths.push_back(cpacsElementPath(wing, section, 1) + "/transformation/translation/x");
+    }
+  }
+
+  for (auto _ : state) {
+    for (const auto& path : paths) {
+      double value = 0.;
+      tixiGetDoubleElement(handle, path.c_str(), &value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (int64_t) paths.size());
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_GetDoubleElement)->Apply(wingArguments);
+
+static void CPACS_CheckElement(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::string path = cpacsElementPath(options.wings, options.sectionsPerWing, 1);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tixiCheckElement(handle, path.c_str()));
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_CheckElement)->Apply(wingArguments);
+
+// Descendant query, which scans the whole document
+static void CPACS_XPathDescendantQuery(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::string expression = "//section[@uID=\"wing_" + std::to_string(options.wings) + "_section_1\"]//element";
+
+  for (auto _ : state) {
+    int number = 0;
+    tixiXPathEvaluateNodeNumber(handle, expression.c_str(), &number);
+    benchmark::DoNotOptimize(number);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_XPathDescendantQuery)->Apply(wingArguments);
+
+static void CPACS_GetNamedChildrenCount(benchmark::State& state)
+{
+  CpacsOptions options = wingOptions(state);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::string path = "/cpacs/vehicles/aircraft/model/wings/wing[1]/sections";
+
+  for (auto _ : state) {
+    int count = 0;
+    tixiGetNamedChildrenCount(handle, path.c_str(), "section", &count);
+    benchmark::DoNotOptimize(count);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_GetNamedChildrenCount)->Apply(wingArguments);
+
+// Parses the point lists of all airfoils, the vector cache is cleared before each pass
+static void CPACS_VectorParse(benchmark::State& state)
+{
+  CpacsOptions options;
+  options.airfoils = 16;
+  options.pointsPerAirfoil = (int) state.range(0);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::vector<double> values(options.pointsPerAirfoil);
+  std::vector<std::string> paths;
+  for (int airfoil = 1; airfoil <= options.airfoils; ++airfoil) {
+    paths.push_back(cpacsAirfoilPath(airfoil) + "/pointList/x");
+  }
+
+  for (auto _ : state) {
+    vectorCacheClear(getDocument(handle));
+    for (const auto& path : paths) {
+      tixiGetFloatVectorValues(handle, path.c_str(), values.data(), options.pointsPerAirfoil);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * options.airfoils * options.pointsPerAirfoil);
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_VectorParse)->ArgName("points")->Arg(100)->Arg(1000)->Arg(10000);
+
+// Repeated reads of the same vectors
+static void CPACS_VectorCached(benchmark::State& state)
+{
+  CpacsOptions options;
+  options.airfoils = 16;
+  options.pointsPerAirfoil = (int) state.range(0);
+  TixiDocumentHandle handle = importDocument(state, options);
+  std::vector<std::string> paths;
+  for (int airfoil = 1; airfoil <= options.airfoils; ++airfoil) {
+    paths.push_back(cpacsAirfoilPath(airfoil) + "/pointList/x");
+  }
+
+  for (auto _ : state) {
+    for (const auto& path : paths) {
+      double* values = NULL;
+      tixiGetFloatVector(handle, path.c_str(), &values, options.pointsPerAirfoil);
+      benchmark::DoNotOptimize(values);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * options.airfoils * options.pointsPerAirfoil);
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_VectorCached)->ArgName("points")->Arg(100)->Arg(1000)->Arg(10000);
+
+static void CPACS_UIDCheckDuplicates(benchmark::State& state)
+{
+  TixiDocumentHandle handle = importDocument(state, wingOptions(state));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tixiUIDCheckDuplicates(handle));
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_UIDCheckDuplicates)->Apply(wingArguments);
+
+static void CPACS_UIDCheckLinks(benchmark::State& state)
+{
+  TixiDocumentHandle handle = importDocument(state, wingOptions(state));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tixiUIDCheckLinks(handle));
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_UIDCheckLinks)->Apply(wingArguments);
+
+// Resolves 16 uIDs spread over the document
+static void CPACS_UIDGetXPath(benchmark::State& state)
+{
+  CpacsDocument document = createCpacsDocument(wingOptions(state));
+  TixiDocumentHandle handle = -1;
+  if (tixiImportFromString(document.xml.c_str(), &handle) != SUCCESS) {
+    state.SkipWithError("Cannot import document");
+    return;
+  }
+  std::vector<std::string> uids;
+  for (size_t i = 0; i < 16; ++i) {
+    uids.push_back(document.uids[i * document.uids.size() / 16]);
+  }
+
+  for (auto _ : state) {
+    for (const auto& uid : uids) {
+      char* path = NULL;
+      tixiUIDGetXPath(handle, uid.c_str(), &path);
+      benchmark::DoNotOptimize(path);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (int64_t) uids.size());
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(CPACS_UIDGetXPath)->Apply(wingArguments);
@@ -0,0 +1,209 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "cpacs_generator.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+
+const char* modelPath = "/cpacs/vehicles/aircraft/model";
+const double pi = 3.14159265358979323846;
+
+std::string number(double value)
+{
+  char text[32];
+  snprintf(text, sizeof(text), "%.10g", value);
+  return text;
+}
+
+std::string uid(CpacsDocument& document, const std::string& name)
+{
+  document.uids.push_back(name);
+  return " uID=\"" + name + "\"";
+}
+
+void addPoint(std::string& xml, const std::string& indent, const char* name, double x, double y, double z)
+{
+  xml += indent + "<" + name + ">";
+  xml += "<x>" + number(x) + "</x><y>" + number(y) + "</y><z>" + number(z) + "</z>";
+  xml += std::string("</") + name + ">\n";
+}
+
+void addTransformation(CpacsDocument& document, std::string& xml, const std::string& indent,
+                       const std::string& owner, bool withUID, double x, double y, double z)
+{
+  xml += indent + "<transformation" + (withUID ? uid(document, owner + "_transformation") : "") + ">\n";
+  addPoint(xml, indent + "  ", "scaling", 1., 1., 1.);
+  addPoint(xml, indent + "  ", "rotation", 0., 0., 0.);
+  addPoint(xml, indent + "  ", "translation", x, y, z);
+  xml += indent + "</transformation>\n";
+}
+
+// NACA 0012 like profile, closed at the trailing edge
+std::string createAirfoil(CpacsDocument& document, int index, int nPoints, const std::string& indent)
+{
+  std::string x, y, z;
+  for (int i = 0; i < nPoints; ++i) {
+    double phi = 2. * pi * i / (nPoints > 1 ? nPoints - 1 : 1);
+    double xi = 0.5 * (1. + std::cos(phi));
+    double thickness = 0.6 * (0.2969 * std::sqrt(xi) - 0.126 * xi - 0.3516 * xi * xi + 0.2843 * xi * xi * xi - 0.1036 * xi * xi * xi * xi);
+    const char* separator = i > 0 ? ";" : "";
+    x += separator + number(xi);
+    y += separator + number(0.);
+    z += separator + number(phi < pi ? thickness : -thickness);
+  }
+
+  std::string name = "airfoil_" + std::to_string(index);
+  std::string xml;
+  xml += indent + "<wingAirfoil" + uid(document, name) + ">\n";
+  xml += indent + "  <name>" + name + "</name>\n";
+  xml += indent + "  <pointList>\n";
+  xml += indent + "    <x>" + x + "</x>\n";
+  xml += indent + "    <y>" + y + "</y>\n";
+  xml += indent + "    <z>" + z + "</z>\n";
+  xml += indent + "  </pointList>\n";
+  xml += indent + "</wingAirfoil>\n";
+  return xml;
+}
+
+void addWing(CpacsDocument& document, std::string& xml, const CpacsOptions& options, int wing)
+{
+  const std::string wingUID = "wing_" + std::to_string(wing);
+  xml += "        <wing" + uid(document, wingUID) + " symmetry=\"x-z-plane\">\n";
+  xml += "          <name>" + wingUID + "</name>\n";
+  addTransformation(document, xml, "          ", wingUID, options.transformationUIDs, 10. * wing, 0., 0.);
+
+  xml += "          <sections>\n";
+  for (int section = 1; section <= options.sectionsPerWing; ++section) {
+    const std::string sectionUID = wingUID + "_section_" + std::to_string(section);
+    xml += "            <section" + uid(document, sectionUID) + ">\n";
+    xml += "              <name>" + sectionUID + "</name>\n";
+    addTransformation(document, xml, "              ", sectionUID, options.transformationUIDs, 0., 2. * section, 0.);
+    xml += "              <elements>\n";
+    for (int element = 1; element <= options.elementsPerSection; ++element) {
+      const std::string elementUID = sectionUID + "_element_" + std::to_string(element);
+      int airfoil = options.airfoils > 0 ? (section + element) % options.airfoils + 1 : 0;
+      xml += "                <element" + uid(document, elementUID) + ">\n";
+      xml += "                  <name>" + elementUID + "</name>\n";
+      xml += "                  <airfoilUID>airfoil_" + std::to_string(airfoil) + "</airfoilUID>\n";
+      addTransformation(document, xml, "                  ", elementUID, options.transformationUIDs,
+                        0.1 * section, 0., 0.01 * element);
+      xml += "                </element>\n";
+    }
+    xml += "              </elements>\n";
+    xml += "            </section>\n";
+  }
+  xml += "          </sections>\n";
+
+  xml += "          <segments>\n";
+  for (int section = 1; section < options.sectionsPerWing; ++section) {
+    const std::string segmentUID = wingUID + "_segment_" + std::to_string(section);
+    xml += "            <segment" + uid(document, segmentUID) + ">\n";
+    xml += "              <name>" + segmentUID + "</name>\n";
+    xml += "              <fromElementUID>" + wingUID + "_section_" + std::to_string(section) + "_element_1</fromElementUID>\n";
+    xml += "              <toElementUID>" + wingUID + "_section_" + std::to_string(section + 1) + "_element_1</toElementUID>\n";
+    xml += "            </segment>\n";
+  }
+  xml += "          </segments>\n";
+  xml += "        </wing>\n";
+}
+
+} // namespace
+
+CpacsDocument createCpacsDocument(const CpacsOptions& options)
+{
+  CpacsDocument document;
+  std::string& xml = document.xml;
+
+  xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+  xml += "<cpacs>\n";
+  xml += "  <header>\n";
+  xml += "    <name>synthetic</name>\n";
+  xml += "    <version>1.0</version>\n";
+  xml += "    <cpacsVersion>3.3</cpacsVersion>\n";
+  xml += "  </header>\n";
+  xml += "  <vehicles>\n";
+  xml += "    <aircraft>\n";
+  xml += "      <model" + uid(document, "model") + ">\n";
+  xml += "        <name>synthetic</name>\n";
+  xml += "        <wings>\n";
+  for (int wing = 1; wing <= options.wings; ++wing) {
+    addWing(document, xml, options, wing);
+  }
+  xml += "        </wings>\n";
+  xml += "      </model>\n";
+  xml += "    </aircraft>\n";
+
+  xml += "    <profiles>\n";
+  xml += "      <wingAirfoils>\n";
+  for (int airfoil = 1; airfoil <= options.airfoils; ++airfoil) {
+    if (airfoil <= options.externalAirfoils) {
+      std::string filename = "airfoil_" + std::to_string(airfoil) + ".xml";
+      xml += "        <externaldata>\n";
+      xml += "          <path></path>\n";
+      xml += "          <filename>" + filename + "</filename>\n";
+      xml += "        </externaldata>\n";
+      document.externalFiles.emplace_back(filename, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" +
+                                          createAirfoil(document, airfoil, options.pointsPerAirfoil, ""));
+    }
+    else {
+      xml += createAirfoil(document, airfoil, options.pointsPerAirfoil, "        ");
+    }
+  }
+  xml += "      </wingAirfoils>\n";
+  xml += "    </profiles>\n";
+  xml += "  </vehicles>\n";
+  xml += "</cpacs>\n";
+
+  return document;
+}
+
+bool writeCpacsDocument(const CpacsDocument& document, const std::string& filename)
+{
+  std::string directory;
+  size_t separator = filename.find_last_of("/\\");
+  if (separator != std::string::npos) {
+    directory = filename.substr(0, separator + 1);
+  }
+
+  std::ofstream file(filename, std::ios::binary);
+  file << document.xml;
+  for (const auto& external : document.externalFiles) {
+    std::ofstream externalFile(directory + external.first, std::ios::binary);
+    externalFile << external.second;
+    if (!externalFile) {
+      return false;
+    }
+  }
+  return static_cast<bool>(file);
+}
+
+std::string cpacsElementPath(int wing, int section, int element)
+{
+  return std::string(modelPath) + "/wings/wing[" + std::to_string(wing) + "]/sections/section[" +
+         std::to_string(section) + "]/elements/element[" + std::to_string(element) + "]";
+}
+
+std::string cpacsAirfoilPath(int airfoil)
+{
+  return "/cpacs/vehicles/profiles/wingAirfoils/wingAirfoil[" + std::to_string(airfoil) + "]";
+}
@@ -0,0 +1,68 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_CPACS_GENERATOR_H
+#define TIXI_CPACS_GENERATOR_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Size of a synthetic CPACS document. The content only depends on these
+ * options, so the documents are identical in every benchmark run.
+ */
+struct CpacsOptions
+{
+  int wings = 2;
+  int sectionsPerWing = 10;
+  int elementsPerSection = 1;
+  int airfoils = 4;
+  int pointsPerAirfoil = 200;    ///< length of the x, y and z vectors of each airfoil
+  int externalAirfoils = 0;      ///< number of airfoils stored in separate files, included via externaldata
+  bool transformationUIDs = true; ///< adds uIDs to the transformations of sections and elements
+};
+
+struct CpacsDocument
+{
+  std::string xml;
+  std::vector<std::pair<std::string, std::string>> externalFiles; ///< file name and content of each include
+  std::vector<std::string> uids;
+};
+
+/**
+ * @brief Creates a CPACS document with wings, sections, elements, segments and airfoils.
+ */
+CpacsDocument createCpacsDocument(const CpacsOptions& options);
+
+/**
+ * @brief Writes the document and its external files into the directory of filename.
+ */
+bool writeCpacsDocument(const CpacsDocument& document, const std::string& filename);
+
+/**
+ * @brief Returns the XPath of an element of a section, all indices start at 1.
+ */
+std::string cpacsElementPath(int wing, int section, int element);
+
+/**
+ * @brief Returns the XPath of an airfoil, the index starts at 1.
+ */
+std::string cpacsAirfoilPath(int airfoil);
+
+#endif // TIXI_CPACS_GENERATOR_H
@@ -0,0 +1,198 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "tixi.h"
+#include "tixiInternal.h"
+
+#include <libxslt/transform.h>
+#include <libxslt/xsltutils.h>
+
+#include <string>
+#include <vector>
+
+static const char* xmlFilename = "TestData/valid_CPACS_dokumentiert.xml";
+static const char* stylesheetFilename = "TestData/mappingInputRaw.xsl";
+
+// Transformation as done before the stylesheet cache: the stylesheet is
+// parsed and compiled again for every document
+static void XSLT_Uncached(benchmark::State& state)
+{
+  TixiDocumentHandle handle = -1;
+  if (tixiOpenDocument(xmlFilename, &handle) != SUCCESS) {
+    state.SkipWithError("Cannot open document");
+    return;
+  }
+  xmlDocPtr doc = getDocument(handle)->docPtr;
+
+  for (auto _ : state) {
+    xsltStylesheetPtr style = xsltParseStylesheetFile((const xmlChar*) stylesheetFilename);
+    xmlDocPtr result = xsltApplyStylesheet(style, doc, NULL);
+    xmlChar* text = NULL;
+    int length = 0;
+    xsltSaveResultToString(&text, &length, result, style);
+    benchmark::DoNotOptimize(text);
+
+    xmlFree(text);
+    xmlFreeDoc(result);
+    xsltFreeStylesheet(style);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(XSLT_Uncached);
+
+static void XSLT_CachedFilename(benchmark::State& state)
+{
+  TixiDocumentHandle handle = -1;
+  if (tixiOpenDocument(xmlFilename, &handle) != SUCCESS) {
+    state.SkipWithError("Cannot open document");
+    return;
+  }
+
+  for (auto _ : state) {
+    char* text = NULL;
+    tixiXSLTransformationToString(handle, stylesheetFilename, &text);
+    benchmark::DoNotOptimize(text);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(XSLT_CachedFilename);
+
+static void XSLT_StylesheetHandle(benchmark::State& state)
+{
+  TixiDocumentHandle handle = -1;
+  TixiStylesheetHandle styleHandle = -1;
+  if (tixiOpenDocument(xmlFilename, &handle) != SUCCESS ||
+      tixiStylesheetLoad(stylesheetFilename, &styleHandle) != SUCCESS) {
+    state.SkipWithError("Cannot open document or stylesheet");
+    return;
+  }
+
+  for (auto _ : state) {
+    char* text = NULL;
+    tixiStylesheetTransformToString(handle, styleHandle, &text);
+    benchmark::DoNotOptimize(text);
+  }
+
+  tixiStylesheetFree(styleHandle);
+  tixiCloseDocument(handle);
+}
+BENCHMARK(XSLT_StylesheetHandle);
+
+// Transformation result as new document via serialization and parsing
+static void XSLT_StringImport(benchmark::State& state)
+{
+  TixiDocumentHandle handle = -1;
+  if (tixiOpenDocument(xmlFilename, &handle) != SUCCESS) {
+    state.SkipWithError("Cannot open document");
+    return;
+  }
+
+  for (auto _ : state) {
+    char* text = NULL;
+    TixiDocumentHandle resultHandle = -1;
+    tixiXSLTransformationToString(handle, stylesheetFilename, &text);
+    tixiImportFromString(text, &resultHandle);
+    tixiCloseDocument(resultHandle);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(XSLT_StringImport);
+
+static void XSLT_ToDocument(benchmark::State& state)
+{
+  TixiDocumentHandle handle = -1;
+  if (tixiOpenDocument(xmlFilename, &handle) != SUCCESS) {
+    state.SkipWithError("Cannot open document");
+    return;
+  }
+
+  for (auto _ : state) {
+    TixiDocumentHandle resultHandle = -1;
+    tixiXSLTransformationToDocument(handle, stylesheetFilename, &resultHandle);
+    tixiCloseDocument(resultHandle);
+  }
+
+  tixiCloseDocument(handle);
+}
+BENCHMARK(XSLT_ToDocument);
+
+// Throughput of the batch transformation depending on the number of threads
+static const int batchSize = 64;
+
+static void XSLT_BatchDocuments(benchmark::State& state)
+{
+  std::vector<TixiDocumentHandle> handles(batchSize, -1);
+  std::vector<TixiDocumentHandle> resultHandles(batchSize, -1);
+  TixiStylesheetHandle styleHandle = -1;
+
+  if (tixiStylesheetLoad(stylesheetFilename, &styleHandle) != SUCCESS) {
+    state.SkipWithError("Cannot open stylesheet");
+    return;
+  }
+  for (auto& handle : handles) {
+    tixiOpenDocument(xmlFilename, &handle);
+  }
+
+  for (auto _ : state) {
+    tixiStylesheetTransformDocuments(styleHandle, handles.data(), batchSize, (int) state.range(0), resultHandles.data());
+    for (auto handle : resultHandles) {
+      tixiCloseDocument(handle);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+
+  for (auto handle : handles) {
+    tixiCloseDocument(handle);
+  }
+  tixiStylesheetFree(styleHandle);
+}
+BENCHMARK(XSLT_BatchDocuments)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+static void XSLT_BatchFiles(benchmark::State& state)
+{
+  std::vector<std::string> outputs;
+  std::vector<const char*> inputFilenames(batchSize, xmlFilename);
+  std::vector<const char*> outputFilenames;
+  TixiStylesheetHandle styleHandle = -1;
+
+  if (tixiStylesheetLoad(stylesheetFilename, &styleHandle) != SUCCESS) {
+    state.SkipWithError("Cannot open stylesheet");
+    return;
+  }
+  for (int i = 0; i < batchSize; ++i) {
+    outputs.push_back("batchResult" + std::to_string(i) + ".xml");
+  }
+  for (const auto& output : outputs) {
+    outputFilenames.push_back(output.c_str());
+  }
+
+  for (auto _ : state) {
+    tixiStylesheetTransformFiles(styleHandle, inputFilenames.data(), outputFilenames.data(), batchSize, (int) state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+
+  tixiStylesheetFree(styleHandle);
+}
+BENCHMARK(XSLT_BatchFiles)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
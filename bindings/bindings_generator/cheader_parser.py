@@ -350,6 +350,9 @@ class CFunctionArg(object):
             return mytype
         elif match and name.startswith('enum'):
             return 'int'
+        elif match and name.startswith('struct'):
+            # structs are opaque to the bindings, functions using them have to be blacklisted
+            return cst + 'void' + ptr
         elif match and name in typedefs:
             return cst + self.resolv_type(typedefs[name], enums, typedefs) + ptr
         else:
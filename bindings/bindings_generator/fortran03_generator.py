@@ -151,7 +151,8 @@ end type
             method_name = dec.method_name
             if self.requires_method_wrapper(dec):
                 method_name = method_name + self.internal_suffix
-                private_methods.append(method_name)
+                if not method_name in self.blacklist:
+                    private_methods.append(method_name)
             if not method_name in self.blacklist:
                 try:
                     header, footer = self.create_method_declaration(method_name, dec, 'C')
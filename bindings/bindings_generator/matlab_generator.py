@@ -16,6 +16,9 @@ class MatlabGenerator(object):
         self.prefix  = prefix
         self.libinclude = includefile
         self.blacklist  = []
+        # handwritten mex functions (mex_<name>) defined in the extra includes
+        self.extra_includes  = []
+        self.extra_functions = []
         self.mex_body = '(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])'
         
     def create_m_file(self, fun_dec):
@@ -168,14 +171,33 @@ class MatlabGenerator(object):
         return string
         
         
+    @staticmethod
+    def is_inplace_array(arg):
+        '''preallocated double arrays are filled directly in the returned matlab matrix'''
+        return arg.is_outarg and arg.arrayinfos['is_array'] and not arg.arrayinfos['autoalloc'] \
+            and arg.type == 'double' and arg.npointer == 1
+
+    @staticmethod
+    def output_index(func, arg):
+        '''index of the output argument in plhs'''
+        outargs = [a for a in func.arguments if a.is_outarg]
+        offset = 1 if not func.returns_error and func.return_value.type != 'void' else 0
+        return outargs.index(arg) + offset
+
     def create_mex_allocs(self, func):
         string = ''
         outarrays = [arg for arg in func.arguments if arg.is_outarg and \
             arg.arrayinfos['is_array'] and not arg.arrayinfos['autoalloc']]
         for arg in outarrays:
-            string += 4*' ' + '%s = mxMalloc(sizeof(%s) * %s);\n' \
-                % (arg.name, arg.type + (arg.npointer-1)*'*', arg.name+'_size')
-                
+            if self.is_inplace_array(arg):
+                index = self.output_index(func, arg)
+                string += 4*' ' + 'plhs[%d] = mxCreateDoubleMatrix(1, %s, mxREAL);\n' \
+                    % (index, arg.name+'_size')
+                string += 4*' ' + '%s = mxGetPr(plhs[%d]);\n' % (arg.name, index)
+            else:
+                string += 4*' ' + '%s = mxMalloc(sizeof(%s) * %s);\n' \
+                    % (arg.name, arg.type + (arg.npointer-1)*'*', arg.name+'_size')
+
         return string
         
     
@@ -361,6 +383,8 @@ This function returns %d value(s)\\n");\n' % (pseudocall, noutargs)
             retargs.insert(0, func.return_value)
             
         for index, arg in enumerate(retargs):
+            if self.is_inplace_array(arg):
+                continue
             for line in self.convert_c_to_mx(arg, index).splitlines():
                 string += 4*' ' + line + '\n'
                 
@@ -393,12 +417,12 @@ extern "C" {
 
 ''' 
         call = ''
-        defs = (fun for fun in self.cparser.declarations if fun.method_name not in self.blacklist)
-        for index, func in enumerate(defs):
+        names = [fun.method_name for fun in self.cparser.declarations if fun.method_name not in self.blacklist]
+        for index, name in enumerate(names + self.extra_functions):
             if index > 0:
                 call += 'else '
-            call += 'if (strcmp(functionName, "%s") == 0) {\n' % func.method_name
-            call += '    mex_%s(nlhs, plhs, nrhs, prhs);\n' % func.method_name
+            call += 'if (strcmp(functionName, "%s") == 0) {\n' % name
+            call += '    mex_%s(nlhs, plhs, nrhs, prhs);\n' % name
             call += '}\n'
         
         call += '''else {
@@ -459,6 +483,8 @@ mxFree(functionName);
         
         string += '#include <%s>\n\n' % self.libinclude
         string += self.create_mex_error_handler() + '\n\n'
+        for include in self.extra_includes:
+            string += '#include "%s"\n\n' % include
         
         defs = (fun for fun in self.cparser.declarations if fun.method_name not in self.blacklist)
         for function in defs:
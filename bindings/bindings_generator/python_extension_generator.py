@@ -0,0 +1,256 @@
+# -*- coding: utf-8 -*-
+"""
+Generates a compiled python extension module from the parsed semantics of a
+C header. The extension provides a fast call path for the functions of the
+ctypes wrapper created by the PythonGenerator: arguments are converted
+directly with the python C API and the GIL is released during the call, such
+that documents can be processed in parallel by python threads.
+
+Only functions with scalar (int, double, string) arguments are supported,
+all other functions are called via ctypes only. Functions changing the global
+state of the library, e.g. cleanup functions, can be listed in keep_gil and
+are called without releasing the GIL.
+"""
+
+
+class PythonExtensionGenerator(object):
+    '''
+    Generates the C source of a python extension module
+    '''
+
+    def __init__(self, name_prefix, libname):
+        self.prefix = name_prefix
+        self.libname = libname
+        self.modulename = '_' + libname
+        self.license = None
+        self.header = libname + '.h'
+        self.blacklist = []
+        self.keep_gil = []
+        self.returncode = 'int'
+        self.successcode = '0'
+
+    @staticmethod
+    def is_handle(fun_dec, arg):
+        return arg.is_handle and fun_dec.uses_handle
+
+    def is_supported_arg(self, fun_dec, arg):
+        if arg.arrayinfos['is_array']:
+            return False
+        if self.is_handle(fun_dec, arg):
+            return arg.npointer == (1 if arg.is_outarg else 0)
+        if arg.is_string:
+            return arg.npointer == (2 if arg.is_outarg else 1)
+        if arg.type in ('int', 'double'):
+            return arg.npointer == (1 if arg.is_outarg else 0)
+        return False
+
+    def is_supported(self, fun_dec):
+        '''Returns True, if the extension contains a fast call path for the function'''
+        if fun_dec.method_name in self.blacklist or not fun_dec.returns_error:
+            return False
+        if not all(self.is_supported_arg(fun_dec, arg) for arg in fun_dec.arguments):
+            return False
+        # a new handle is returned by the wrapper object itself, not to the caller
+        outargs = [arg for arg in fun_dec.arguments if arg.is_outarg]
+        if any(self.is_handle(fun_dec, arg) for arg in outargs):
+            return len(outargs) == 1
+        # the handle of the wrapper object is passed as first argument
+        handles = [index for index, arg in enumerate(fun_dec.arguments) if self.is_handle(fun_dec, arg)]
+        return handles in ([], [0])
+
+    def supported_functions(self, cparser):
+        return [dec.method_name for dec in cparser.declarations if self.is_supported(dec)]
+
+    def create_extension(self, cparser):
+        if cparser.returncode_str in cparser.enums:
+            self.returncode = cparser.returncode_str
+            self.successcode = cparser.enums[cparser.returncode_str][0]
+
+        string = ''
+        if self.license:
+            string += self.license
+        string += '#define PY_SSIZE_T_CLEAN\n'
+        string += '#include <Python.h>\n'
+        string += '#include <limits.h>\n\n'
+        string += '#include "%s"\n\n' % self.header
+        string += self.get_helpers() + '\n'
+
+        functions = [dec for dec in cparser.declarations if self.is_supported(dec)]
+        for dec in functions:
+            string += self.create_function(dec) + '\n'
+
+        string += self.create_module(functions)
+        return string
+
+    def create_function(self, fun_dec):
+        '''Creates the python function calling fun_dec, with released GIL unless listed in keep_gil'''
+        name = fun_dec.method_name
+        indent = 2*' '
+        inargs = [arg for arg in fun_dec.arguments if not arg.is_outarg]
+        outargs = [arg for arg in fun_dec.arguments if arg.is_outarg]
+        # the handle is not part of the arguments passed to the error handler
+        handle_in = any(self.is_handle(fun_dec, arg) for arg in inargs)
+
+        string = 'static PyObject* py_%s(PyObject* self, PyObject* const* args, Py_ssize_t nargs)\n{\n' % name
+        for arg in inargs:
+            if arg.is_string:
+                string += indent + 'const char* %s = NULL;\n' % arg.name
+            elif arg.type == 'double':
+                string += indent + 'double %s = 0.;\n' % arg.name
+            else:
+                string += indent + 'int %s = 0;\n' % arg.name
+        for arg in outargs:
+            if arg.is_string:
+                string += indent + 'char* %s = NULL;\n' % arg.name
+            else:
+                string += indent + '%s %s = 0;\n' % (arg.rawtype, arg.name)
+        string += indent + '%s error = %s;\n\n' % (self.returncode, self.successcode)
+
+        conditions = ['checkArgumentCount("%s", nargs, %d)' % (name, len(inargs))]
+        for index, arg in enumerate(inargs):
+            if arg.is_string:
+                conditions.append('toString(args[%d], &%s)' % (index, arg.name))
+            elif arg.type == 'double':
+                conditions.append('toDouble(args[%d], &%s)' % (index, arg.name))
+            else:
+                conditions.append('toInt(args[%d], &%s)' % (index, arg.name))
+        string += indent + 'if (!' + ('\n' + indent + '    || !').join(conditions) + ') {\n'
+        string += indent + '  return NULL;\n'
+        string += indent + '}\n\n'
+
+        callargs = [('&' if arg.is_outarg else '') + arg.name for arg in fun_dec.arguments]
+        if name in self.keep_gil:
+            string += indent + 'error = %s(%s);\n\n' % (name, ', '.join(callargs))
+        else:
+            string += indent + 'Py_BEGIN_ALLOW_THREADS\n'
+            string += indent + 'error = %s(%s);\n' % (name, ', '.join(callargs))
+            string += indent + 'Py_END_ALLOW_THREADS\n\n'
+
+        string += indent + 'if (error != %s) {\n' % self.successcode
+        if handle_in:
+            string += indent + '  return raiseError(error, "%s", args + 1, nargs - 1);\n' % name
+        else:
+            string += indent + '  return raiseError(error, "%s", args, nargs);\n' % name
+        string += indent + '}\n'
+
+        if len(outargs) == 0:
+            string += indent + 'Py_RETURN_NONE;\n'
+        else:
+            formats = ''.join('s' if arg.is_string else ('d' if arg.type == 'double' else 'i') for arg in outargs)
+            if len(outargs) > 1:
+                formats = '(' + formats + ')'
+            string += indent + 'return Py_BuildValue("%s", %s);\n' % (formats, ', '.join(arg.name for arg in outargs))
+        string += '}\n'
+        return string
+
+    def create_module(self, functions):
+        string = 'static PyMethodDef methods[] = {\n'
+        for dec in functions:
+            string += '  {"%s", (PyCFunction) (void (*)(void)) py_%s, METH_FASTCALL, NULL},\n' \
+                % (dec.method_name, dec.method_name)
+        string += '  {"set_error_handler", setErrorHandler, METH_O,\n'
+        string += '   "Sets the function called with the error code, the function name and the arguments on errors"},\n'
+        string += '  {NULL, NULL, 0, NULL}\n'
+        string += '};\n\n'
+        string += 'static struct PyModuleDef module = {\n'
+        string += '  PyModuleDef_HEAD_INIT, "%s",\n' % self.modulename
+        string += '  "Fast call path of the %s python wrapper, which releases the GIL during calls",\n' \
+            % self.libname
+        string += '  -1, methods, NULL, NULL, NULL, NULL\n'
+        string += '};\n\n'
+        string += 'PyMODINIT_FUNC PyInit_%s(void)\n{\n' % self.modulename
+        string += '  return PyModule_Create(&module);\n'
+        string += '}\n'
+        return string
+
+    def get_helpers(self):
+        return """static PyObject* errorHandler = NULL;
+
+static PyObject* setErrorHandler(PyObject* self, PyObject* handler)
+{
+  Py_INCREF(handler);
+  Py_XSETREF(errorHandler, handler);
+  Py_RETURN_NONE;
+}
+
+/* calls the error handler like the ctypes wrapper does, which raises the exception */
+static PyObject* raiseError(int error, const char* function, PyObject* const* args, Py_ssize_t nargs)
+{
+  PyObject* handlerArgs = NULL;
+  PyObject* result = NULL;
+  Py_ssize_t i;
+
+  if (!errorHandler) {
+    PyErr_Format(PyExc_RuntimeError, "%s failed with error %d", function, error);
+    return NULL;
+  }
+
+  handlerArgs = PyTuple_New(nargs + 2);
+  if (!handlerArgs) {
+    return NULL;
+  }
+  PyTuple_SET_ITEM(handlerArgs, 0, PyLong_FromLong(error));
+  PyTuple_SET_ITEM(handlerArgs, 1, PyUnicode_FromString(function));
+  for (i = 0; i < nargs; ++i) {
+    Py_INCREF(args[i]);
+    PyTuple_SET_ITEM(handlerArgs, i + 2, args[i]);
+  }
+
+  result = PyObject_Call(errorHandler, handlerArgs, NULL);
+  Py_DECREF(handlerArgs);
+  if (result) {
+    Py_DECREF(result);
+    PyErr_Format(PyExc_RuntimeError, "%s failed with error %d", function, error);
+  }
+  return NULL;
+}
+
+static int checkArgumentCount(const char* function, Py_ssize_t nargs, Py_ssize_t expected)
+{
+  if (nargs != expected) {
+    PyErr_Format(PyExc_TypeError, "%s expects %zd arguments, %zd given", function, expected, nargs);
+    return 0;
+  }
+  return 1;
+}
+
+/* accepts str, bytes and None like the ctypes wrapper, which passes 0 as NULL as well */
+static int toString(PyObject* object, const char** value)
+{
+  if (object == Py_None || (PyLong_CheckExact(object) && PyLong_AsLong(object) == 0)) {
+    *value = NULL;
+    return 1;
+  }
+  else if (PyUnicode_Check(object)) {
+    *value = PyUnicode_AsUTF8(object);
+  }
+  else if (PyBytes_Check(object)) {
+    *value = PyBytes_AS_STRING(object);
+  }
+  else {
+    PyErr_Format(PyExc_TypeError, "expected str, bytes or None, got %s", Py_TYPE(object)->tp_name);
+    return 0;
+  }
+  return *value != NULL;
+}
+
+static int toInt(PyObject* object, int* value)
+{
+  long number = PyLong_AsLong(object);
+  if (number == -1 && PyErr_Occurred()) {
+    return 0;
+  }
+  if (number < INT_MIN || number > INT_MAX) {
+    PyErr_SetString(PyExc_OverflowError, "integer argument out of range");
+    return 0;
+  }
+  *value = (int) number;
+  return 1;
+}
+
+static int toDouble(PyObject* object, double* value)
+{
+  *value = PyFloat_AsDouble(object);
+  return !(*value == -1. && PyErr_Occurred());
+}
+"""
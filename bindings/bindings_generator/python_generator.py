@@ -42,6 +42,9 @@ class PythonGenerator(object):
         self.closefunction = None
         self.blacklist = []
         self.aliases = {}
+        # compiled extension module providing a fast call path, see PythonExtensionGenerator
+        self.native_module = None
+        self.native_functions = []
             
     def add_alias(self, oldname, newname):
         self.aliases[oldname] = newname
@@ -57,6 +60,8 @@ class PythonGenerator(object):
 
         string += self.create_error_handler(cparser)+'\n\n'
         string += self.get_helpers() + "\n\n"
+        if self.native_module:
+            string += self.create_native_import() + "\n\n"
         
         string += 'class %s(object):\n\n' % (self.classname)
         string += self.create_constructor()
@@ -109,6 +114,41 @@ class PythonGenerator(object):
         return string
                 
 
+    def create_native_import(self):
+        string  = '# the compiled extension is optional, functions are called via ctypes without it\n'
+        string += 'try:\n'
+        string += '    import %s as _native\n' % self.native_module
+        string += '    _native.set_error_handler(catch_error)\n'
+        string += 'except ImportError:\n'
+        string += '    _native = None\n'
+        return string
+
+    def create_native_call(self, fun_dec, indention_depth):
+        '''
+        Creates the call to the compiled extension, which converts the arguments
+        in C and releases the GIL during the call
+        '''
+        indent = 4*(indention_depth+1)*' '
+        args = []
+        handle_out = False
+        for arg in fun_dec.arguments:
+            if arg.is_handle and fun_dec.uses_handle:
+                if arg.is_outarg:
+                    handle_out = True
+                else:
+                    args.append('self.%s.value' % self.handle_str)
+            elif not arg.is_outarg:
+                args.append(arg.name)
+
+        call = '_native.%s(%s)' % (fun_dec.method_name, ', '.join(args))
+        string = indent + 'if _native is not None:\n'
+        if handle_out:
+            string += indent + '    self.%s.value = %s\n' % (self.handle_str, call)
+            string += indent + '    return\n'
+        else:
+            string += indent + '    return %s\n' % call
+        return string + '\n'
+
     def create_constructor(self):
         indent = 4*' '
         string = ''
@@ -133,7 +173,9 @@ class PythonGenerator(object):
 
         string += indent + 'def __init__(self):\n'
         indent +=  4*' '
-        string += indent + 'self.%s = ctypes.c_int(-1)\n\n' % self.handle_str
+        string += indent + 'self.%s = ctypes.c_int(-1)\n' % self.handle_str
+        string += indent + '# return numeric arrays as numpy arrays instead of tuples\n'
+        string += indent + 'self.numpyArrays = False\n\n'
         
         return string
         
@@ -236,12 +278,9 @@ class PythonGenerator(object):
                 tmp_str = '_c_%s = ctypes.c_%s(%s)' \
                     % (arg.name, arg.type, arg.name)
             elif arg.arrayinfos['is_array'] and arg.npointer > 0:
-                # create type
-                tmp_str = 'array_t_%s = ctypes.c_%s * len(%s)\n' \
-                    % (arg.name, arg.type, arg.name)
-                tmp_str += indent
-                tmp_str += '_c_%s = array_t_%s(*%s)' \
-                    % (arg.name, arg.name, arg.name)
+                # numpy arrays and buffers are passed without copying each element
+                tmp_str = '_c_%s = to_c_array(%s, ctypes.c_%s)' \
+                    % (arg.name, arg.name, arg.type)
             else:
                 raise Exception('Cannot create python to c conversion ' +
                  'for input argument "%s" in "%s"' % (arg.name, raw_name))
@@ -357,6 +396,9 @@ class PythonGenerator(object):
         
         ret_val = None if fun_dec.returns_error else fun_dec.return_value
 
+        if self.native_module and fun_dec.method_name in self.native_functions:
+            string += self.create_native_call(fun_dec, 1)
+
         string += self.create_pre_call(fun_dec, num_inargs, num_outargs, 1)
         string += '\n'
                             
@@ -414,7 +456,7 @@ class PythonGenerator(object):
                         
             string += 2*indent + size_str[0:-1] + '\n'
             if not arg.is_string:
-                tmp_str = '_py_%s = tuple(_c_%s[i] for i in range(%s_array_size))' \
+                tmp_str = '_py_%s = from_c_array(_c_%s, %s_array_size, self.numpyArrays)' \
                     % (arg.name, arg.name, arg.name)
             else:
                 tmp_str = '_py_%s = tuple(decode_for_py(_c_%s[i]) for i in range(%s_array_size))' \
@@ -443,6 +485,36 @@ class PythonGenerator(object):
         
     def get_helpers(self):
         return """
+try:
+    import numpy, numpy.ctypeslib
+except ImportError:
+    numpy = None
+
+def to_c_array(values, ctype):
+    ''' Converts a sequence to a C array. Numpy arrays and contiguous buffers
+        of the same type are passed without copying the values one by one. '''
+    if numpy is not None and isinstance(values, numpy.ndarray):
+        return numpy.ascontiguousarray(values, dtype=ctype).ctypes
+    try:
+        view = memoryview(values)
+        if view.ndim == 1 and view.c_contiguous and not view.readonly and view.format == ctype._type_:
+            return (ctype * len(view)).from_buffer(view)
+    except TypeError:
+        pass
+    return (ctype * len(values))(*values)
+
+def from_c_array(pointer, size, as_numpy=False):
+    ''' Copies a C array into a tuple or, if as_numpy is set, into a numpy array '''
+    if not as_numpy:
+        return tuple(pointer[:size])
+    if numpy is None:
+        raise ImportError("numpy is required to return numpy arrays")
+    if size == 0:
+        return numpy.empty(0, dtype=pointer._type_)
+    if isinstance(pointer, ctypes.Array):
+        return numpy.ctypeslib.as_array(pointer)[:size].copy()
+    return numpy.ctypeslib.as_array(pointer, shape=(size,)).copy()
+
 def encode_for_c(thestring):
     if type(thestring) is str:
         return str.encode(thestring)
@@ -25,6 +25,20 @@
 #include <sstream>
 #include <stdexcept>
 
+// tixi::Document requires C++17
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#define TIXICPP_HAS_DOCUMENT
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#endif
+
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#include <span>
+#endif
+
 namespace tixi
 {
     namespace internal
@@ -389,19 +403,37 @@ namespace tixi
         return nodeNamePtr;
     }
 
+    inline std::vector<std::string> TixiGetChildNodeNames(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
+    {
+        int count = 0;
+        char** names = NULL;
+        const ReturnCode ret = tixiGetChildNodeList(tixiHandle, xpath.c_str(), &count, &names, NULL, NULL);
+        if (ret != SUCCESS) {
+            throw TixiError(ret,
+                "Failed to get child node names\n"
+                "xpath: " + xpath
+            );
+        }
+        return std::vector<std::string>(names, names + count);
+    }
+
     inline std::vector<std::string> TixiGetChildElementPaths(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
-        const int childCount = TixiGetNumberOfChilds(tixiHandle, xpath);
-        std::map<std::string, int> namedChildIndex;
+        int count = 0;
+        char** names = NULL;
+        char** paths = NULL;
+        char** types = NULL;
+        const ReturnCode ret = tixiGetChildNodeList(tixiHandle, xpath.c_str(), &count, &names, &paths, &types);
+        if (ret != SUCCESS) {
+            throw TixiError(ret,
+                "Failed to get child element paths\n"
+                "xpath: " + xpath
+            );
+        }
         std::vector<std::string> childElementPaths;
-        for (int i = 1; i <= childCount; i++) {
-            const std::string nodeName = TixiGetChildNodeName(tixiHandle, xpath, i);
-            if (nodeName == "#text" || nodeName == "#cdata-section" || nodeName == "#comment") {
-                continue;
-            }
-            const std::string childPath = xpath + "/" + nodeName + "[" + internal::to_string(++namedChildIndex[nodeName]) + "]";
-            if (tixiCheckElement(tixiHandle, childPath.c_str()) == SUCCESS) {
-                childElementPaths.push_back(childPath);
+        for (int i = 0; i < count; i++) {
+            if (std::string(types[i]) == "ELEMENT_NODE") {
+                childElementPaths.push_back(paths[i]);
             }
         }
         return childElementPaths;
@@ -433,7 +465,7 @@ namespace tixi
 
     inline std::string TixiGetTextAttribute  (const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute)
     {
-        return std::string(internal::TixiGetAttributeInternal<char*>(tixiHandle, xpath, attribute, tixiGetTextAttribute));
+        return std::string(internal::TixiGetAttributeInternal<char*>(tixiHandle, xpath, attribute, tixiGetTextAttributeView));
     }
 
     inline double      TixiGetDoubleAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute)
@@ -459,7 +491,7 @@ namespace tixi
 
     inline std::string TixiGetTextElement  (const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
-        return std::string(internal::TixiGetElementInternal<char*>(tixiHandle, xpath, tixiGetTextElement));
+        return std::string(internal::TixiGetElementInternal<char*>(tixiHandle, xpath, tixiGetTextElementView));
     }
 
     inline double      TixiGetDoubleElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
@@ -620,4 +652,507 @@ namespace tixi
             throw TixiError(ret, "Failed to register all document namespaces");
         }
     }
+
+#ifdef TIXICPP_HAS_DOCUMENT
+
+#ifdef __cpp_lib_span
+    using std::span;
+#else
+    /// Minimal replacement of std::span for C++17
+    template <typename T>
+    class span
+    {
+    public:
+        constexpr span() noexcept : m_data(nullptr), m_size(0) {}
+        constexpr span(T* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+        constexpr T* data() const noexcept { return m_data; }
+        constexpr std::size_t size() const noexcept { return m_size; }
+        constexpr bool empty() const noexcept { return m_size == 0; }
+        constexpr T* begin() const noexcept { return m_data; }
+        constexpr T* end() const noexcept { return m_data + m_size; }
+        constexpr T& operator[](std::size_t index) const { return m_data[index]; }
+
+    private:
+        T* m_data;
+        std::size_t m_size;
+    };
+#endif
+
+    namespace internal
+    {
+        /// A C string argument, which can be given as string literal or std::string without copying it
+        struct CString
+        {
+            CString(const char* str) : str(str) {}
+            CString(const std::string& str) : str(str.c_str()) {}
+
+            const char* str;
+        };
+
+        inline std::string_view trimWhitespace(std::string_view text)
+        {
+            const std::size_t begin = text.find_first_not_of(" \t\r\n");
+            if (begin == std::string_view::npos) {
+                return std::string_view();
+            }
+            return text.substr(begin, text.find_last_not_of(" \t\r\n") - begin + 1);
+        }
+
+        template <typename T>
+        T parseNumber(std::string_view text, const char* xpath)
+        {
+            // std::from_chars does not accept whitespace or a leading plus
+            text = trimWhitespace(text);
+            if (!text.empty() && text.front() == '+') {
+                text.remove_prefix(1);
+            }
+
+            T value = T();
+            bool valid = !text.empty();
+#if !defined(__cpp_lib_to_chars)
+            if constexpr (std::is_floating_point<T>::value) {
+                // std::from_chars does not support floating point numbers yet
+                const std::string copy(text);
+                char* end = NULL;
+                value = static_cast<T>(std::strtod(copy.c_str(), &end));
+                valid = valid && end == copy.c_str() + copy.size();
+            }
+            else
+#endif
+            {
+                const std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+                valid = valid && result.ec == std::errc() && result.ptr == text.data() + text.size();
+            }
+            if (!valid) {
+                throw TixiError(NO_NUMBER,
+                    "Error converting value to a number\n"
+                    "xpath: " + std::string(xpath) + "\n"
+                    "value: " + std::string(text)
+                );
+            }
+            return value;
+        }
+
+        inline bool parseBool(std::string_view text, const char* xpath)
+        {
+            if (text == "true" || text == "1") {
+                return true;
+            }
+            if (text == "false" || text == "0") {
+                return false;
+            }
+            throw TixiError(FAILED,
+                "Error converting value to a boolean\n"
+                "xpath: " + std::string(xpath) + "\n"
+                "value: " + std::string(text)
+            );
+        }
+
+        template <typename T>
+        T convertText(std::string_view text, const char* xpath)
+        {
+            if constexpr (std::is_same<T, std::string_view>::value) {
+                return text;
+            }
+            else if constexpr (std::is_same<T, std::string>::value) {
+                return std::string(text);
+            }
+            else if constexpr (std::is_same<T, bool>::value) {
+                return parseBool(text, xpath);
+            }
+            else {
+                static_assert(std::is_arithmetic<T>::value, "tixi::Document::get supports strings, bool and numbers");
+                return parseNumber<T>(text, xpath);
+            }
+        }
+    }
+
+    namespace internal
+    {
+        constexpr bool isNameStartChar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        constexpr bool isNameChar(char c)
+        {
+            return isNameStartChar(c) || (c >= '0' && c <= '9') || c == '-' || c == '.';
+        }
+
+        constexpr std::size_t length(const char* str)
+        {
+            std::size_t size = 0;
+            while (str[size] != '\0') {
+                ++size;
+            }
+            return size;
+        }
+    }
+
+    /**
+     * An XPath expression, which is validated and split into child steps on
+     * construction. If constructed in a constant expression, this happens at
+     * compile time and invalid expressions do not compile:
+     *
+     *     constexpr tixi::XPath path("/cpacs/vehicles/aircraft/model[2]/name");
+     *
+     * Paths consisting of up to maxSteps child steps like "name", "prefix:name"
+     * or "name[2]" are resolved by tixi directly, see ::tixiCheckElementSteps.
+     * All other expressions are evaluated as XPath at runtime.
+     *
+     * The XPath refers to the given string, which must outlive it.
+     */
+    class XPath
+    {
+    public:
+        static constexpr int maxSteps = 32;
+
+        constexpr XPath(const char* xpath)
+            : m_xpath(xpath)
+            , m_length(internal::length(xpath))
+            , m_nSteps(0)
+        {
+            validate();
+            split();
+        }
+
+        XPath(const std::string& xpath)
+            : XPath(xpath.c_str())
+        {
+        }
+
+        constexpr const char* c_str() const noexcept
+        {
+            return m_xpath;
+        }
+
+        std::string str() const
+        {
+            return std::string(m_xpath, m_length);
+        }
+
+        /// Returns true, if the path consists of child steps only
+        constexpr bool isSimple() const noexcept
+        {
+            return m_nSteps > 0;
+        }
+
+        constexpr const TixiPathStep* steps() const noexcept
+        {
+            return m_steps;
+        }
+
+        constexpr int stepCount() const noexcept
+        {
+            return m_nSteps;
+        }
+
+    private:
+        // checks that the expression is not empty and quotes and brackets are balanced
+        constexpr void validate() const
+        {
+            char brackets[64] = {};
+            std::size_t depth = 0;
+            char quote = '\0';
+            for (std::size_t i = 0; i < m_length; ++i) {
+                const char c = m_xpath[i];
+                if (quote != '\0') {
+                    if (c == quote) {
+                        quote = '\0';
+                    }
+                }
+                else if (c == '\'' || c == '"') {
+                    quote = c;
+                }
+                else if (c == '[' || c == '(') {
+                    if (depth == sizeof(brackets)) {
+                        throw TixiError(INVALID_XPATH, "XPath is nested too deeply\nxpath: " + std::string(m_xpath));
+                    }
+                    brackets[depth++] = c == '[' ? ']' : ')';
+                }
+                else if (c == ']' || c == ')') {
+                    if (depth == 0 || brackets[--depth] != c) {
+                        throw TixiError(INVALID_XPATH, "Unbalanced brackets in XPath\nxpath: " + std::string(m_xpath));
+                    }
+                }
+            }
+            if (m_length == 0 || quote != '\0' || depth != 0) {
+                throw TixiError(INVALID_XPATH, "Invalid XPath\nxpath: " + std::string(m_xpath));
+            }
+        }
+
+        // splits absolute paths like "/a/b[2]/p:c" into steps, m_nSteps stays 0 for other expressions
+        constexpr void split()
+        {
+            int nSteps = 0;
+            std::size_t pos = 0;
+            while (pos < m_length) {
+                if (m_xpath[pos] != '/' || nSteps == maxSteps) {
+                    return;
+                }
+                const std::size_t begin = ++pos;
+
+                // name or prefix:name
+                bool hasPrefix = false;
+                if (pos == m_length || !internal::isNameStartChar(m_xpath[pos])) {
+                    return;
+                }
+                while (pos < m_length && (internal::isNameChar(m_xpath[pos]) || m_xpath[pos] == ':')) {
+                    if (m_xpath[pos] == ':') {
+                        if (hasPrefix || pos + 1 == m_length || !internal::isNameStartChar(m_xpath[pos + 1])) {
+                            return;
+                        }
+                        hasPrefix = true;
+                    }
+                    ++pos;
+                }
+
+                TixiPathStep& step = m_steps[nSteps];
+                step.name = m_xpath + begin;
+                step.nameLength = static_cast<int>(pos - begin);
+                step.index = 0;
+
+                // optional index
+                if (pos < m_length && m_xpath[pos] == '[') {
+                    ++pos;
+                    long index = 0;
+                    while (pos < m_length && m_xpath[pos] >= '0' && m_xpath[pos] <= '9' && index <= 100000000) {
+                        index = 10 * index + (m_xpath[pos++] - '0');
+                    }
+                    if (index <= 0 || index > 100000000 || pos == m_length || m_xpath[pos] != ']') {
+                        return;
+                    }
+                    step.index = static_cast<int>(index);
+                    ++pos;
+                }
+                ++nSteps;
+            }
+            m_nSteps = nSteps;
+        }
+
+        const char* m_xpath;
+        std::size_t m_length;
+        TixiPathStep m_steps[maxSteps] = {};
+        int m_nSteps;
+    };
+
+    namespace literals
+    {
+        /// "/a/b[2]"_xpath creates a tixi::XPath
+        constexpr XPath operator""_xpath(const char* xpath, std::size_t)
+        {
+            return XPath(xpath);
+        }
+    }
+
+    /**
+     * A tixi document, which is closed by the destructor. The document can be
+     * moved, but not copied.
+     *
+     * Text is returned as std::string_view of the text stored in the document
+     * and parsed without copying it. The views are valid until the
+     * element or attribute is changed, or the document is closed.
+     *
+     * Element paths are passed as tixi::XPath, simple paths are thus resolved
+     * without evaluating an XPath expression.
+     */
+    class Document
+    {
+    public:
+        Document() noexcept : m_handle(-1) {}
+
+        /// Takes the ownership of an open document
+        explicit Document(TixiDocumentHandle handle) noexcept : m_handle(handle) {}
+
+        Document(Document&& other) noexcept : m_handle(other.release()) {}
+
+        Document& operator=(Document&& other) noexcept
+        {
+            if (this != &other) {
+                close();
+                m_handle = other.release();
+            }
+            return *this;
+        }
+
+        Document(const Document&) = delete;
+        Document& operator=(const Document&) = delete;
+
+        ~Document()
+        {
+            close();
+        }
+
+        static Document create(const std::string& rootElement)
+        {
+            return Document(TixiCreateDocument(rootElement));
+        }
+
+        static Document open(const std::string& filename)
+        {
+            return Document(TixiOpenDocument(filename));
+        }
+
+        static Document openRecursive(const std::string& filename)
+        {
+            return Document(TixiOpenDocumentRecursive(filename));
+        }
+
+        static Document fromString(const std::string& xml)
+        {
+            return Document(TixiImportFromString(xml));
+        }
+
+        TixiDocumentHandle handle() const noexcept
+        {
+            return m_handle;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_handle >= 0;
+        }
+
+        /// Returns the handle, which is not closed by the Document anymore
+        TixiDocumentHandle release() noexcept
+        {
+            return std::exchange(m_handle, -1);
+        }
+
+        void close() noexcept
+        {
+            if (m_handle >= 0) {
+                tixiCloseDocument(m_handle);
+                m_handle = -1;
+            }
+        }
+
+        void save(const std::string& filename) const
+        {
+            TixiSaveDocument(m_handle, filename);
+        }
+
+        std::string exportAsString() const
+        {
+            return TixiExportDocumentAsString(m_handle);
+        }
+
+        bool checkElement(const XPath& xpath) const
+        {
+            ReturnCode ret = SUCCESS;
+            if (xpath.isSimple()) {
+                ret = tixiCheckElementSteps(m_handle, xpath.steps(), xpath.stepCount());
+                if (ret == ELEMENT_PATH_NOT_UNIQUE) {
+                    ret = SUCCESS;
+                }
+            }
+            else {
+                ret = tixiCheckElement(m_handle, xpath.c_str());
+            }
+            if (ret != SUCCESS && ret != ELEMENT_NOT_FOUND) {
+                throw TixiError(ret, "Checking element existence failed\nxpath: " + xpath.str());
+            }
+            return ret == SUCCESS;
+        }
+
+        bool checkAttribute(const XPath& xpath, internal::CString attribute) const
+        {
+            const ReturnCode ret = tixiCheckAttribute(m_handle, xpath.c_str(), attribute.str);
+            if (ret != SUCCESS && ret != ATTRIBUTE_NOT_FOUND) {
+                throw TixiError(ret,
+                    "Checking attribute existence failed\n"
+                    "xpath: " + xpath.str() + "\n"
+                    "attribute: " + std::string(attribute.str)
+                );
+            }
+            return ret == SUCCESS;
+        }
+
+        /// Returns the text of an element without copying it
+        std::string_view getText(const XPath& xpath) const
+        {
+            char* text = NULL;
+            const ReturnCode ret = xpath.isSimple()
+                ? tixiGetTextElementViewSteps(m_handle, xpath.steps(), xpath.stepCount(), &text)
+                : tixiGetTextElementView(m_handle, xpath.c_str(), &text);
+            if (ret != SUCCESS) {
+                throw TixiError(ret, "Error getting element value\nxpath: " + xpath.str());
+            }
+            return text;
+        }
+
+        /// Returns the value of an attribute without copying it
+        std::string_view getTextAttribute(const XPath& xpath, internal::CString attribute) const
+        {
+            char* text = NULL;
+            const ReturnCode ret = xpath.isSimple()
+                ? tixiGetTextAttributeViewSteps(m_handle, xpath.steps(), xpath.stepCount(), attribute.str, &text)
+                : tixiGetTextAttributeView(m_handle, xpath.c_str(), attribute.str, &text);
+            if (ret != SUCCESS) {
+                throw TixiError(ret,
+                    "Error getting attribute value\n"
+                    "xpath: " + xpath.str() + "\n"
+                    "attribute: " + std::string(attribute.str)
+                );
+            }
+            return text;
+        }
+
+        /// Returns the text of an element as std::string_view, std::string, bool or number
+        template <typename T>
+        T get(const XPath& xpath) const
+        {
+            return internal::convertText<T>(getText(xpath), xpath.c_str());
+        }
+
+        /// Returns the value of an attribute as std::string_view, std::string, bool or number
+        template <typename T>
+        T getAttribute(const XPath& xpath, internal::CString attribute) const
+        {
+            return internal::convertText<T>(getTextAttribute(xpath, attribute), xpath.c_str());
+        }
+
+        /// Returns the values of a vector, the memory is owned by the document and valid until it is closed
+        span<const double> getFloatVector(const XPath& xpath) const
+        {
+            int size = 0;
+            double* values = NULL;
+            ReturnCode ret = tixiGetVectorSize(m_handle, xpath.c_str(), &size);
+            if (ret == SUCCESS && size > 0) {
+                ret = tixiGetFloatVector(m_handle, xpath.c_str(), &values, size);
+            }
+            if (ret != SUCCESS) {
+                throw TixiError(ret, "Error getting vector\nxpath: " + xpath.str());
+            }
+            return span<const double>(values, static_cast<std::size_t>(size));
+        }
+
+        template <typename T>
+        void saveElement(const std::string& xpath, const T& value)
+        {
+            TixiSaveElement(m_handle, xpath, value);
+        }
+
+        template <typename T>
+        void saveAttribute(const std::string& xpath, const std::string& attribute, const T& value)
+        {
+            TixiSaveAttribute(m_handle, xpath, attribute, value);
+        }
+
+        void createElementsIfNotExists(const std::string& xpath)
+        {
+            TixiCreateElementsIfNotExists(m_handle, xpath);
+        }
+
+        void removeElement(const std::string& xpath)
+        {
+            TixiRemoveElement(m_handle, xpath);
+        }
+
+    private:
+        TixiDocumentHandle m_handle;
+    };
+
+#endif // TIXICPP_HAS_DOCUMENT
 }
@@ -93,7 +93,17 @@ end subroutine
 !end function
 '''
 
-blacklist = ['tixiGetPrintMsgFunc','tixiSetPrintMsgFunc','tixiGetVersion','tixiGetArrayElementNames']
+blacklist = ['tixiGetPrintMsgFunc','tixiSetPrintMsgFunc','tixiGetVersion','tixiGetArrayElementNames','tixiGetChildNodeList','tixiGetChildNodeList_c',
+             'tixiXPathEvaluateAll','tixiXPathEvaluateAll_c',
+             'tixiXSLTransformationToDocumentWithParams','tixiXSLTransformationToDocumentWithParams_c',
+             'tixiStylesheetTransformDocuments','tixiStylesheetTransformDocuments_c',
+             'tixiStylesheetTransformFiles','tixiStylesheetTransformFiles_c',
+             'tixiCheckElementSteps','tixiCheckElementSteps_c',
+             'tixiGetTextElementViewSteps','tixiGetTextElementViewSteps_c',
+             'tixiGetTextAttributeViewSteps','tixiGetTextAttributeViewSteps_c',
+             'tixiGetStatistics','tixiGetStatistics_c',
+             'tixiGetXPathProfile','tixiGetXPathProfile_c',
+             'tixiGetDocumentStatistics','tixiGetDocumentStatistics_c']
 
 if __name__ == '__main__':
     # parse the file  
@@ -0,0 +1,199 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/* Handwritten MEX functions, that read a whole vector, array or point list
+ * in a single call. The returned matrices are allocated first and filled
+ * in place by tixi, instead of converting the values of each element.
+ *
+ * This file is included by the generated tiximatlab.c after the error
+ * handler and is not intended to be compiled directly.
+ */
+
+/*
+ * Copies an array of tixi (the last dimension changes fastest) into a
+ * matlab array (the first dimension changes fastest) of the same dimensions
+ */
+static void rowToColumnMajor(const double* src, double* dst, const int* sizes, int nDims, int size)
+{
+    mwSize* strides = (mwSize*) mxMalloc(sizeof(mwSize) * nDims);
+    int* position = (int*) mxCalloc(nDims, sizeof(int));
+    mwSize offset = 0;
+    int i, dim;
+
+    strides[0] = 1;
+    for (dim = 1; dim < nDims; ++dim) {
+        strides[dim] = strides[dim-1] * sizes[dim-1];
+    }
+
+    for (i = 0; i < size; ++i) {
+        dst[offset] = src[i];
+
+        /* advance to the next position, starting at the last dimension */
+        for (dim = nDims - 1; dim >= 0; --dim) {
+            position[dim]++;
+            offset += strides[dim];
+            if (position[dim] < sizes[dim]) {
+                break;
+            }
+            offset -= position[dim] * strides[dim];
+            position[dim] = 0;
+        }
+    }
+
+    mxFree(position);
+    mxFree(strides);
+}
+
+/* values = tixiReadVector(handle, vectorPath) */
+void mex_tixiReadVector(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    TixiDocumentHandle handle;
+    char* vectorPath = NULL;
+    int nValues = 0;
+    ReturnCode ret;
+
+    if (nrhs != 3) {
+        mexErrMsgTxt("tixiReadVector(handle, vectorPath): Wrong number of arguments\n");
+    }
+    if (nlhs != 1) {
+        mexErrMsgTxt("tixiReadVector(handle, vectorPath): Wrong number of output values. This function returns 1 value(s)\n");
+    }
+
+    if (!isscalar(prhs[1])) {
+        mexErrMsgTxt("Argument 'handle' must not be an array.\n");
+    }
+
+    if (!mxIsChar(prhs[2])) {
+        mexErrMsgTxt("Argument 'vectorPath' must be a string.\n");
+    }
+
+    handle = mxToInt(prhs[1]);
+    mxToString(prhs[2], &vectorPath);
+
+    ret = tixiGetVectorSize(handle, vectorPath, &nValues);
+    handleError("tixiGetVectorSize", ret);
+
+    plhs[0] = mxCreateDoubleMatrix(1, nValues, mxREAL);
+    ret = tixiGetFloatVectorValues(handle, vectorPath, mxGetPr(plhs[0]), nValues);
+    handleError("tixiGetFloatVectorValues", ret);
+}
+
+/* points = tixiReadPointList(handle, pointsPath), one point per row */
+void mex_tixiReadPointList(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    TixiDocumentHandle handle;
+    char* pointsPath = NULL;
+    int nPoints = 0;
+    double* points = NULL;
+    ReturnCode ret;
+
+    if (nrhs != 3) {
+        mexErrMsgTxt("tixiReadPointList(handle, pointsPath): Wrong number of arguments\n");
+    }
+    if (nlhs != 1) {
+        mexErrMsgTxt("tixiReadPointList(handle, pointsPath): Wrong number of output values. This function returns 1 value(s)\n");
+    }
+
+    if (!isscalar(prhs[1])) {
+        mexErrMsgTxt("Argument 'handle' must not be an array.\n");
+    }
+
+    if (!mxIsChar(prhs[2])) {
+        mexErrMsgTxt("Argument 'pointsPath' must be a string.\n");
+    }
+
+    handle = mxToInt(prhs[1]);
+    mxToString(prhs[2], &pointsPath);
+
+    ret = tixiXPathEvaluateNodeNumber(handle, pointsPath, &nPoints);
+    handleError("tixiXPathEvaluateNodeNumber", ret);
+
+    /* the columns of the matrix are the x, y and z coordinates, missing ones remain zero */
+    plhs[0] = mxCreateDoubleMatrix(nPoints, 3, mxREAL);
+    points = mxGetPr(plhs[0]);
+    ret = tixiGetPointList(handle, pointsPath, points, points + nPoints, points + 2*nPoints, nPoints);
+    handleError("tixiGetPointList", ret);
+}
+
+/* values = tixiReadArray(handle, arrayPath, elementName), one matlab dimension per array dimension */
+void mex_tixiReadArray(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    TixiDocumentHandle handle;
+    char* arrayPath = NULL;
+    char* elementName = NULL;
+    int nDims = 0;
+    int size = 0;
+    int* sizes = NULL;
+    double* values = NULL;
+    mwSize* dims = NULL;
+    int dim;
+    ReturnCode ret;
+
+    if (nrhs != 4) {
+        mexErrMsgTxt("tixiReadArray(handle, arrayPath, elementName): Wrong number of arguments\n");
+    }
+    if (nlhs != 1) {
+        mexErrMsgTxt("tixiReadArray(handle, arrayPath, elementName): Wrong number of output values. This function returns 1 value(s)\n");
+    }
+
+    if (!isscalar(prhs[1])) {
+        mexErrMsgTxt("Argument 'handle' must not be an array.\n");
+    }
+
+    if (!mxIsChar(prhs[2])) {
+        mexErrMsgTxt("Argument 'arrayPath' must be a string.\n");
+    }
+
+    if (!mxIsChar(prhs[3])) {
+        mexErrMsgTxt("Argument 'elementName' must be a string.\n");
+    }
+
+    handle = mxToInt(prhs[1]);
+    mxToString(prhs[2], &arrayPath);
+    mxToString(prhs[3], &elementName);
+
+    ret = tixiGetArrayDimensions(handle, arrayPath, &nDims);
+    handleError("tixiGetArrayDimensions", ret);
+    if (nDims < 1) {
+        mexErrMsgTxt("tixiReadArray: The array has no dimensions.\n");
+    }
+
+    sizes = (int*) mxMalloc(sizeof(int) * nDims);
+    ret = tixiGetArrayDimensionSizes(handle, arrayPath, sizes, &size);
+    handleError("tixiGetArrayDimensionSizes", ret);
+
+    ret = tixiGetArray(handle, arrayPath, elementName, size, &values);
+    handleError("tixiGetArray", ret);
+
+    /* matlab arrays have at least two dimensions, a single dimension is returned as row vector */
+    if (nDims == 1) {
+        plhs[0] = mxCreateDoubleMatrix(1, size, mxREAL);
+        memcpy(mxGetPr(plhs[0]), values, sizeof(double) * size);
+    }
+    else {
+        dims = (mwSize*) mxMalloc(sizeof(mwSize) * nDims);
+        for (dim = 0; dim < nDims; ++dim) {
+            dims[dim] = sizes[dim];
+        }
+        plhs[0] = mxCreateNumericArray(nDims, dims, mxDOUBLE_CLASS, mxREAL);
+        rowToColumnMajor(values, mxGetPr(plhs[0]), sizes, nDims, size);
+        mxFree(dims);
+    }
+
+    mxFree(sizes);
+}
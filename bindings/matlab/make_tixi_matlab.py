@@ -15,7 +15,10 @@ import bindings_generator.matlab_generator as MG
 import bindings_generator.cheader_parser   as CP
 
 
-blacklist = ['tixiGetRawInterface', 'tixiAddDoubleListWithAttributes', 'tixiSetPrintMsgFunc']
+blacklist = ['tixiGetRawInterface', 'tixiAddDoubleListWithAttributes', 'tixiSetPrintMsgFunc', 'tixiXPathEvaluateAll', 'tixiXSLTransformationToDocumentWithParams',
+             'tixiStylesheetTransformDocuments', 'tixiStylesheetTransformFiles', 'tixiCheckElementSteps',
+             'tixiGetTextElementViewSteps', 'tixiGetTextAttributeViewSteps', 'tixiGetStatistics', 'tixiGetXPathProfile',
+             'tixiGetDocumentStatistics']
 
 if __name__ == '__main__':
     # parse the file
@@ -39,6 +42,8 @@ if __name__ == '__main__':
     # create the wrapper
     generator = MG.MatlabGenerator(parser, 'tixi3', 'tixi.h')
     generator.blacklist = blacklist
+    generator.extra_includes  = ['bulk.h']
+    generator.extra_functions = ['tixiReadVector', 'tixiReadArray', 'tixiReadPointList']
     generator.create_wrapper()
     
     
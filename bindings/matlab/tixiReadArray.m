@@ -0,0 +1,24 @@
+function values = tixiReadArray(handle, arrayPath, elementName)
+    % Reads an array with one matlab dimension per array dimension in a
+    % single call, i.e. values(i, j, k) is the value at the positions i, j
+    % and k of the dimensions as returned by tixiGetArrayDimensionValues.
+    % An array with a single dimension is returned as row vector.
+
+    if (ischar(handle))
+        error('Invalid type of argument "handle"');
+    end
+
+    if not(ischar(arrayPath))
+        error('Invalid type of argument "arrayPath"');
+    end
+
+    if not(ischar(elementName))
+        error('Invalid type of argument "elementName"');
+    end
+
+    try
+        values = tixi3_matlab('tixiReadArray', handle, arrayPath, elementName);
+    catch err
+        error(err.message)
+    end
+end
@@ -0,0 +1,18 @@
+function points = tixiReadPointList(handle, pointsPath)
+    % Reads the x, y and z coordinates of all points matching pointsPath as
+    % n x 3 matrix in a single call. Missing coordinates are zero.
+
+    if (ischar(handle))
+        error('Invalid type of argument "handle"');
+    end
+
+    if not(ischar(pointsPath))
+        error('Invalid type of argument "pointsPath"');
+    end
+
+    try
+        points = tixi3_matlab('tixiReadPointList', handle, pointsPath);
+    catch err
+        error(err.message)
+    end
+end
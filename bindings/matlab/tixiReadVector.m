@@ -0,0 +1,17 @@
+function values = tixiReadVector(handle, vectorPath)
+    % Reads all values of a vector as row vector in a single call
+
+    if (ischar(handle))
+        error('Invalid type of argument "handle"');
+    end
+
+    if not(ischar(vectorPath))
+        error('Invalid type of argument "vectorPath"');
+    end
+
+    try
+        values = tixi3_matlab('tixiReadVector', handle, vectorPath);
+    catch err
+        error(err.message)
+    end
+end
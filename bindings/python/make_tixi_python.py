@@ -12,6 +12,7 @@ from datetime import date
 tixipath = os.path.dirname(os.path.realpath(__file__)) + '/../..'
 sys.path.append(tixipath + '/bindings')
 import bindings_generator.python_generator as PG
+import bindings_generator.python_extension_generator as PEG
 import bindings_generator.cheader_parser   as CP
 
 apache = \
@@ -107,7 +108,10 @@ postconstr = '''
 self.version = self.getVersion()
 '''
 
-blacklist = ['tixiCheckElement', 'tixiUIDCheckExists', 'tixiCheckAttribute', 'tixiCloseDocument', 'tixiGetRawInterface', 'tixiSetPrintMsgFunc']
+blacklist = ['tixiCheckElement', 'tixiUIDCheckExists', 'tixiCheckAttribute', 'tixiCloseDocument', 'tixiGetRawInterface', 'tixiSetPrintMsgFunc', 'tixiXPathEvaluateAll', 'tixiXSLTransformationToDocument', 'tixiXSLTransformationToDocumentWithParams',
+             'tixiStylesheetTransformDocuments', 'tixiCheckElementSteps', 'tixiGetTextElementViewSteps',
+             'tixiGetTextAttributeViewSteps', 'tixiGetStatistics', 'tixiGetXPathProfile',
+             'tixiGetDocumentStatistics']
 
 if __name__ == '__main__':
     # parse the file
@@ -132,6 +136,17 @@ if __name__ == '__main__':
     pg.add_alias('tixiOpenDocumentFromHTTP', 'openHttp')
     pg.add_alias('tixiCreateDocument', 'create')
     pg.add_alias('tixiImportFromString', 'openString')
+
+    # the optional compiled extension provides a fast call path, which releases the GIL
+    peg = PEG.PythonExtensionGenerator(name_prefix = 'tixi', libname = 'tixi3')
+    peg.license = '/*\n' + ''.join((' * ' + line.lstrip('#').strip()).rstrip() + '\n'
+                                    for line in apache.splitlines() if not line.startswith('##')) + ' */\n\n'
+    peg.header = 'tixi.h'
+    peg.blacklist = blacklist
+    # the global settings and the document list are not changed while other python threads run
+    peg.keep_gil = ['tixiCleanup', 'tixiCloseAllDocuments', 'tixiSetHTTPCacheDirectory', 'tixiSetHTTPCacheLimits']
+    pg.native_module = peg.modulename
+    pg.native_functions = peg.supported_functions(parser)
     
     print('Creating python interface... ', end=' ')
     wrapper = pg.create_wrapper(parser)
@@ -143,5 +158,13 @@ if __name__ == '__main__':
     fop = open(filename, 'w')
     fop.write(wrapper)
     print('done')
+
+    # the source of the extension is only written if its file name is given
+    if len(sys.argv) > 1:
+        filename = sys.argv[1]
+        print('Write tixi python extension to file "%s" ... ' % filename, end=' ')
+        fop = open(filename, 'w')
+        fop.write(peg.create_extension(parser))
+        print('done')
     
     
@@ -21,8 +21,16 @@
 #############################################################################
 
 import os
+import threading
+import timeit
 import unittest
-from tixiwrapper import Tixi, TixiException, StorageMode
+import tixi3wrapper
+from tixi3wrapper import Tixi3 as Tixi, Tixi3Exception as TixiException, StorageMode
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
 
 class Tests(unittest.TestCase):
     ''' Test almost all TIXI functions to ensure correct generated code '''
@@ -209,5 +217,115 @@ class Tests(unittest.TestCase):
         t.close()
         t.cleanup()
         
+
+@unittest.skipIf(numpy is None, "numpy is not installed")
+class NumpyTests(unittest.TestCase):
+    ''' Checks passing numpy arrays to and from the wrapper '''
+
+    def test_add_vector(self):
+        t = Tixi()
+        t.create('doc')
+        t.addFloatVector('/doc', 'myvec', numpy.arange(100., 130.), 30, "%g")
+        # non contiguous arrays of another type are converted
+        t.addFloatVector('/doc', 'strided', numpy.arange(60, dtype=numpy.int32)[::2], 30, "%g")
+        self.assertEqual(t.getFloatVector('/doc/myvec', 30), tuple(range(100, 130)))
+        self.assertEqual(t.getFloatVector('/doc/strided', 30), tuple(range(0, 60, 2)))
+        t.close()
+
+    def test_get_vector(self):
+        t = Tixi()
+        t.numpyArrays = True
+        t.create('doc')
+        t.addFloatVector('/doc', 'myvec', range(100, 130), 30, "%g")
+        v = t.getFloatVector('/doc/myvec', 30)
+        t.close()
+        # the values are copied and remain valid after closing the document
+        self.assertTrue(isinstance(v, numpy.ndarray))
+        self.assertEqual(v.dtype, numpy.float64)
+        self.assertTrue(numpy.array_equal(v, numpy.arange(100., 130.)))
+
+    def test_get_array(self):
+        t = Tixi()
+        t.numpyArrays = True
+        t.open(os.path.join("TestData", "arraytests.xml"))
+        sizes, count = t.getArrayDimensionSizes("/root/aeroPerformanceMap", 4)
+        self.assertTrue(numpy.array_equal(sizes, [1, 2, 3, 8]))
+        self.assertEqual(count, 48)
+        t.close()
+
+
+@unittest.skipIf(tixi3wrapper._native is None, "the python extension is not built")
+class NativeTests(unittest.TestCase):
+    ''' Checks the compiled extension, which releases the GIL during calls '''
+
+    def test_errors(self):
+        t = Tixi()
+        t.openString('<root><x>1.5</x></root>')
+        self.assertEqual(t.getDoubleElement('/root/x'), 1.5)
+        with self.assertRaises(TixiException) as context:
+            t.getDoubleElement('/root/y')
+        self.assertEqual(context.exception.error, 'ELEMENT_NOT_FOUND')
+        self.assertEqual(context.exception.args, (('tixiGetDoubleElement', '/root/y'), {}))
+        self.assertRaises(TypeError, t.getDoubleElement, 1)
+        t.close()
+
+    def test_threads(self):
+        ''' Opens and validates documents in parallel threads '''
+        errors = []
+        def validate():
+            try:
+                for i in range(5):
+                    t = Tixi()
+                    t.open(os.path.join("TestData", "valid_CPACS_dokumentiert.xml"))
+                    t.schemaValidateFromFile(os.path.join("TestData", "valid_cpacs_schema.xsd"))
+                    t.close()
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=validate) for i in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(errors, [])
+
+
+class Benchmarks(unittest.TestCase):
+    ''' Compares passing large vectors as tuples and as numpy arrays and the call overhead of ctypes '''
+
+    size = 1000000
+
+    def run_benchmark(self, name, values, numpyArrays):
+        t = Tixi()
+        t.numpyArrays = numpyArrays
+        t.create('doc')
+        add = timeit.timeit(lambda: t.addFloatVector('/doc', 'vec', values, self.size, "%g"), number=1)
+        get = timeit.timeit(lambda: t.getFloatVector('/doc/vec', self.size), number=3) / 3
+        t.close()
+        print("\n%-6s add: %.3f s, get: %.3f s" % (name, add, get))
+
+    @unittest.skipIf(numpy is None, "numpy is not installed")
+    def test_vector_tuple(self):
+        self.run_benchmark("tuple", tuple(float(i) for i in range(self.size)), False)
+
+    @unittest.skipIf(numpy is None, "numpy is not installed")
+    def test_vector_numpy(self):
+        self.run_benchmark("numpy", numpy.arange(float(self.size)), True)
+
+    @unittest.skipIf(tixi3wrapper._native is None, "the python extension is not built")
+    def test_call_overhead(self):
+        t = Tixi()
+        t.openString('<root><x>1.5</x></root>')
+        calls = 100000
+        native = timeit.timeit(lambda: t.getDoubleElement('/root/x'), number=calls) / calls
+        extension, tixi3wrapper._native = tixi3wrapper._native, None
+        try:
+            ctypes = timeit.timeit(lambda: t.getDoubleElement('/root/x'), number=calls) / calls
+        finally:
+            tixi3wrapper._native = extension
+        t.close()
+        print("\ngetDoubleElement extension: %.2f us, ctypes: %.2f us" % (native * 1e6, ctypes * 1e6))
+
+
 if __name__ == '__main__':
     unittest.main()
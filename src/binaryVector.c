@@ -0,0 +1,625 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "binaryVector.h"
+#include "tixiUtils.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+extern void printMsg(MessageType type, const char* message, ...);
+
+#define BINARY_MAGIC "TIXIBIN"
+#define BINARY_VERSION 1
+#define BINARY_HEADER_SIZE 16
+
+typedef struct BinaryMapping BinaryMapping;
+struct BinaryMapping
+{
+  void* address;
+  size_t length;
+  BinaryMapping* next;
+};
+
+struct BinaryVectorStore
+{
+  int threshold;          /**< minimum number of values of binary vectors, 0 if disabled */
+  char* directory;        /**< directory of the sidecar file after saving, NULL to use the document directory */
+  double** buffers;       /**< vectors not yet saved, indexed by the binaryBuffer attribute */
+  int* bufferSizes;
+  int nBuffers;
+  int capacity;
+  BinaryMapping* mappings; /**< mapped views of sidecar files, unmapped on closing */
+};
+
+static BinaryVectorStore* getStore(TixiDocument* document)
+{
+  if (!document->binaryVectors) {
+    document->binaryVectors = (BinaryVectorStore*) calloc(1, sizeof(BinaryVectorStore));
+  }
+  return document->binaryVectors;
+}
+
+static int isLittleEndian(void)
+{
+  const uint16_t one = 1;
+  return *(const unsigned char*) &one == 1;
+}
+
+static void swapBytes(double* values, size_t nValues)
+{
+  size_t i;
+  for (i = 0; i < nValues; ++i) {
+    unsigned char* bytes = (unsigned char*) (values + i);
+    int j;
+    for (j = 0; j < 4; ++j) {
+      unsigned char tmp = bytes[j];
+      bytes[j] = bytes[7 - j];
+      bytes[7 - j] = tmp;
+    }
+  }
+}
+
+static int getIntAttribute(xmlNodePtr element, const char* name, long long* value)
+{
+  xmlChar* text = xmlGetProp(element, (const xmlChar*) name);
+  char* end = NULL;
+  int result = 0;
+
+  if (!text) {
+    return 0;
+  }
+  *value = strtoll((const char*) text, &end, 10);
+  result = end != (char*) text && *end == '\0' && *value >= 0;
+  xmlFree(text);
+  return result;
+}
+
+static void setIntAttribute(xmlNodePtr element, const char* name, long long value)
+{
+  char text[32];
+  snprintf(text, sizeof(text), "%lld", value);
+  xmlSetProp(element, (const xmlChar*) name, (const xmlChar*) text);
+}
+
+static long long fileSize(const char* filename)
+{
+#ifdef _WIN32
+  struct _stat64 info;
+  if (_stat64(filename, &info) != 0) {
+    return -1;
+  }
+#else
+  struct stat info;
+  if (stat(filename, &info) != 0) {
+    return -1;
+  }
+#endif
+  return (long long) info.st_size;
+}
+
+static char* getSidecarPath(TixiDocument* document, const char* filename)
+{
+  const char* directory = document->binaryVectors && document->binaryVectors->directory
+                        ? document->binaryVectors->directory
+                        : document->dirname;
+
+  if (!directory || filename[0] == '/' || filename[0] == '\\' || (filename[0] && filename[1] == ':')) {
+    return buildString("%s", filename);
+  }
+  return buildString("%s%s", directory, filename);
+}
+
+static ReturnCode checkSidecarFile(const char* filename, long long offset, int nValues)
+{
+  unsigned char header[BINARY_HEADER_SIZE];
+  FILE* file = fopen(filename, "rb");
+  long long size = fileSize(filename);
+  uint32_t version = 0;
+
+  if (!file) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Cannot open binary vector file \"%s\".\n", filename);
+    return OPEN_FAILED;
+  }
+  if (fread(header, 1, BINARY_HEADER_SIZE, file) != BINARY_HEADER_SIZE || memcmp(header, BINARY_MAGIC, 8) != 0) {
+    fclose(file);
+    printMsg(MESSAGETYPE_ERROR, "Error: \"%s\" is not a binary vector file.\n", filename);
+    return FAILED;
+  }
+  fclose(file);
+
+  version = header[8] | (header[9] << 8) | (header[10] << 16) | ((uint32_t) header[11] << 24);
+  if (version != BINARY_VERSION) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Unsupported version %u of binary vector file \"%s\".\n", version, filename);
+    return FAILED;
+  }
+  if (offset < BINARY_HEADER_SIZE || offset % sizeof(double) != 0 ||
+      offset + (long long) nValues * (long long) sizeof(double) > size) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Binary vector at offset %lld exceeds the file \"%s\".\n", offset, filename);
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+/* Maps the values copy on write, such that modifications of the caller never
+ * reach the file. Returns NULL, if the file cannot be mapped. */
+static BinaryMapping* mapValues(const char* filename, long long offset, int nValues, double** values)
+{
+  BinaryMapping* mapping = NULL;
+  long long start = 0;
+  size_t length = 0;
+  void* address = NULL;
+
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  HANDLE file = INVALID_HANDLE_VALUE;
+  HANDLE fileMapping = NULL;
+
+  GetSystemInfo(&info);
+  start = offset - offset % info.dwAllocationGranularity;
+  length = (size_t) (offset - start) + (size_t) nValues * sizeof(double);
+
+  file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                     FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return NULL;
+  }
+  fileMapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  if (fileMapping) {
+    address = MapViewOfFile(fileMapping, FILE_MAP_COPY, (DWORD) (start >> 32), (DWORD) (start & 0xffffffff), length);
+    CloseHandle(fileMapping);
+  }
+  CloseHandle(file);
+  if (!address) {
+    return NULL;
+  }
+#else
+  long pageSize = sysconf(_SC_PAGESIZE);
+  int file = -1;
+
+  start = offset - offset % pageSize;
+  length = (size_t) (offset - start) + (size_t) nValues * sizeof(double);
+
+  file = open(filename, O_RDONLY);
+  if (file < 0) {
+    return NULL;
+  }
+  address = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, (off_t) start);
+  close(file);
+  if (address == MAP_FAILED) {
+    return NULL;
+  }
+#endif
+
+  mapping = (BinaryMapping*) malloc(sizeof(BinaryMapping));
+  mapping->address = address;
+  mapping->length = length;
+  mapping->next = NULL;
+  *values = (double*) ((char*) address + (offset - start));
+  return mapping;
+}
+
+static void unmapValues(BinaryMapping* mapping)
+{
+#ifdef _WIN32
+  UnmapViewOfFile(mapping->address);
+#else
+  munmap(mapping->address, mapping->length);
+#endif
+  free(mapping);
+}
+
+/* Reads the values of a sidecar file into memory, e.g. on big endian machines */
+static double* readValues(const char* filename, long long offset, int nValues)
+{
+  FILE* file = fopen(filename, "rb");
+  double* values = NULL;
+  int ok = 0;
+
+  if (!file) {
+    return NULL;
+  }
+  values = (double*) malloc(nValues > 0 ? nValues * sizeof(double) : 1);
+#ifdef _WIN32
+  ok = _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+  ok = fseeko(file, (off_t) offset, SEEK_SET) == 0;
+#endif
+  ok = ok && fread(values, sizeof(double), (size_t) nValues, file) == (size_t) nValues;
+  fclose(file);
+  if (!ok) {
+    free(values);
+    return NULL;
+  }
+  if (!isLittleEndian()) {
+    swapBytes(values, (size_t) nValues);
+  }
+  return values;
+}
+
+/* Returns the values of an element either from the buffer of an unsaved
+ * vector or from the sidecar file. If mapping is not NULL after the call,
+ * the values are mapped from the file, otherwise they are owned by the
+ * store (unsaved vector) or have to be freed (copied from the file). */
+static ReturnCode getValues(TixiDocument* document, xmlNodePtr element, double** values, int* nValues,
+                            BinaryMapping** mapping, int* isBuffer)
+{
+  long long size = 0;
+  long long index = 0;
+  long long offset = 0;
+  xmlChar* filename = NULL;
+  char* path = NULL;
+  ReturnCode error = SUCCESS;
+
+  *mapping = NULL;
+  *isBuffer = 0;
+  if (!getIntAttribute(element, BINARY_SIZE_ATTRIBUTE, &size) || size > INT32_MAX) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid attribute " BINARY_SIZE_ATTRIBUTE " of binary vector.\n");
+    return FAILED;
+  }
+  *nValues = (int) size;
+
+  if (getIntAttribute(element, BINARY_BUFFER_ATTRIBUTE, &index)) {
+    BinaryVectorStore* store = document->binaryVectors;
+    if (!store || index >= store->nBuffers || !store->buffers[index] || store->bufferSizes[index] != *nValues) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Binary vector buffer %lld does not exist in this document.\n", index);
+      return FAILED;
+    }
+    *values = store->buffers[index];
+    *isBuffer = 1;
+    return SUCCESS;
+  }
+
+  filename = xmlGetProp(element, (const xmlChar*) BINARY_FILE_ATTRIBUTE);
+  if (!filename || !getIntAttribute(element, BINARY_OFFSET_ATTRIBUTE, &offset)) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Binary vector without valid attributes " BINARY_FILE_ATTRIBUTE
+                                " and " BINARY_OFFSET_ATTRIBUTE ".\n");
+    xmlFree(filename);
+    return FAILED;
+  }
+  path = getSidecarPath(document, (const char*) filename);
+  xmlFree(filename);
+
+  error = checkSidecarFile(path, offset, *nValues);
+  if (error == SUCCESS) {
+    if (*nValues > 0 && isLittleEndian()) {
+      *mapping = mapValues(path, offset, *nValues, values);
+    }
+    if (!*mapping) {
+      *values = readValues(path, offset, *nValues);
+      if (!*values) {
+        printMsg(MESSAGETYPE_ERROR, "Error: Cannot read binary vector from \"%s\".\n", path);
+        error = FAILED;
+      }
+    }
+  }
+  free(path);
+  return error;
+}
+
+ReturnCode binaryVectorSetThreshold(TixiDocument* document, int minElements)
+{
+  if (minElements < 0) {
+    return FAILED;
+  }
+  getStore(document)->threshold = minElements;
+  return SUCCESS;
+}
+
+int binaryVectorUse(const TixiDocument* document, int nElements)
+{
+  return document->binaryVectors && document->binaryVectors->threshold > 0 &&
+         nElements >= document->binaryVectors->threshold;
+}
+
+int binaryVectorIsBinary(xmlNodePtr element)
+{
+  return element && element->type == XML_ELEMENT_NODE &&
+         xmlHasProp(element, (const xmlChar*) BINARY_SIZE_ATTRIBUTE) != NULL;
+}
+
+ReturnCode binaryVectorStore(TixiDocument* document, xmlNodePtr element, const double* values, int nValues)
+{
+  BinaryVectorStore* store = getStore(document);
+  long long index = 0;
+  double* buffer = NULL;
+
+  if (nValues < 0) {
+    return FAILED;
+  }
+
+  /* an updated vector replaces the old buffer */
+  if (getIntAttribute(element, BINARY_BUFFER_ATTRIBUTE, &index) && index < store->nBuffers) {
+    free(store->buffers[index]);
+    store->buffers[index] = NULL;
+  }
+
+  if (store->nBuffers == store->capacity) {
+    store->capacity = store->capacity > 0 ? 2 * store->capacity : 16;
+    store->buffers = (double**) realloc(store->buffers, store->capacity * sizeof(double*));
+    store->bufferSizes = (int*) realloc(store->bufferSizes, store->capacity * sizeof(int));
+  }
+  buffer = (double*) malloc(nValues > 0 ? nValues * sizeof(double) : 1);
+  if (nValues > 0) {
+    memcpy(buffer, values, nValues * sizeof(double));
+  }
+  store->buffers[store->nBuffers] = buffer;
+  store->bufferSizes[store->nBuffers] = nValues;
+
+  xmlNodeSetContent(element, NULL);
+  binaryVectorRemove(element);
+  setIntAttribute(element, BINARY_SIZE_ATTRIBUTE, nValues);
+  setIntAttribute(element, BINARY_BUFFER_ATTRIBUTE, store->nBuffers);
+  store->nBuffers++;
+
+  clearDocumentCaches(document);
+  return SUCCESS;
+}
+
+void binaryVectorRemove(xmlNodePtr element)
+{
+  xmlUnsetProp(element, (const xmlChar*) BINARY_SIZE_ATTRIBUTE);
+  xmlUnsetProp(element, (const xmlChar*) BINARY_FILE_ATTRIBUTE);
+  xmlUnsetProp(element, (const xmlChar*) BINARY_OFFSET_ATTRIBUTE);
+  xmlUnsetProp(element, (const xmlChar*) BINARY_BUFFER_ATTRIBUTE);
+}
+
+ReturnCode binaryVectorSize(xmlNodePtr element, int* nValues)
+{
+  long long size = 0;
+  if (!getIntAttribute(element, BINARY_SIZE_ATTRIBUTE, &size) || size > INT32_MAX) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid attribute " BINARY_SIZE_ATTRIBUTE " of binary vector.\n");
+    return FAILED;
+  }
+  *nValues = (int) size;
+  return SUCCESS;
+}
+
+ReturnCode binaryVectorRead(TixiDocument* document, xmlNodePtr element, double** values, int* nValues)
+{
+  BinaryMapping* mapping = NULL;
+  double* source = NULL;
+  int isBuffer = 0;
+  ReturnCode error = getValues(document, element, &source, nValues, &mapping, &isBuffer);
+
+  if (error != SUCCESS) {
+    return error;
+  }
+
+  if (mapping) {
+    BinaryVectorStore* store = getStore(document);
+    mapping->next = store->mappings;
+    store->mappings = mapping;
+    *values = source;
+  }
+  else if (isBuffer) {
+    /* the caller must not modify the stored vector */
+    *values = (double*) malloc(*nValues > 0 ? *nValues * sizeof(double) : 1);
+    if (*nValues > 0) {
+      memcpy(*values, source, *nValues * sizeof(double));
+    }
+    addToMemoryList(document, *values);
+  }
+  else {
+    *values = source;
+    addToMemoryList(document, *values);
+  }
+  return SUCCESS;
+}
+
+ReturnCode binaryVectorCopy(TixiDocument* document, xmlNodePtr element, double* values, int maxValues, int* nValues)
+{
+  BinaryMapping* mapping = NULL;
+  double* source = NULL;
+  int isBuffer = 0;
+  int count = 0;
+  ReturnCode error = getValues(document, element, &source, nValues, &mapping, &isBuffer);
+
+  if (error != SUCCESS) {
+    return error;
+  }
+
+  count = *nValues < maxValues ? *nValues : maxValues;
+  if (count > 0) {
+    memcpy(values, source, count * sizeof(double));
+  }
+
+  /* nothing is kept in the document, unlike binaryVectorRead */
+  if (mapping) {
+    unmapValues(mapping);
+  }
+  else if (!isBuffer) {
+    free(source);
+  }
+  return SUCCESS;
+}
+
+static int writeValues(FILE* file, const double* values, int nValues)
+{
+  if (isLittleEndian()) {
+    return fwrite(values, sizeof(double), (size_t) nValues, file) == (size_t) nValues;
+  }
+  else {
+    double chunk[1024];
+    int i = 0;
+    while (i < nValues) {
+      int n = nValues - i < 1024 ? nValues - i : 1024;
+      memcpy(chunk, values + i, n * sizeof(double));
+      swapBytes(chunk, (size_t) n);
+      if (fwrite(chunk, sizeof(double), (size_t) n, file) != (size_t) n) {
+        return 0;
+      }
+      i += n;
+    }
+    return 1;
+  }
+}
+
+/* Collects all binary vector elements in document order */
+static void collectElements(xmlNodePtr node, xmlNodePtr** elements, int* count, int* capacity)
+{
+  for (; node; node = node->next) {
+    if (node->type != XML_ELEMENT_NODE) {
+      continue;
+    }
+    if (binaryVectorIsBinary(node)) {
+      if (*count == *capacity) {
+        *capacity = *capacity > 0 ? 2 * *capacity : 16;
+        *elements = (xmlNodePtr*) realloc(*elements, *capacity * sizeof(xmlNodePtr));
+      }
+      (*elements)[(*count)++] = node;
+    }
+    collectElements(node->children, elements, count, capacity);
+  }
+}
+
+ReturnCode binaryVectorSave(TixiDocument* document, const char* xmlFilename)
+{
+  unsigned char header[BINARY_HEADER_SIZE] = {'T', 'I', 'X', 'I', 'B', 'I', 'N', '\0', BINARY_VERSION, 0, 0, 0, 0, 0, 0, 0};
+  xmlNodePtr* elements = NULL;
+  long long* offsets = NULL;
+  long long offset = BINARY_HEADER_SIZE;
+  char* sidecarFilename = NULL;
+  char* tmpFilename = NULL;
+  char* directory = NULL;
+  char* name = NULL;
+  FILE* file = NULL;
+  ReturnCode error = SUCCESS;
+  int count = 0;
+  int capacity = 0;
+  int i;
+
+  collectElements(document->docPtr->children, &elements, &count, &capacity);
+  if (count == 0) {
+    return SUCCESS;
+  }
+
+  sidecarFilename = buildString("%s.bin", xmlFilename);
+  tmpFilename = buildString("%s.%d.tmp", sidecarFilename, (int) getpid());
+  file = fopen(tmpFilename, "wb");
+  if (!file || fwrite(header, 1, BINARY_HEADER_SIZE, file) != BINARY_HEADER_SIZE) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Cannot write binary vector file \"%s\".\n", sidecarFilename);
+    error = FAILED;
+  }
+
+  offsets = (long long*) malloc(count * sizeof(long long));
+  for (i = 0; i < count && error == SUCCESS; ++i) {
+    BinaryMapping* mapping = NULL;
+    double* values = NULL;
+    int nValues = 0;
+    int isBuffer = 0;
+
+    error = getValues(document, elements[i], &values, &nValues, &mapping, &isBuffer);
+    if (error != SUCCESS) {
+      break;
+    }
+    if (!writeValues(file, values, nValues)) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Cannot write binary vector file \"%s\".\n", sidecarFilename);
+      error = FAILED;
+    }
+    offsets[i] = offset;
+    offset += (long long) nValues * (long long) sizeof(double);
+
+    if (mapping) {
+      unmapValues(mapping);
+    }
+    else if (!isBuffer) {
+      free(values);
+    }
+  }
+
+  if (file && fclose(file) != 0) {
+    error = FAILED;
+  }
+#ifdef _WIN32
+  if (error == SUCCESS) {
+    remove(sidecarFilename);
+  }
+#endif
+  if (error == SUCCESS && rename(tmpFilename, sidecarFilename) != 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Cannot write binary vector file \"%s\".\n", sidecarFilename);
+    error = FAILED;
+  }
+
+  if (error == SUCCESS) {
+    BinaryVectorStore* store = getStore(document);
+
+    strip_dirname(sidecarFilename, &directory, &name);
+    for (i = 0; i < count; ++i) {
+      xmlUnsetProp(elements[i], (const xmlChar*) BINARY_BUFFER_ATTRIBUTE);
+      xmlSetProp(elements[i], (const xmlChar*) BINARY_FILE_ATTRIBUTE, (const xmlChar*) name);
+      setIntAttribute(elements[i], BINARY_OFFSET_ATTRIBUTE, offsets[i]);
+    }
+
+    /* all vectors are in the file now */
+    for (i = 0; i < store->nBuffers; ++i) {
+      free(store->buffers[i]);
+    }
+    store->nBuffers = 0;
+    free(store->directory);
+    store->directory = directory;
+    free(name);
+    clearDocumentCaches(document);
+  }
+  else {
+    remove(tmpFilename);
+  }
+
+  free(elements);
+  free(offsets);
+  free(tmpFilename);
+  free(sidecarFilename);
+  return error;
+}
+
+void binaryVectorFree(TixiDocument* document)
+{
+  BinaryVectorStore* store = document->binaryVectors;
+  int i;
+
+  if (!store) {
+    return;
+  }
+  while (store->mappings) {
+    BinaryMapping* next = store->mappings->next;
+    unmapValues(store->mappings);
+    store->mappings = next;
+  }
+  for (i = 0; i < store->nBuffers; ++i) {
+    free(store->buffers[i]);
+  }
+  free(store->buffers);
+  free(store->bufferSizes);
+  free(store->directory);
+  free(store);
+  document->binaryVectors = NULL;
+}
@@ -0,0 +1,119 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_BINARYVECTOR_H
+#define TIXI_BINARYVECTOR_H
+
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Vectors with at least a threshold number of values can be stored in a
+ * binary sidecar file instead of the element text. Such an element has no
+ * text, but the number of values and the location of the data as attributes:
+ *
+ *   <vec mapType="vector" binarySize="1000000" binaryFile="aircraft.xml.bin" binaryOffset="16"/>
+ *
+ * The sidecar file starts with the 16 byte header "TIXIBIN" '\0' followed by
+ * the version (uint32, little endian) and 4 reserved bytes. The vectors follow
+ * as raw little endian doubles. binaryFile is relative to the directory of the
+ * document, binaryOffset is the position of the first value in bytes.
+ *
+ * Vectors added or updated after opening the document are kept in memory and
+ * referenced by the attribute binaryBuffer until the document is saved. The
+ * sidecar file is written as "<document file name>.bin" on saving.
+ *
+ * Reading maps the values directly from the sidecar file (copy on write), so
+ * the values are neither copied nor parsed.
+ */
+
+#define BINARY_SIZE_ATTRIBUTE   "binarySize"
+#define BINARY_FILE_ATTRIBUTE   "binaryFile"
+#define BINARY_OFFSET_ATTRIBUTE "binaryOffset"
+#define BINARY_BUFFER_ATTRIBUTE "binaryBuffer"
+
+/**
+ * @brief Sets the minimum number of values of vectors stored in binary form, 0 disables it.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorSetThreshold(TixiDocument* document, int minElements);
+
+/**
+ * @brief Returns 1, if a vector with nElements values should be stored in binary form.
+ */
+TIXI_INTERNAL_EXPORT int binaryVectorUse(const TixiDocument* document, int nElements);
+
+/**
+ * @brief Returns 1, if the values of the element are stored in binary form.
+ */
+TIXI_INTERNAL_EXPORT int binaryVectorIsBinary(xmlNodePtr element);
+
+/**
+ * @brief Replaces the content of the element by a binary vector, which is kept in memory until saving.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorStore(TixiDocument* document, xmlNodePtr element,
+                                                  const double* values, int nValues);
+
+/**
+ * @brief Removes the binary vector attributes from an element, e.g. if its text is replaced.
+ */
+TIXI_INTERNAL_EXPORT void binaryVectorRemove(xmlNodePtr element);
+
+/**
+ * @brief Returns the number of values of a binary vector without reading them.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorSize(xmlNodePtr element, int* nValues);
+
+/**
+ * @brief Returns the values of a binary vector.
+ *
+ * The returned array is owned by the document and valid until it is closed.
+ * It may be modified without changing the document or the sidecar file.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorRead(TixiDocument* document, xmlNodePtr element,
+                                                 double** values, int* nValues);
+
+/**
+ * @brief Copies up to maxValues values of a binary vector into values and returns the
+ *        number of values of the vector in nValues.
+ *
+ * In contrast to ::binaryVectorRead, the values are released right after copying, such
+ * that repeated calls don't accumulate mappings or copies in the document.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorCopy(TixiDocument* document, xmlNodePtr element,
+                                                 double* values, int maxValues, int* nValues);
+
+/**
+ * @brief Writes all binary vectors of the document into the sidecar file of xmlFilename and
+ *        updates the attributes of the elements accordingly. Does nothing if the document has
+ *        no binary vectors.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode binaryVectorSave(TixiDocument* document, const char* xmlFilename);
+
+/**
+ * @brief Frees the buffers and unmaps the sidecar files of a document.
+ */
+TIXI_INTERNAL_EXPORT void binaryVectorFree(TixiDocument* document);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_BINARYVECTOR_H
@@ -0,0 +1,266 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "childIndex.h"
+
+#include "namespaceFunctions.h"
+#include "statistics.h"
+#include <libxml/hash.h>
+#include <libxml/xpathInternals.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/* all children of a parent with the same name, in document order */
+typedef struct {
+  int count;
+  int capacity;
+  xmlNodePtr* nodes;
+} ChildIndexGroup;
+
+static void freeChildIndexGroup(void* payload, const xmlChar* name)
+{
+  ChildIndexGroup* group = (ChildIndexGroup*) payload;
+  (void) name;
+  free(group->nodes);
+  free(group);
+}
+
+/* the indexed element children of a parent node */
+typedef struct {
+  xmlHashTablePtr groups;       /**< ChildIndexGroup per local name and namespace URI */
+  xmlHashTablePtr positions;    /**< position of each child in its group, built on first use */
+} ParentIndex;
+
+static void freeParentIndex(void* payload, const xmlChar* name)
+{
+  ParentIndex* index = (ParentIndex*) payload;
+  (void) name;
+  xmlHashFree(index->groups, freeChildIndexGroup);
+  xmlHashFree(index->positions, NULL);
+  free(index);
+}
+
+/* hex representation of the pointer, which is faster than snprintf for each lookup */
+static void nodeKey(const xmlNodePtr node, char* key, size_t size)
+{
+  static const char digits[] = "0123456789abcdef";
+  size_t value = (size_t) node;
+  size_t pos = 0;
+
+  do {
+    key[pos++] = digits[value & 0xf];
+    value >>= 4;
+  } while (value && pos + 1 < size);
+  key[pos] = '\0';
+}
+
+static ParentIndex* buildParentIndex(const xmlNodePtr parent)
+{
+  ParentIndex* index = (ParentIndex*) calloc(1, sizeof(ParentIndex));
+  xmlHashTablePtr groups = index ? xmlHashCreate(0) : NULL;
+  xmlNodePtr child = NULL;
+
+  if (!groups) {
+    free(index);
+    return NULL;
+  }
+
+  for (child = parent->children; child; child = child->next) {
+    const xmlChar* namespaceURI = NULL;
+    ChildIndexGroup* group = NULL;
+
+    if (child->type != XML_ELEMENT_NODE) {
+      continue;
+    }
+
+    namespaceURI = child->ns ? child->ns->href : NULL;
+    group = (ChildIndexGroup*) xmlHashLookup2(groups, child->name, namespaceURI);
+    if (!group) {
+      group = (ChildIndexGroup*) calloc(1, sizeof(ChildIndexGroup));
+      if (!group || xmlHashAddEntry2(groups, child->name, namespaceURI, group) != 0) {
+        free(group);
+        xmlHashFree(groups, freeChildIndexGroup);
+        free(index);
+        return NULL;
+      }
+    }
+
+    if (group->count == group->capacity) {
+      int capacity = group->capacity > 0 ? 2 * group->capacity : 4;
+      xmlNodePtr* nodes = (xmlNodePtr*) realloc(group->nodes, capacity * sizeof(xmlNodePtr));
+      if (!nodes) {
+        xmlHashFree(groups, freeChildIndexGroup);
+        free(index);
+        return NULL;
+      }
+      group->nodes = nodes;
+      group->capacity = capacity;
+    }
+    group->nodes[group->count++] = child;
+  }
+
+  index->groups = groups;
+  return index;
+}
+
+static ParentIndex* getParentIndex(TixiDocument* document, const xmlNodePtr parent)
+{
+  char key[64];
+  ParentIndex* index = NULL;
+
+  if (!document->childIndex) {
+    document->childIndex = xmlHashCreate(0);
+    if (!document->childIndex) {
+      return NULL;
+    }
+  }
+
+  nodeKey(parent, key, sizeof(key));
+  index = (ParentIndex*) xmlHashLookup(document->childIndex, (const xmlChar*) key);
+  if (index) {
+    STATISTICS_COUNT(document, childIndexHits);
+  }
+  else {
+    STATISTICS_COUNT(document, childIndexMisses);
+    index = buildParentIndex(parent);
+    if (!index) {
+      return NULL;
+    }
+    if (xmlHashAddEntry(document->childIndex, (const xmlChar*) key, index) != 0) {
+      freeParentIndex(index, NULL);
+      return NULL;
+    }
+  }
+  return index;
+}
+
+static ChildIndexGroup* getChildIndexGroup(TixiDocument* document, const xmlNodePtr parent,
+                                           const xmlChar* name, const xmlChar* namespaceURI)
+{
+  ParentIndex* index = getParentIndex(document, parent);
+  return index ? (ChildIndexGroup*) xmlHashLookup2(index->groups, name, namespaceURI) : NULL;
+}
+
+static void addGroupPositions(void* payload, void* data, const xmlChar* name)
+{
+  ChildIndexGroup* group = (ChildIndexGroup*) payload;
+  xmlHashTablePtr positions = (xmlHashTablePtr) data;
+  char key[64];
+  int i = 0;
+
+  (void) name;
+  for (i = 0; i < group->count; ++i) {
+    nodeKey(group->nodes[i], key, sizeof(key));
+    xmlHashAddEntry(positions, (const xmlChar*) key, (void*) (size_t) (i + 1));
+  }
+}
+
+int childIndexGetCount(TixiDocument* document, const xmlNodePtr parent,
+                       const xmlChar* name, const xmlChar* namespaceURI)
+{
+  ChildIndexGroup* group = getChildIndexGroup(document, parent, name, namespaceURI);
+  return group ? group->count : 0;
+}
+
+const xmlNodePtr* childIndexGetChildren(TixiDocument* document, const xmlNodePtr parent,
+                                        const xmlChar* name, const xmlChar* namespaceURI, int* count)
+{
+  ChildIndexGroup* group = getChildIndexGroup(document, parent, name, namespaceURI);
+  *count = group ? group->count : 0;
+  return group ? group->nodes : NULL;
+}
+
+xmlNodePtr childIndexGetChild(TixiDocument* document, const xmlNodePtr parent,
+                              const xmlChar* name, const xmlChar* namespaceURI, int index)
+{
+  ChildIndexGroup* group = getChildIndexGroup(document, parent, name, namespaceURI);
+  if (!group || index < 1 || index > group->count) {
+    return NULL;
+  }
+  return group->nodes[index - 1];
+}
+
+int childIndexGetPosition(TixiDocument* document, const xmlNodePtr child, int* count)
+{
+  ParentIndex* index = NULL;
+  ChildIndexGroup* group = NULL;
+  size_t position = 0;
+  char key[64];
+
+  if (child->type != XML_ELEMENT_NODE || !child->parent) {
+    return -1;
+  }
+
+  index = getParentIndex(document, child->parent);
+  if (!index) {
+    return -1;
+  }
+  if (!index->positions) {
+    index->positions = xmlHashCreate(0);
+    if (!index->positions) {
+      return -1;
+    }
+    xmlHashScan(index->groups, addGroupPositions, index->positions);
+  }
+
+  group = (ChildIndexGroup*) xmlHashLookup2(index->groups, child->name, child->ns ? child->ns->href : NULL);
+  nodeKey(child, key, sizeof(key));
+  position = (size_t) xmlHashLookup(index->positions, (const xmlChar*) key);
+  if (!group || position == 0) {
+    return -1;
+  }
+
+  *count = group->count;
+  return (int) position;
+}
+
+void childIndexClear(TixiDocument* document)
+{
+  if (document->childIndex) {
+    xmlHashFree(document->childIndex, freeParentIndex);
+    document->childIndex = NULL;
+  }
+}
+
+int childIndexResolveName(const xmlXPathContextPtr xpathContext, const char* qualifiedName,
+                          char** name, const xmlChar** namespaceURI)
+{
+  char* prefix = NULL;
+
+  *name = NULL;
+  *namespaceURI = NULL;
+
+  if (xmlValidateQName((const xmlChar*) qualifiedName, 0) != 0) {
+    return 0;
+  }
+
+  extractPrefixAndName(qualifiedName, &prefix, name);
+  if (prefix) {
+    *namespaceURI = xmlXPathNsLookup(xpathContext, (const xmlChar*) prefix);
+    free(prefix);
+    if (!*namespaceURI) {
+      free(*name);
+      *name = NULL;
+      return 0;
+    }
+  }
+
+  return 1;
+}
@@ -0,0 +1,95 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_CHILDINDEX_H
+#define TIXI_CHILDINDEX_H
+
+#include <libxml/tree.h>
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The child index stores, for each parent node that was queried, the element
+ * children grouped by their local name and namespace URI in document order.
+ * It is built lazily on first access of a parent and has to be cleared with
+ * ::childIndexClear whenever elements are added, removed, renamed or moved.
+ */
+
+/**
+ * @brief Returns the number of element children of parent with the given local name
+ *        and namespace URI (NULL for elements without namespace).
+ */
+TIXI_INTERNAL_EXPORT int childIndexGetCount(TixiDocument* document, const xmlNodePtr parent,
+                                            const xmlChar* name, const xmlChar* namespaceURI);
+
+/**
+ * @brief Returns the index-th (1-based) element child of parent with the given local name
+ *        and namespace URI (NULL for elements without namespace).
+ *
+ * @return The child node or NULL, if index is out of range
+ */
+TIXI_INTERNAL_EXPORT xmlNodePtr childIndexGetChild(TixiDocument* document, const xmlNodePtr parent,
+                                                   const xmlChar* name, const xmlChar* namespaceURI, int index);
+
+/**
+ * @brief Returns all element children of parent with the given local name and namespace
+ *        URI in document order.
+ *
+ * @param count (out) number of children
+ * @return The children owned by the index or NULL, if there are none
+ */
+TIXI_INTERNAL_EXPORT const xmlNodePtr* childIndexGetChildren(TixiDocument* document, const xmlNodePtr parent,
+                                                             const xmlChar* name, const xmlChar* namespaceURI,
+                                                             int* count);
+
+/**
+ * @brief Returns the 1-based position of an element among the equally named
+ *        element children of its parent.
+ *
+ * @param count (out) number of equally named children, including child
+ * @return The position or -1, if the index of the parent cannot be built
+ */
+TIXI_INTERNAL_EXPORT int childIndexGetPosition(TixiDocument* document, const xmlNodePtr child, int* count);
+
+/**
+ * @brief Drops all child indices of the document
+ */
+TIXI_INTERNAL_EXPORT void childIndexClear(TixiDocument* document);
+
+/**
+ * @brief Resolves the local name and namespace URI of a qualified name like
+ *        "prefix:name" or "name" using the namespaces registered in the XPath context.
+ *
+ * @param xpathContext (in) XPath context with the registered namespace prefixes
+ * @param qualifiedName (in) the qualified name
+ * @param name (out) local name, has to be freed by the caller
+ * @param namespaceURI (out) namespace URI or NULL, must not be freed by the caller
+ * @return 1, if the name could be resolved, 0 if qualifiedName is not a
+ *         valid qualified name or its prefix is not registered
+ */
+TIXI_INTERNAL_EXPORT int childIndexResolveName(const xmlXPathContextPtr xpathContext, const char* qualifiedName,
+                                               char** name, const xmlChar** namespaceURI);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_CHILDINDEX_H
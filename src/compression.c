@@ -0,0 +1,438 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "compression.h"
+#include "threadPool.h"
+#include "tixiUtils.h"
+
+#include <libxml/uri.h>
+#include <libxml/xmlIO.h>
+#include <libxml/xmlsave.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+extern void printMsg(MessageType type, const char* message, ...);
+
+/* size of the blocks, which are compressed in parallel */
+#define COMPRESSION_BLOCK_SIZE (1 << 20)
+
+typedef struct
+{
+  CompressionFormat format;
+  gzFile gz;
+#ifdef HAVE_ZSTD
+  ZSTD_DCtx* zstd;
+  ZSTD_inBuffer compressed;     /* the whole compressed file */
+  char* decompressed;           /* the whole decompressed file, if decompressed in parallel */
+  size_t decompressedSize;
+  size_t decompressedPos;
+#endif
+} CompressedInput;
+
+typedef struct
+{
+  const char* data;
+  size_t size;
+  CompressionFormat format;
+  char** blocks;                /* compressed blocks, NULL on errors */
+  size_t* blockSizes;
+} CompressionJob;
+
+static int callbacksRegistered = 0;
+
+CompressionFormat compressionFormat(const char* filename)
+{
+  if (string_endsWith(filename, ".gz") == 0) {
+    return COMPRESSION_GZIP;
+  }
+  if (string_endsWith(filename, ".zst") == 0) {
+    return COMPRESSION_ZSTD;
+  }
+  return COMPRESSION_NONE;
+}
+
+int compressionSupported(CompressionFormat format)
+{
+#ifdef HAVE_ZSTD
+  (void) format;
+  return 1;
+#else
+  return format != COMPRESSION_ZSTD;
+#endif
+}
+
+/* returns the local path of a file name or file:// URI */
+static char* getLocalPath(const char* filename)
+{
+  struct stat st;
+  char* path = string_startsWith(filename, "file://") == 0 ? uriToLocalPath(filename) : buildString("%s", filename);
+
+  /* libxml2 may pass escaped URIs */
+  if (path && stat(path, &st) != 0) {
+    char* unescaped = xmlURIUnescapeString(path, 0, NULL);
+    if (unescaped && stat(unescaped, &st) == 0) {
+      free(path);
+      path = buildString("%s", unescaped);
+    }
+    xmlFree(unescaped);
+  }
+  return path;
+}
+
+static int compressedMatch(const char* filename)
+{
+  CompressionFormat format = compressionFormat(filename);
+  if (format == COMPRESSION_NONE || !compressionSupported(format)) {
+    return 0;
+  }
+  /* only local files */
+  return strstr(filename, "://") == NULL || string_startsWith(filename, "file://") == 0;
+}
+
+#ifdef HAVE_ZSTD
+
+typedef struct
+{
+  const char* source;
+  size_t sourceSize;
+  char* destination;
+  size_t destinationSize;
+  int failed;
+} ZstdFrame;
+
+static void decompressFrame(void* data, int index)
+{
+  ZstdFrame* frame = ((ZstdFrame*) data) + index;
+  size_t size = ZSTD_decompress(frame->destination, frame->destinationSize, frame->source, frame->sourceSize);
+  frame->failed = ZSTD_isError(size) || size != frame->destinationSize;
+}
+
+/* Files consisting of several frames with known sizes, as written by
+ * compressionSaveDocument, are decompressed in parallel. Returns 0, if the
+ * file has to be decompressed as a stream. */
+static int decompressFrames(CompressedInput* input)
+{
+  const char* source = (const char*) input->compressed.src;
+  size_t sourceSize = input->compressed.size;
+  ZstdFrame* frames = NULL;
+  size_t position = 0;
+  size_t totalSize = 0;
+  int nFrames = 0;
+  int capacity = 0;
+  int i;
+
+  while (position < sourceSize) {
+    size_t frameSize = ZSTD_findFrameCompressedSize(source + position, sourceSize - position);
+    unsigned long long contentSize = ZSTD_getFrameContentSize(source + position, sourceSize - position);
+    if (ZSTD_isError(frameSize) || contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == ZSTD_CONTENTSIZE_ERROR) {
+      free(frames);
+      return 0;
+    }
+    if (nFrames == capacity) {
+      capacity = capacity > 0 ? 2 * capacity : 16;
+      frames = (ZstdFrame*) realloc(frames, capacity * sizeof(ZstdFrame));
+    }
+    frames[nFrames].source = source + position;
+    frames[nFrames].sourceSize = frameSize;
+    frames[nFrames].destinationSize = (size_t) contentSize;
+    frames[nFrames].failed = 0;
+    totalSize += (size_t) contentSize;
+    position += frameSize;
+    nFrames++;
+  }
+
+  if (nFrames < 2) {
+    free(frames);
+    return 0;
+  }
+
+  input->decompressed = (char*) malloc(totalSize > 0 ? totalSize : 1);
+  input->decompressedSize = totalSize;
+  totalSize = 0;
+  for (i = 0; i < nFrames; ++i) {
+    frames[i].destination = input->decompressed + totalSize;
+    totalSize += frames[i].destinationSize;
+  }
+
+  threadPoolRun(nFrames, 0, decompressFrame, frames);
+
+  for (i = 0; i < nFrames; ++i) {
+    if (frames[i].failed) {
+      /* the stream decoder reports the error */
+      free(input->decompressed);
+      input->decompressed = NULL;
+      free(frames);
+      return 0;
+    }
+  }
+  free(frames);
+  return 1;
+}
+
+static int openZstd(CompressedInput* input, const char* path)
+{
+  FILE* file = fopen(path, "rb");
+  char* data = NULL;
+  long size = 0;
+
+  if (!file) {
+    return -1;
+  }
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  data = (char*) malloc(size > 0 ? size : 1);
+  if (size < 0 || fread(data, 1, size, file) != (size_t) size) {
+    fclose(file);
+    free(data);
+    return -1;
+  }
+  fclose(file);
+
+  input->compressed.src = data;
+  input->compressed.size = (size_t) size;
+  input->compressed.pos = 0;
+  if (!decompressFrames(input)) {
+    input->zstd = ZSTD_createDCtx();
+  }
+  return 0;
+}
+
+static int readZstd(CompressedInput* input, char* buffer, int len)
+{
+  ZSTD_outBuffer output;
+
+  if (input->decompressed) {
+    size_t size = input->decompressedSize - input->decompressedPos;
+    if (size > (size_t) len) {
+      size = (size_t) len;
+    }
+    memcpy(buffer, input->decompressed + input->decompressedPos, size);
+    input->decompressedPos += size;
+    return (int) size;
+  }
+
+  if (!input->zstd) {
+    return -1;
+  }
+
+  output.dst = buffer;
+  output.size = (size_t) len;
+  output.pos = 0;
+  while (output.pos == 0 && input->compressed.pos < input->compressed.size) {
+    size_t result = ZSTD_decompressStream(input->zstd, &output, &input->compressed);
+    if (ZSTD_isError(result)) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Could not decompress zstd data: %s\n", ZSTD_getErrorName(result));
+      return -1;
+    }
+  }
+  return (int) output.pos;
+}
+
+#endif
+
+static void* compressedOpen(const char* filename)
+{
+  CompressedInput* input = NULL;
+  char* path = getLocalPath(filename);
+
+  if (!path) {
+    return NULL;
+  }
+
+  input = (CompressedInput*) calloc(1, sizeof(CompressedInput));
+  input->format = compressionFormat(filename);
+  if (input->format == COMPRESSION_GZIP) {
+    input->gz = gzopen(path, "rb");
+    if (!input->gz) {
+      free(input);
+      input = NULL;
+    }
+  }
+#ifdef HAVE_ZSTD
+  else if (openZstd(input, path) != 0) {
+    free(input);
+    input = NULL;
+  }
+#endif
+  free(path);
+  return input;
+}
+
+static int compressedRead(void* context, char* buffer, int len)
+{
+  CompressedInput* input = (CompressedInput*) context;
+
+  if (input->format == COMPRESSION_GZIP) {
+    return gzread(input->gz, buffer, (unsigned) len);
+  }
+#ifdef HAVE_ZSTD
+  return readZstd(input, buffer, len);
+#else
+  return -1;
+#endif
+}
+
+static int compressedClose(void* context)
+{
+  CompressedInput* input = (CompressedInput*) context;
+  int result = 0;
+
+  if (input->gz) {
+    result = gzclose(input->gz) == Z_OK ? 0 : -1;
+  }
+#ifdef HAVE_ZSTD
+  ZSTD_freeDCtx(input->zstd);
+  free((void*) input->compressed.src);
+  free(input->decompressed);
+#endif
+  free(input);
+  return result;
+}
+
+void compressionInit(void)
+{
+  if (callbacksRegistered) {
+    return;
+  }
+
+  /* the callbacks registered last are tried first, the default ones have to
+   * be registered before, otherwise they are registered lazily after ours */
+  xmlRegisterDefaultInputCallbacks();
+  if (xmlRegisterInputCallbacks(compressedMatch, compressedOpen, compressedRead, compressedClose) >= 0) {
+    callbacksRegistered = 1;
+  }
+}
+
+void compressionCleanup(void)
+{
+  callbacksRegistered = 0;
+}
+
+static void compressBlock(void* data, int index)
+{
+  CompressionJob* job = (CompressionJob*) data;
+  size_t offset = (size_t) index * COMPRESSION_BLOCK_SIZE;
+  const char* source = job->data + offset;
+  size_t sourceSize = job->size - offset < COMPRESSION_BLOCK_SIZE ? job->size - offset : COMPRESSION_BLOCK_SIZE;
+  char* block = NULL;
+  size_t blockSize = 0;
+
+  if (job->format == COMPRESSION_GZIP) {
+    /* each block is a complete gzip member */
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return;
+    }
+    blockSize = deflateBound(&stream, (uLong) sourceSize);
+    block = (char*) malloc(blockSize);
+    stream.next_in = (Bytef*) source;
+    stream.avail_in = (uInt) sourceSize;
+    stream.next_out = (Bytef*) block;
+    stream.avail_out = (uInt) blockSize;
+    if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+      free(block);
+      block = NULL;
+    }
+    blockSize = stream.total_out;
+    deflateEnd(&stream);
+  }
+#ifdef HAVE_ZSTD
+  else if (job->format == COMPRESSION_ZSTD) {
+    /* each block is a complete zstd frame */
+    blockSize = ZSTD_compressBound(sourceSize);
+    block = (char*) malloc(blockSize);
+    blockSize = ZSTD_compress(block, blockSize, source, sourceSize, ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(blockSize)) {
+      free(block);
+      block = NULL;
+    }
+  }
+#endif
+
+  job->blocks[index] = block;
+  job->blockSizes[index] = block ? blockSize : 0;
+}
+
+int compressionSaveDocument(const char* filename, xmlDocPtr document, int format, int nThreads)
+{
+  CompressionFormat compression = compressionFormat(filename);
+  CompressionJob job;
+  xmlChar* text = NULL;
+  FILE* file = NULL;
+  size_t written = 0;
+  int size = 0;
+  int nBlocks = 0;
+  int failed = 0;
+  int i;
+
+  if (compression == COMPRESSION_NONE) {
+    return xmlSaveFormatFileEnc(filename, document, "utf-8", format);
+  }
+  if (!compressionSupported(compression)) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Cannot write \"%s\", TiXI was built without zstd support.\n", filename);
+    return -1;
+  }
+
+  xmlDocDumpFormatMemoryEnc(document, &text, &size, "utf-8", format);
+  if (!text) {
+    return -1;
+  }
+
+  nBlocks = size > 0 ? (int) (((size_t) size + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE) : 1;
+  job.data = (const char*) text;
+  job.size = (size_t) size;
+  job.format = compression;
+  job.blocks = (char**) calloc(nBlocks, sizeof(char*));
+  job.blockSizes = (size_t*) calloc(nBlocks, sizeof(size_t));
+
+  threadPoolRun(nBlocks, nThreads, compressBlock, &job);
+
+  file = fopen(filename, "wb");
+  failed = file == NULL;
+  for (i = 0; i < nBlocks; ++i) {
+    if (!failed && (!job.blocks[i] || fwrite(job.blocks[i], 1, job.blockSizes[i], file) != job.blockSizes[i])) {
+      failed = 1;
+    }
+    written += job.blockSizes[i];
+    free(job.blocks[i]);
+  }
+  if (file && fclose(file) != 0) {
+    failed = 1;
+  }
+
+  free(job.blocks);
+  free(job.blockSizes);
+  xmlFree(text);
+
+  if (failed) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Could not write compressed file \"%s\".\n", filename);
+    return -1;
+  }
+  return written > INT_MAX ? INT_MAX : (int) written;
+}
@@ -0,0 +1,84 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_COMPRESSION_H
+#define TIXI_COMPRESSION_H
+
+#include "tixiInternal.h"
+
+#include <libxml/tree.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compressed documents are recognized by their file extension: ".gz" for
+ * gzip and ".zst" for zstd (if TiXI is built with zstd).
+ *
+ * Reading is done by libxml2 input callbacks, such that all functions
+ * reading files through libxml2 (documents, external data, stylesheets,
+ * schemas) support compressed files. Writing splits the serialized document
+ * into blocks, which are compressed in parallel and written as consecutive
+ * gzip members or zstd frames. Both are valid files for any gzip or zstd
+ * decompressor.
+ */
+
+typedef enum
+{
+  COMPRESSION_NONE,
+  COMPRESSION_GZIP,
+  COMPRESSION_ZSTD
+} CompressionFormat;
+
+/**
+ * @brief Returns the compression format of a file name by its extension
+ */
+TIXI_INTERNAL_EXPORT CompressionFormat compressionFormat(const char* filename);
+
+/**
+ * @brief Returns 1, if files with the compression format can be read and written
+ */
+TIXI_INTERNAL_EXPORT int compressionSupported(CompressionFormat format);
+
+/**
+ * @brief Registers the libxml2 input callbacks for compressed files. Can be called repeatedly.
+ */
+TIXI_INTERNAL_EXPORT void compressionInit(void);
+
+/**
+ * @brief Has to be called, when libxml2 drops the input callbacks in xmlCleanupParser
+ */
+TIXI_INTERNAL_EXPORT void compressionCleanup(void);
+
+/**
+ * @brief Saves a document as UTF-8, compressed according to the file extension.
+ *
+ * @param filename (in) Name of the file
+ * @param document (in) The document
+ * @param format (in) If not 0, the document is indented
+ * @param nThreads (in) Number of threads compressing the document, 0 for one per processor
+ * @return The number of bytes written or -1 on errors, like xmlSaveFormatFileEnc
+ */
+TIXI_INTERNAL_EXPORT int compressionSaveDocument(const char* filename, xmlDocPtr document, int format, int nThreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_COMPRESSION_H
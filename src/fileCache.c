@@ -0,0 +1,240 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "fileCache.h"
+#include "tixiUtils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+extern void printMsg(MessageType type, const char* message, ...);
+
+struct FileCacheEntry
+{
+  int handle;
+  char* filename;             /**< absolute path of the file */
+  time_t modificationTime;    /**< modification time of the file when it was compiled */
+  off_t fileSize;             /**< size of the file when it was compiled */
+  void* data;                 /**< the compiled data */
+  int refCount;               /**< number of references held by handles */
+  int outdated;               /**< the file was modified, the entry is only kept for its handles */
+  FileCacheEntry* next;
+};
+
+static char* resolvePath(const char* filename)
+{
+#ifdef _WIN32
+  return _fullpath(NULL, filename, 0);
+#else
+  return realpath(filename, NULL);
+#endif
+}
+
+/* the absolute path of a local file or file:// URI, NULL if the file does not exist */
+static char* getAbsolutePath(const char* filename)
+{
+  char* localPath = uriToLocalPath(filename);
+  char* absolutePath = resolvePath(localPath ? localPath : filename);
+  free(localPath);
+  return absolutePath;
+}
+
+static void freeFileCacheEntry(FileCache* cache, FileCacheEntry* entry)
+{
+  cache->free(entry->data);
+  free(entry->filename);
+  free(entry);
+}
+
+static void removeFileCacheEntry(FileCache* cache, FileCacheEntry* entry)
+{
+  FileCacheEntry** current = &cache->head;
+  while (*current) {
+    if (*current == entry) {
+      *current = entry->next;
+      freeFileCacheEntry(cache, entry);
+      return;
+    }
+    current = &(*current)->next;
+  }
+}
+
+static FileCacheEntry* findFileCacheEntry(FileCache* cache, int handle)
+{
+  FileCacheEntry* entry = NULL;
+  for (entry = cache->head; entry; entry = entry->next) {
+    if (entry->handle == handle) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/* remote files are loaded without caching, the entry is only kept for its handle and freed on release */
+static ReturnCode loadUncachedEntry(FileCache* cache, const char* filename, int* handle, void** data)
+{
+  FileCacheEntry* entry = (FileCacheEntry*) calloc(1, sizeof(FileCacheEntry));
+  ReturnCode error = SUCCESS;
+
+  if (!entry) {
+    return FAILED;
+  }
+
+  error = cache->load(filename, &entry->data);
+  if (error != SUCCESS) {
+    free(entry);
+    return error;
+  }
+
+  entry->filename = (char*) malloc(strlen(filename) + 1);
+  if (!entry->filename) {
+    freeFileCacheEntry(cache, entry);
+    return FAILED;
+  }
+  strcpy(entry->filename, filename);
+  entry->handle = ++cache->handleCounter;
+  entry->outdated = 1;
+  entry->refCount = 1;
+  entry->next = cache->head;
+  cache->head = entry;
+
+  *handle = entry->handle;
+  *data = entry->data;
+  return SUCCESS;
+}
+
+static ReturnCode loadFileCacheEntry(FileCache* cache, const char* filename, int* handle, void** data)
+{
+  FileCacheEntry* entry = NULL;
+  struct stat fileStatus;
+  char* absoluteFilename = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (filename && isURIPath(filename) == 0 && string_startsWith(filename, "file://") != 0) {
+    return loadUncachedEntry(cache, filename, handle, data);
+  }
+
+  absoluteFilename = filename ? getAbsolutePath(filename) : NULL;
+  if (!absoluteFilename || stat(absoluteFilename, &fileStatus) != 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: unable to open file %s.\n", filename ? filename : "(null)");
+    free(absoluteFilename);
+    return OPEN_FAILED;
+  }
+
+  for (entry = cache->head; entry; entry = entry->next) {
+    if (!entry->outdated && strcmp(entry->filename, absoluteFilename) == 0) {
+      break;
+    }
+  }
+
+  if (entry && (entry->modificationTime != fileStatus.st_mtime || entry->fileSize != fileStatus.st_size)) {
+    entry->outdated = 1;
+    if (entry->refCount == 0) {
+      removeFileCacheEntry(cache, entry);
+    }
+    entry = NULL;
+  }
+
+  if (!entry) {
+    entry = (FileCacheEntry*) calloc(1, sizeof(FileCacheEntry));
+    if (!entry) {
+      free(absoluteFilename);
+      return FAILED;
+    }
+
+    error = cache->load(absoluteFilename, &entry->data);
+    if (error != SUCCESS) {
+      free(entry);
+      free(absoluteFilename);
+      return error;
+    }
+
+    entry->handle = ++cache->handleCounter;
+    entry->filename = absoluteFilename;
+    entry->modificationTime = fileStatus.st_mtime;
+    entry->fileSize = fileStatus.st_size;
+    entry->next = cache->head;
+    cache->head = entry;
+  }
+  else {
+    free(absoluteFilename);
+  }
+
+  entry->refCount++;
+  *handle = entry->handle;
+  *data = entry->data;
+  return SUCCESS;
+}
+
+ReturnCode fileCacheLoad(FileCache* cache, const char* filename, int* handle, void** data)
+{
+  ReturnCode error = SUCCESS;
+
+  /* files are compiled while holding the lock, such that each file is compiled only once */
+  tixiMutexLock(&cache->mutex);
+  error = loadFileCacheEntry(cache, filename, handle, data);
+  tixiMutexUnlock(&cache->mutex);
+  return error;
+}
+
+void* fileCacheAcquire(FileCache* cache, int handle)
+{
+  FileCacheEntry* entry = NULL;
+  void* data = NULL;
+
+  tixiMutexLock(&cache->mutex);
+  entry = findFileCacheEntry(cache, handle);
+  if (entry && entry->refCount > 0) {
+    entry->refCount++;
+    data = entry->data;
+  }
+  tixiMutexUnlock(&cache->mutex);
+  return data;
+}
+
+ReturnCode fileCacheRelease(FileCache* cache, int handle)
+{
+  FileCacheEntry* entry = NULL;
+
+  tixiMutexLock(&cache->mutex);
+  entry = findFileCacheEntry(cache, handle);
+  if (!entry || entry->refCount == 0) {
+    tixiMutexUnlock(&cache->mutex);
+    return INVALID_HANDLE;
+  }
+
+  entry->refCount--;
+  if (entry->refCount == 0 && entry->outdated) {
+    removeFileCacheEntry(cache, entry);
+  }
+  tixiMutexUnlock(&cache->mutex);
+  return SUCCESS;
+}
+
+void fileCacheClear(FileCache* cache)
+{
+  tixiMutexLock(&cache->mutex);
+  while (cache->head) {
+    FileCacheEntry* entry = cache->head;
+    cache->head = entry->next;
+    freeFileCacheEntry(cache, entry);
+  }
+  tixiMutexUnlock(&cache->mutex);
+}
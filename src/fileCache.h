@@ -0,0 +1,109 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_FILECACHE_H
+#define TIXI_FILECACHE_H
+
+#include "tixiInternal.h"
+#include "tixiMutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A file cache keeps data compiled from files, e.g. XML schemas or XSLT
+ * stylesheets, keyed by the absolute path and the modification time of the
+ * file. Loading a file again, which has not changed since, returns the
+ * already compiled data. Data in use by a handle is kept alive until the
+ * handle is released, even if the file was changed in the meantime.
+ *
+ * file:// URIs are cached like the local files they refer to. Other URIs,
+ * e.g. http://, are compiled on each load and not shared, their data is freed
+ * as soon as the handle is released.
+ *
+ * The functions of a cache may be called from different threads.
+ */
+
+/**
+ * @brief Compiles the file, returns SUCCESS and the compiled data on success
+ */
+typedef ReturnCode (*FileCacheLoadFunc)(const char* filename, void** data);
+
+/**
+ * @brief Frees data returned by a FileCacheLoadFunc
+ */
+typedef void (*FileCacheFreeFunc)(void* data);
+
+typedef struct FileCacheEntry FileCacheEntry;
+
+typedef struct FileCache
+{
+  FileCacheLoadFunc load;
+  FileCacheFreeFunc free;
+  FileCacheEntry* head;
+  int handleCounter;
+  TixiMutex mutex;
+} FileCache;
+
+/**
+ * @brief Initializer of a static FileCache
+ */
+#define FILE_CACHE_INIT(loadFunc, freeFunc) { (loadFunc), (freeFunc), NULL, 0, TIXI_MUTEX_INIT }
+
+/**
+ * @brief Returns the compiled data of a file, compiling it only if the file is
+ *        not cached or was modified since it was cached.
+ *
+ * @param cache (in) The cache
+ * @param filename (in) Name of the file
+ * @param handle (out) Handle of the data in the cache. It holds a reference to the
+ *                     data, which has to be dropped with ::fileCacheRelease
+ * @param data (out) The compiled data, owned by the cache
+ * @return
+ *  - SUCCESS
+ *  - OPEN_FAILED if the file does not exist
+ *  - the error of the load function otherwise
+ */
+TIXI_INTERNAL_EXPORT ReturnCode fileCacheLoad(FileCache* cache, const char* filename, int* handle, void** data);
+
+/**
+ * @brief Adds another reference to the data of a handle returned by ::fileCacheLoad,
+ *        which keeps the data alive, even if the handle is released in the meantime.
+ *
+ * @return The compiled data or NULL, if the handle does not hold a reference
+ */
+TIXI_INTERNAL_EXPORT void* fileCacheAcquire(FileCache* cache, int handle);
+
+/**
+ * @brief Drops a reference added by ::fileCacheLoad or ::fileCacheAcquire.
+ *
+ * @return SUCCESS or INVALID_HANDLE, if the handle does not hold a reference
+ */
+TIXI_INTERNAL_EXPORT ReturnCode fileCacheRelease(FileCache* cache, int handle);
+
+/**
+ * @brief Frees all cached data, including data still referenced by handles.
+ */
+TIXI_INTERNAL_EXPORT void fileCacheClear(FileCache* cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_FILECACHE_H
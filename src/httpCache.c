@@ -0,0 +1,659 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "httpCache.h"
+#include "tixiUtils.h"
+#include "tixiMutex.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <dirent.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+extern void printMsg(MessageType type, const char* message, ...);
+
+/* lines of the .meta file of an url */
+enum
+{
+  META_URL,
+  META_ETAG,
+  META_LAST_MODIFIED,
+  META_DATA,
+  META_VALIDATED,
+  META_LAST_USED,
+  META_FIELDS
+};
+
+typedef struct
+{
+  char* name;
+  long long size;
+  int refCount;
+} DataFileInfo;
+
+typedef struct
+{
+  char* filename;
+  DataFileInfo* data;
+  long long lastUsed;
+} MetaFileInfo;
+
+struct HttpCacheWriter
+{
+  char* tmpFilename;
+  FILE* file;
+  uint64_t hash;          /**< hash of the body written so far */
+  size_t size;
+  int failed;
+};
+
+/* the settings are changed by the user while downloads of other threads use them,
+ * all functions accessing them hold cacheMutex */
+static char* cacheDirectory = NULL;
+static long long cacheMaxSize = 0;
+static int cacheMaxAge = 0;
+static TixiMutex cacheMutex = TIXI_MUTEX_INIT;
+
+#define HASH_INIT 14695981039346656037ULL
+
+/* maximum number of different bodies stored with the same hash and size */
+#define MAX_HASH_COLLISIONS 16
+
+static uint64_t hashBytes(uint64_t hash, const char* data, size_t size)
+{
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    hash ^= (unsigned char) data[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/* microseconds since the epoch */
+static long long currentTime(void)
+{
+#ifdef _WIN32
+  FILETIME fileTime;
+  ULARGE_INTEGER time;
+  GetSystemTimeAsFileTime(&fileTime);
+  time.LowPart = fileTime.dwLowDateTime;
+  time.HighPart = fileTime.dwHighDateTime;
+  /* file times count 100ns intervals since 1601 */
+  return (long long) (time.QuadPart / 10) - 11644473600000000LL;
+#else
+  struct timeval time;
+  gettimeofday(&time, NULL);
+  return (long long) time.tv_sec * 1000000 + time.tv_usec;
+#endif
+}
+
+static char* getMetaFilename(const char* url)
+{
+  return buildString("%s/%016llx.meta", cacheDirectory, (unsigned long long) hashBytes(HASH_INIT, url, strlen(url)));
+}
+
+static char* getCachePath(const char* name)
+{
+  return buildString("%s/%s", cacheDirectory, name);
+}
+
+/* the file is written under a temporary name and renamed, such that
+ * other processes sharing the cache never see partially written files */
+static int writeFileAtomic(const char* filename, const char* data, size_t size)
+{
+  char* tmpFilename = buildString("%s.%d.tmp", filename, (int) getpid());
+  FILE* file = fopen(tmpFilename, "wb");
+  size_t written = 0;
+  int result = 0;
+
+  if (!file) {
+    free(tmpFilename);
+    return -1;
+  }
+  written = fwrite(data, 1, size, file);
+  if (fclose(file) != 0 || written != size) {
+    result = -1;
+  }
+#ifdef _WIN32
+  if (result == 0) {
+    remove(filename);
+  }
+#endif
+  if (result == 0 && rename(tmpFilename, filename) != 0) {
+    result = -1;
+  }
+  if (result != 0) {
+    remove(tmpFilename);
+  }
+  free(tmpFilename);
+  return result;
+}
+
+static int writeMeta(const char* filename, const char* url, const char* etag, const char* lastModified,
+                     const char* dataName, long long validated, long long lastUsed)
+{
+  char* meta = buildString("%s\n%s\n%s\n%s\n%lld\n%lld\n", url, etag ? etag : "", lastModified ? lastModified : "",
+                           dataName, validated, lastUsed);
+  int result = writeFileAtomic(filename, meta, strlen(meta));
+  free(meta);
+  return result;
+}
+
+/* returns the content of the meta file, fields point into it */
+static char* readMeta(const char* filename, char* fields[META_FIELDS])
+{
+  char* meta = loadFileToString(filename);
+  char* line = meta;
+  int i;
+
+  if (!meta) {
+    return NULL;
+  }
+
+  for (i = 0; i < META_FIELDS; ++i) {
+    char* end = strchr(line, '\n');
+    if (!end) {
+      free(meta);
+      return NULL;
+    }
+    *end = '\0';
+    fields[i] = line;
+    line = end + 1;
+  }
+  return meta;
+}
+
+static void appendName(char*** names, int* count, const char* name, const char* extension)
+{
+  if (string_endsWith(name, extension) != 0) {
+    return;
+  }
+  /* grows in powers of two */
+  if ((*count & (*count - 1)) == 0 && *count >= 16) {
+    *names = (char**) realloc(*names, 2 * (*count) * sizeof(char*));
+  }
+  (*names)[(*count)++] = buildString("%s", name);
+}
+
+/* returns the names of all files in directory with the extension */
+static int listDirectory(const char* directory, const char* extension, char*** names)
+{
+  int count = 0;
+#ifdef _WIN32
+  WIN32_FIND_DATAA findData;
+  char* pattern = buildString("%s\\*%s", directory, extension);
+  HANDLE find = FindFirstFileA(pattern, &findData);
+
+  free(pattern);
+  *names = (char**) malloc(16 * sizeof(char*));
+  if (find != INVALID_HANDLE_VALUE) {
+    do {
+      appendName(names, &count, findData.cFileName, extension);
+    } while (FindNextFileA(find, &findData));
+    FindClose(find);
+  }
+#else
+  DIR* dir = opendir(directory);
+  struct dirent* entry = NULL;
+
+  *names = (char**) malloc(16 * sizeof(char*));
+  if (dir) {
+    while ((entry = readdir(dir)) != NULL) {
+      appendName(names, &count, entry->d_name, extension);
+    }
+    closedir(dir);
+  }
+#endif
+  return count;
+}
+
+static int compareDataFileInfo(const void* a, const void* b)
+{
+  return strcmp(((const DataFileInfo*) a)->name, ((const DataFileInfo*) b)->name);
+}
+
+static int compareMetaFileInfo(const void* a, const void* b)
+{
+  long long lastUsedA = ((const MetaFileInfo*) a)->lastUsed;
+  long long lastUsedB = ((const MetaFileInfo*) b)->lastUsed;
+  return (lastUsedA > lastUsedB) - (lastUsedA < lastUsedB);
+}
+
+static void removeDataFile(DataFileInfo* data, long long* totalSize)
+{
+  char* filename = getCachePath(data->name);
+  if (remove(filename) == 0) {
+    *totalSize -= data->size;
+  }
+  free(filename);
+}
+
+/* removes the least recently used entries, until the bodies fit into the maximum size */
+static void evictEntries(void)
+{
+  char** names = NULL;
+  DataFileInfo* dataFiles = NULL;
+  MetaFileInfo* metaFiles = NULL;
+  long long totalSize = 0;
+  int nDataFiles = 0;
+  int nMetaFiles = 0;
+  int i;
+
+  nDataFiles = listDirectory(cacheDirectory, ".data", &names);
+  dataFiles = (DataFileInfo*) calloc(nDataFiles + 1, sizeof(DataFileInfo));
+  for (i = 0; i < nDataFiles; ++i) {
+    char* filename = getCachePath(names[i]);
+    struct stat st;
+    dataFiles[i].name = names[i];
+    if (stat(filename, &st) == 0) {
+      dataFiles[i].size = (long long) st.st_size;
+      totalSize += dataFiles[i].size;
+    }
+    free(filename);
+  }
+  free(names);
+
+  if (totalSize > cacheMaxSize) {
+    qsort(dataFiles, nDataFiles, sizeof(DataFileInfo), compareDataFileInfo);
+
+    nMetaFiles = listDirectory(cacheDirectory, ".meta", &names);
+    metaFiles = (MetaFileInfo*) calloc(nMetaFiles + 1, sizeof(MetaFileInfo));
+    for (i = 0; i < nMetaFiles; ++i) {
+      char* fields[META_FIELDS];
+      char* meta = NULL;
+      DataFileInfo key;
+
+      metaFiles[i].filename = getCachePath(names[i]);
+      free(names[i]);
+
+      meta = readMeta(metaFiles[i].filename, fields);
+      if (!meta) {
+        continue;
+      }
+      key.name = fields[META_DATA];
+      metaFiles[i].data = (DataFileInfo*) bsearch(&key, dataFiles, nDataFiles, sizeof(DataFileInfo), compareDataFileInfo);
+      metaFiles[i].lastUsed = atoll(fields[META_LAST_USED]);
+      if (metaFiles[i].data) {
+        metaFiles[i].data->refCount++;
+      }
+      free(meta);
+    }
+    free(names);
+
+    /* bodies of replaced entries are not referenced anymore */
+    for (i = 0; i < nDataFiles; ++i) {
+      if (dataFiles[i].refCount == 0) {
+        removeDataFile(&dataFiles[i], &totalSize);
+      }
+    }
+
+    qsort(metaFiles, nMetaFiles, sizeof(MetaFileInfo), compareMetaFileInfo);
+    for (i = 0; i < nMetaFiles && totalSize > cacheMaxSize; ++i) {
+      remove(metaFiles[i].filename);
+      if (metaFiles[i].data && --metaFiles[i].data->refCount == 0) {
+        removeDataFile(metaFiles[i].data, &totalSize);
+      }
+    }
+
+    for (i = 0; i < nMetaFiles; ++i) {
+      free(metaFiles[i].filename);
+    }
+    free(metaFiles);
+  }
+
+  for (i = 0; i < nDataFiles; ++i) {
+    free(dataFiles[i].name);
+  }
+  free(dataFiles);
+}
+
+static ReturnCode setDirectory(const char* directory)
+{
+  struct stat st;
+
+  free(cacheDirectory);
+  cacheDirectory = NULL;
+
+  if (!directory) {
+    return SUCCESS;
+  }
+
+  if (stat(directory, &st) != 0 && create_local_directory(directory) != SUCCESS) {
+    return FAILED;
+  }
+  if (stat(directory, &st) != 0 || !(st.st_mode & S_IFDIR)) {
+    printMsg(MESSAGETYPE_ERROR, "Error: %s is not a directory.\n", directory);
+    return FAILED;
+  }
+
+  cacheDirectory = buildString("%s", directory);
+  if (cacheMaxSize > 0) {
+    evictEntries();
+  }
+  return SUCCESS;
+}
+
+ReturnCode httpCacheSetDirectory(const char* directory)
+{
+  ReturnCode error = SUCCESS;
+
+  tixiMutexLock(&cacheMutex);
+  error = setDirectory(directory);
+  tixiMutexUnlock(&cacheMutex);
+  return error;
+}
+
+void httpCacheSetLimits(long long maxSize, int maxAge)
+{
+  tixiMutexLock(&cacheMutex);
+  cacheMaxSize = maxSize > 0 ? maxSize : 0;
+  cacheMaxAge = maxAge > 0 ? maxAge : 0;
+  if (cacheDirectory && cacheMaxSize > 0) {
+    evictEntries();
+  }
+  tixiMutexUnlock(&cacheMutex);
+}
+
+static int lookup(const char* url, HttpCacheEntry* entry)
+{
+  char* fields[META_FIELDS];
+  char* filename = NULL;
+  char* meta = NULL;
+  struct stat st;
+
+  memset(entry, 0, sizeof(HttpCacheEntry));
+  if (!cacheDirectory) {
+    return 0;
+  }
+
+  filename = getMetaFilename(url);
+  meta = readMeta(filename, fields);
+  free(filename);
+  if (!meta) {
+    return 0;
+  }
+
+  /* the url might just have the same hash */
+  if (strcmp(fields[META_URL], url) != 0) {
+    free(meta);
+    return 0;
+  }
+
+  entry->dataFilename = getCachePath(fields[META_DATA]);
+  if (stat(entry->dataFilename, &st) != 0) {
+    httpCacheFreeEntry(entry);
+    free(meta);
+    return 0;
+  }
+
+  entry->etag = *fields[META_ETAG] ? buildString("%s", fields[META_ETAG]) : NULL;
+  entry->lastModified = *fields[META_LAST_MODIFIED] ? buildString("%s", fields[META_LAST_MODIFIED]) : NULL;
+  entry->fresh = cacheMaxAge > 0 && currentTime() - atoll(fields[META_VALIDATED]) < (long long) cacheMaxAge * 1000000;
+  free(meta);
+  return 1;
+}
+
+int httpCacheLookup(const char* url, HttpCacheEntry* entry)
+{
+  int found = 0;
+
+  tixiMutexLock(&cacheMutex);
+  found = lookup(url, entry);
+  tixiMutexUnlock(&cacheMutex);
+  return found;
+}
+
+static void markUsed(const char* url, int revalidated)
+{
+  char* fields[META_FIELDS];
+  char* filename = NULL;
+  char* meta = NULL;
+  long long now = currentTime();
+
+  if (!cacheDirectory) {
+    return;
+  }
+
+  /* update the times of the entry, the body is unchanged */
+  filename = getMetaFilename(url);
+  meta = readMeta(filename, fields);
+  if (meta && strcmp(fields[META_URL], url) == 0) {
+    writeMeta(filename, url, fields[META_ETAG], fields[META_LAST_MODIFIED], fields[META_DATA],
+              revalidated ? now : atoll(fields[META_VALIDATED]), now);
+  }
+  free(meta);
+  free(filename);
+}
+
+void httpCacheMarkUsed(const char* url, int revalidated)
+{
+  tixiMutexLock(&cacheMutex);
+  markUsed(url, revalidated);
+  tixiMutexUnlock(&cacheMutex);
+}
+
+char* httpCacheRead(const char* url, const HttpCacheEntry* entry, int revalidated)
+{
+  char* data = loadFileToString(entry->dataFilename);
+  if (data) {
+    httpCacheMarkUsed(url, revalidated);
+  }
+  return data;
+}
+
+static HttpCacheWriter* beginStore(void)
+{
+  HttpCacheWriter* writer = NULL;
+
+  if (!cacheDirectory) {
+    return NULL;
+  }
+
+  writer = (HttpCacheWriter*) calloc(1, sizeof(HttpCacheWriter));
+  writer->tmpFilename = buildString("%s/%d-%p.tmp", cacheDirectory, (int) getpid(), (void*) writer);
+  writer->file = fopen(writer->tmpFilename, "wb");
+  writer->hash = HASH_INIT;
+  if (!writer->file) {
+    printMsg(MESSAGETYPE_WARNING, "Warning: Could not create %s in the HTTP cache.\n", writer->tmpFilename);
+    free(writer->tmpFilename);
+    free(writer);
+    return NULL;
+  }
+  return writer;
+}
+
+HttpCacheWriter* httpCacheBeginStore(void)
+{
+  HttpCacheWriter* writer = NULL;
+
+  tixiMutexLock(&cacheMutex);
+  writer = beginStore();
+  tixiMutexUnlock(&cacheMutex);
+  return writer;
+}
+
+void httpCacheWrite(HttpCacheWriter* writer, const char* data, size_t size)
+{
+  if (!writer || writer->failed) {
+    return;
+  }
+  writer->hash = hashBytes(writer->hash, data, size);
+  writer->size += size;
+  if (fwrite(data, 1, size, writer->file) != size) {
+    writer->failed = 1;
+  }
+}
+
+void httpCacheAbortStore(HttpCacheWriter* writer)
+{
+  if (!writer) {
+    return;
+  }
+  if (writer->file) {
+    fclose(writer->file);
+  }
+  remove(writer->tmpFilename);
+  free(writer->tmpFilename);
+  free(writer);
+}
+
+/* 1, if both files have the same content */
+static int filesEqual(const char* filename1, const char* filename2)
+{
+  FILE* file1 = fopen(filename1, "rb");
+  FILE* file2 = fopen(filename2, "rb");
+  char buffer1[4096];
+  char buffer2[4096];
+  int equal = file1 && file2;
+
+  while (equal) {
+    size_t size1 = fread(buffer1, 1, sizeof(buffer1), file1);
+    size_t size2 = fread(buffer2, 1, sizeof(buffer2), file2);
+    if (size1 != size2 || memcmp(buffer1, buffer2, size1) != 0) {
+      equal = 0;
+    }
+    else if (size1 == 0) {
+      break;
+    }
+  }
+
+  if (file1) {
+    fclose(file1);
+  }
+  if (file2) {
+    fclose(file2);
+  }
+  return equal;
+}
+
+/* Moves the body into the cache and returns the name of its data file, NULL on failure.
+ * Bodies are named by their hash, identical bodies are stored once. As different bodies
+ * may have the same hash, an existing file is only shared if its content is the same,
+ * otherwise the body is stored under the next free name. */
+static char* storeDataFile(HttpCacheWriter* writer)
+{
+  int collision;
+
+  for (collision = 0; collision < MAX_HASH_COLLISIONS; ++collision) {
+    char* dataName = collision == 0
+        ? buildString("%016llx-%llx.data", (unsigned long long) writer->hash, (unsigned long long) writer->size)
+        : buildString("%016llx-%llx-%d.data", (unsigned long long) writer->hash, (unsigned long long) writer->size, collision);
+    char* dataFilename = getCachePath(dataName);
+    struct stat st;
+    int stored = 0;
+
+    if (stat(dataFilename, &st) != 0 || (size_t) st.st_size != writer->size) {
+      /* new body, or an incomplete file */
+#ifdef _WIN32
+      remove(dataFilename);
+#endif
+      stored = rename(writer->tmpFilename, dataFilename) == 0;
+      if (!stored) {
+        free(dataFilename);
+        free(dataName);
+        return NULL;
+      }
+    }
+    else {
+      stored = filesEqual(writer->tmpFilename, dataFilename);
+    }
+
+    free(dataFilename);
+    if (stored) {
+      return dataName;
+    }
+    free(dataName);
+  }
+  return NULL;
+}
+
+static void endStore(HttpCacheWriter* writer, const char* url, const char* etag, const char* lastModified)
+{
+  char* dataName = NULL;
+  char* metaFilename = NULL;
+  long long now = currentTime();
+
+  if (!writer) {
+    return;
+  }
+
+  if (fclose(writer->file) != 0) {
+    writer->failed = 1;
+  }
+  writer->file = NULL;
+
+  if (!cacheDirectory || (!etag && !lastModified)) {
+    httpCacheAbortStore(writer);
+    return;
+  }
+
+  metaFilename = getMetaFilename(url);
+  if (!writer->failed) {
+    dataName = storeDataFile(writer);
+  }
+
+  if (!dataName || writeMeta(metaFilename, url, etag, lastModified, dataName, now, now) != 0) {
+    printMsg(MESSAGETYPE_WARNING, "Warning: Could not write %s to the HTTP cache.\n", url);
+  }
+
+  httpCacheAbortStore(writer);
+  free(metaFilename);
+  free(dataName);
+
+  if (cacheMaxSize > 0) {
+    evictEntries();
+  }
+}
+
+void httpCacheEndStore(HttpCacheWriter* writer, const char* url, const char* etag, const char* lastModified)
+{
+  tixiMutexLock(&cacheMutex);
+  endStore(writer, url, etag, lastModified);
+  tixiMutexUnlock(&cacheMutex);
+}
+
+void httpCacheFreeEntry(HttpCacheEntry* entry)
+{
+  free(entry->etag);
+  free(entry->lastModified);
+  free(entry->dataFilename);
+  memset(entry, 0, sizeof(HttpCacheEntry));
+}
+
+void httpCacheCleanup(void)
+{
+  tixiMutexLock(&cacheMutex);
+  free(cacheDirectory);
+  cacheDirectory = NULL;
+  cacheMaxSize = 0;
+  cacheMaxAge = 0;
+  tixiMutexUnlock(&cacheMutex);
+}
@@ -0,0 +1,132 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_HTTPCACHE_H
+#define TIXI_HTTPCACHE_H
+
+#include "tixiInternal.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The HTTP cache stores downloaded resources in a local directory, which may
+ * be shared by several processes. Each url has a small index file (.meta),
+ * named by the hash of the url, holding the validators of the response
+ * (ETag, Last-Modified), the time of the last validation and of the last
+ * use. The bodies (.data) are named by the hash and size of their content,
+ * such that identical resources of different urls are stored only once.
+ *
+ * If a maximum size is set, the least recently used entries are removed
+ * until the bodies fit into the limit.
+ */
+
+typedef struct
+{
+  char* etag;               /**< ETag of the cached response or NULL */
+  char* lastModified;       /**< Last-Modified of the cached response or NULL */
+  char* dataFilename;       /**< file holding the cached body */
+  int fresh;                /**< the entry was validated within the maximum age */
+} HttpCacheEntry;
+
+typedef struct HttpCacheWriter HttpCacheWriter;
+
+/**
+ * @brief Sets the cache directory, which is created if it does not exist.
+ *        NULL disables the cache.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode httpCacheSetDirectory(const char* directory);
+
+/**
+ * @brief Sets the limits of the cache.
+ *
+ * @param maxSize (in) Maximum size of all cached bodies in bytes, 0 for no limit
+ * @param maxAge (in) Number of seconds after a validation in which an entry
+ *                    is used without asking the server again
+ */
+TIXI_INTERNAL_EXPORT void httpCacheSetLimits(long long maxSize, int maxAge);
+
+/**
+ * @brief Looks up the cache entry of an url.
+ *
+ * @return 1, if the url is cached, 0 otherwise or if the cache is disabled
+ */
+TIXI_INTERNAL_EXPORT int httpCacheLookup(const char* url, HttpCacheEntry* entry);
+
+/**
+ * @brief Returns the cached body of an entry returned by ::httpCacheLookup and marks
+ *        the entry as used.
+ *
+ * @param url (in) The url of the entry
+ * @param entry (in) The entry
+ * @param revalidated (in) If not 0, the server confirmed that the entry is up to date
+ * @return The body, which has to be freed by the caller, or NULL if it cannot be read
+ */
+TIXI_INTERNAL_EXPORT char* httpCacheRead(const char* url, const HttpCacheEntry* entry, int revalidated);
+
+/**
+ * @brief Marks the entry of an url as used, e.g. after reading its body directly.
+ *
+ * @param url (in) The url of the entry
+ * @param revalidated (in) If not 0, the server confirmed that the entry is up to date
+ */
+TIXI_INTERNAL_EXPORT void httpCacheMarkUsed(const char* url, int revalidated);
+
+/**
+ * @brief Starts to store a response, whose body is written piecewise with ::httpCacheWrite.
+ *
+ * @return The writer or NULL, if the cache is disabled. The writer has to be
+ *         finished with ::httpCacheEndStore or ::httpCacheAbortStore.
+ */
+TIXI_INTERNAL_EXPORT HttpCacheWriter* httpCacheBeginStore(void);
+
+/**
+ * @brief Appends data to the body of a response. Does nothing, if writer is NULL.
+ */
+TIXI_INTERNAL_EXPORT void httpCacheWrite(HttpCacheWriter* writer, const char* data, size_t size);
+
+/**
+ * @brief Adds the written response to the cache, if it has validators, evicts old
+ *        entries, if the cache is full, and frees the writer.
+ */
+TIXI_INTERNAL_EXPORT void httpCacheEndStore(HttpCacheWriter* writer, const char* url, const char* etag,
+                                            const char* lastModified);
+
+/**
+ * @brief Discards the written response and frees the writer.
+ */
+TIXI_INTERNAL_EXPORT void httpCacheAbortStore(HttpCacheWriter* writer);
+
+/**
+ * @brief Frees the members of an entry returned by ::httpCacheLookup.
+ */
+TIXI_INTERNAL_EXPORT void httpCacheFreeEntry(HttpCacheEntry* entry);
+
+/**
+ * @brief Disables the cache and resets the limits.
+ */
+TIXI_INTERNAL_EXPORT void httpCacheCleanup(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_HTTPCACHE_H
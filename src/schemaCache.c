@@ -0,0 +1,110 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "schemaCache.h"
+#include "fileCache.h"
+
+#include <libxml/parser.h>
+
+#include <stdlib.h>
+
+extern void printMsg(MessageType type, const char* message, ...);
+
+typedef struct
+{
+  xmlDocPtr schemaDoc;        /**< the schema document, referenced by the compiled schema */
+  xmlSchemaPtr schema;
+} CompiledSchema;
+
+static ReturnCode loadSchema(const char* filename, void** data)
+{
+  xmlSchemaParserCtxtPtr parserContext = NULL;
+  CompiledSchema* compiled = NULL;
+  xmlDocPtr schemaDoc = NULL;
+  xmlSchemaPtr schema = NULL;
+
+  schemaDoc = xmlReadFile(filename, NULL, XML_PARSE_NONET);
+  if (!schemaDoc) {
+    return OPEN_SCHEMA_FAILED;
+  }
+
+  parserContext = xmlSchemaNewDocParserCtxt(schemaDoc);
+  if (!parserContext) {
+    printMsg(MESSAGETYPE_ERROR, "Error: unable to create a parser context for the schema %s.\n", filename);
+    xmlFreeDoc(schemaDoc);
+    return FAILED;
+  }
+
+  schema = xmlSchemaParse(parserContext);
+  xmlSchemaFreeParserCtxt(parserContext);
+  if (!schema) {
+    printMsg(MESSAGETYPE_ERROR, "Error: the schema %s itself is not valid.\n", filename);
+    xmlFreeDoc(schemaDoc);
+    return FAILED;
+  }
+
+  compiled = (CompiledSchema*) malloc(sizeof(CompiledSchema));
+  if (!compiled) {
+    xmlSchemaFree(schema);
+    xmlFreeDoc(schemaDoc);
+    return FAILED;
+  }
+  compiled->schemaDoc = schemaDoc;
+  compiled->schema = schema;
+  *data = compiled;
+  return SUCCESS;
+}
+
+static void freeSchema(void* data)
+{
+  CompiledSchema* compiled = (CompiledSchema*) data;
+  xmlSchemaFree(compiled->schema);
+  xmlFreeDoc(compiled->schemaDoc);
+  free(compiled);
+}
+
+static FileCache schemaCache = FILE_CACHE_INIT(loadSchema, freeSchema);
+
+ReturnCode schemaCacheLoad(const char* xsdFilename, TixiSchemaHandle* handle, xmlSchemaPtr* schema)
+{
+  void* data = NULL;
+  ReturnCode error = fileCacheLoad(&schemaCache, xsdFilename, handle, &data);
+  if (error == OPEN_FAILED) {
+    return OPEN_SCHEMA_FAILED;
+  }
+  if (error == SUCCESS) {
+    *schema = ((CompiledSchema*) data)->schema;
+  }
+  return error;
+}
+
+xmlSchemaPtr schemaCacheAcquire(TixiSchemaHandle handle)
+{
+  CompiledSchema* compiled = (CompiledSchema*) fileCacheAcquire(&schemaCache, handle);
+  return compiled ? compiled->schema : NULL;
+}
+
+ReturnCode schemaCacheRelease(TixiSchemaHandle handle)
+{
+  return fileCacheRelease(&schemaCache, handle);
+}
+
+void schemaCacheClear(void)
+{
+  fileCacheClear(&schemaCache);
+}
@@ -0,0 +1,72 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_SCHEMACACHE_H
+#define TIXI_SCHEMACACHE_H
+
+#include <libxml/xmlschemas.h>
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The schema cache keeps compiled XML schemas in a file cache, see fileCache.h.
+ */
+
+/**
+ * @brief Returns the compiled schema of a file, parsing it only if the file is
+ *        not cached or was modified since it was cached.
+ *
+ * @param xsdFilename (in) Name of the schema file
+ * @param handle (out) Handle of the schema in the cache. It holds a reference to the
+ *                     schema, which has to be dropped with ::schemaCacheRelease
+ * @param schema (out) The compiled schema, owned by the cache
+ * @return
+ *  - SUCCESS
+ *  - OPEN_SCHEMA_FAILED if the file cannot be read or is not well-formed
+ *  - FAILED if the file is not a valid schema
+ */
+TIXI_INTERNAL_EXPORT ReturnCode schemaCacheLoad(const char* xsdFilename, TixiSchemaHandle* handle, xmlSchemaPtr* schema);
+
+/**
+ * @brief Adds a reference to the compiled schema of a handle returned by ::schemaCacheLoad,
+ *        which has to be dropped with ::schemaCacheRelease after the schema is used.
+ *
+ * @return The compiled schema or NULL, if the handle is not valid
+ */
+TIXI_INTERNAL_EXPORT xmlSchemaPtr schemaCacheAcquire(TixiSchemaHandle handle);
+
+/**
+ * @brief Drops a reference added by ::schemaCacheLoad or ::schemaCacheAcquire.
+ *
+ * @return SUCCESS or INVALID_HANDLE, if the handle does not hold a reference
+ */
+TIXI_INTERNAL_EXPORT ReturnCode schemaCacheRelease(TixiSchemaHandle handle);
+
+/**
+ * @brief Frees all cached schemas, including those still referenced by handles.
+ */
+TIXI_INTERNAL_EXPORT void schemaCacheClear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_SCHEMACACHE_H
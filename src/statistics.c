@@ -0,0 +1,378 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "statistics.h"
+#include "tixiMutex.h"
+
+#include <libxml/dict.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+static TixiMutex statisticsMutex = TIXI_MUTEX_INIT;
+static StatisticsFunction* functionListHead = NULL;
+static int functionCount = 0;
+static DocumentStatistics closedDocuments;
+
+long long statisticsNanoseconds(void)
+{
+#ifdef _WIN32
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  if (frequency.QuadPart == 0) {
+    QueryPerformanceFrequency(&frequency);
+  }
+  QueryPerformanceCounter(&counter);
+  return (long long) ((double) counter.QuadPart * 1e9 / (double) frequency.QuadPart);
+#else
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (long long) time.tv_sec * 1000000000LL + time.tv_nsec;
+#endif
+}
+
+static void atomicAdd(volatile long long* value, long long increment)
+{
+#ifdef _WIN32
+  InterlockedExchangeAdd64((volatile LONG64*) value, increment);
+#else
+  __atomic_fetch_add(value, increment, __ATOMIC_RELAXED);
+#endif
+}
+
+static int atomicLoad(volatile int* value)
+{
+#ifdef _WIN32
+  return *value;
+#else
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void registerFunction(StatisticsFunction* function)
+{
+  tixiMutexLock(&statisticsMutex);
+  if (!function->registered) {
+    function->next = functionListHead;
+    functionListHead = function;
+    functionCount++;
+#ifdef _WIN32
+    function->registered = 1;
+#else
+    __atomic_store_n(&function->registered, 1, __ATOMIC_RELEASE);
+#endif
+  }
+  tixiMutexUnlock(&statisticsMutex);
+}
+
+StatisticsCall statisticsEnter(StatisticsFunction* function)
+{
+  StatisticsCall call;
+
+  if (!atomicLoad(&function->registered)) {
+    registerFunction(function);
+  }
+  atomicAdd(&function->calls, 1);
+
+  call.function = function;
+  call.start = statisticsNanoseconds();
+  return call;
+}
+
+void statisticsLeave(StatisticsCall* call)
+{
+  atomicAdd(&call->function->nanoseconds, statisticsNanoseconds() - call->start);
+}
+
+size_t statisticsAllocatedSize(void* memory)
+{
+  if (!memory) {
+    return 0;
+  }
+#if defined(_WIN32)
+  return _msize(memory);
+#elif defined(__APPLE__)
+  return malloc_size(memory);
+#elif defined(__GLIBC__)
+  return malloc_usable_size(memory);
+#else
+  return 0;
+#endif
+}
+
+static void addDocumentStatistics(DocumentStatistics* sum, const DocumentStatistics* counters)
+{
+  sum->xpathEvaluations += counters->xpathEvaluations;
+  sum->xpathCacheHits += counters->xpathCacheHits;
+  sum->xpathCacheMisses += counters->xpathCacheMisses;
+  sum->childIndexHits += counters->childIndexHits;
+  sum->childIndexMisses += counters->childIndexMisses;
+  sum->vectorCacheHits += counters->vectorCacheHits;
+  sum->vectorCacheMisses += counters->vectorCacheMisses;
+  sum->memoryListEntries += counters->memoryListEntries;
+  sum->memoryListBytes += counters->memoryListBytes;
+}
+
+void statisticsAddClosedDocument(const TixiDocument* document)
+{
+  tixiMutexLock(&statisticsMutex);
+  addDocumentStatistics(&closedDocuments, &document->statistics);
+  tixiMutexUnlock(&statisticsMutex);
+}
+
+/* copies the function table, sorted by the total time and the number of calls */
+static int compareFunctions(const void* a, const void* b)
+{
+  const TixiFunctionStatistics* left = (const TixiFunctionStatistics*) a;
+  const TixiFunctionStatistics* right = (const TixiFunctionStatistics*) b;
+  if (left->seconds != right->seconds) {
+    return left->seconds < right->seconds ? 1 : -1;
+  }
+  if (left->calls != right->calls) {
+    return left->calls < right->calls ? 1 : -1;
+  }
+  return 0;
+}
+
+static TixiFunctionStatistics* copyFunctions(int* count)
+{
+  TixiFunctionStatistics* functions = NULL;
+  StatisticsFunction* current = NULL;
+  int i = 0;
+
+  tixiMutexLock(&statisticsMutex);
+  functions = (TixiFunctionStatistics*) malloc(sizeof(TixiFunctionStatistics) * (functionCount > 0 ? functionCount : 1));
+  if (functions) {
+    for (current = functionListHead; current; current = current->next, ++i) {
+      functions[i].name = current->name;
+      functions[i].calls = current->calls;
+      functions[i].seconds = (double) current->nanoseconds * 1e-9;
+    }
+  }
+  tixiMutexUnlock(&statisticsMutex);
+
+  if (functions) {
+    qsort(functions, i, sizeof(TixiFunctionStatistics), compareFunctions);
+  }
+  *count = i;
+  return functions;
+}
+
+ReturnCode statisticsGet(const TixiDocument* document, TixiStatistics* statistics)
+{
+  const DocumentStatistics* counters = &document->statistics;
+
+  statistics->xpathEvaluations = counters->xpathEvaluations;
+  statistics->xpathCacheHits = counters->xpathCacheHits;
+  statistics->xpathCacheMisses = counters->xpathCacheMisses;
+  statistics->childIndexHits = counters->childIndexHits;
+  statistics->childIndexMisses = counters->childIndexMisses;
+  statistics->vectorCacheHits = counters->vectorCacheHits;
+  statistics->vectorCacheMisses = counters->vectorCacheMisses;
+  statistics->memoryListEntries = counters->memoryListEntries;
+  statistics->memoryListBytes = counters->memoryListBytes;
+
+  statistics->functions = copyFunctions(&statistics->nFunctions);
+  return statistics->functions ? SUCCESS : FAILED;
+}
+
+int statisticsWriteJson(const char* filename)
+{
+  DocumentStatistics documents;
+  TixiFunctionStatistics* functions = NULL;
+  int nFunctions = 0;
+  int i;
+  FILE* file = NULL;
+
+  tixiMutexLock(&statisticsMutex);
+  documents = closedDocuments;
+  tixiMutexUnlock(&statisticsMutex);
+
+  functions = copyFunctions(&nFunctions);
+  if (!functions) {
+    return -1;
+  }
+
+  file = fopen(filename, "w");
+  if (!file) {
+    free(functions);
+    return -1;
+  }
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"documents\": {\n");
+  fprintf(file, "    \"xpathEvaluations\": %lld,\n", documents.xpathEvaluations);
+  fprintf(file, "    \"xpathCacheHits\": %lld,\n", documents.xpathCacheHits);
+  fprintf(file, "    \"xpathCacheMisses\": %lld,\n", documents.xpathCacheMisses);
+  fprintf(file, "    \"childIndexHits\": %lld,\n", documents.childIndexHits);
+  fprintf(file, "    \"childIndexMisses\": %lld,\n", documents.childIndexMisses);
+  fprintf(file, "    \"vectorCacheHits\": %lld,\n", documents.vectorCacheHits);
+  fprintf(file, "    \"vectorCacheMisses\": %lld,\n", documents.vectorCacheMisses);
+  fprintf(file, "    \"memoryListEntries\": %lld,\n", documents.memoryListEntries);
+  fprintf(file, "    \"memoryListBytes\": %lld\n", documents.memoryListBytes);
+  fprintf(file, "  },\n");
+  fprintf(file, "  \"functions\": [");
+  for (i = 0; i < nFunctions; ++i) {
+    fprintf(file, "%s\n    {\"name\": \"%s\", \"calls\": %lld, \"seconds\": %.9f}",
+            i > 0 ? "," : "", functions[i].name, functions[i].calls, functions[i].seconds);
+  }
+  fprintf(file, "\n  ]\n}\n");
+
+  free(functions);
+  return fclose(file) == 0 ? 0 : -1;
+}
+
+/* size of a string of the document, that is not shared via the dictionary */
+static size_t stringSize(xmlDictPtr dict, const xmlChar* string)
+{
+  if (!string || (dict && xmlDictOwns(dict, string))) {
+    return 0;
+  }
+  return strlen((const char*) string) + 1;
+}
+
+/* size of the content of a text node, short texts may be stored in the node itself */
+static size_t contentSize(xmlDictPtr dict, const xmlNodePtr node)
+{
+  if (node->content == (xmlChar*) &node->properties) {
+    return 0;
+  }
+  return stringSize(dict, node->content);
+}
+
+static void addAttributes(xmlDictPtr dict, const xmlNodePtr element, TixiDocumentStatistics* statistics)
+{
+  xmlAttrPtr attribute = NULL;
+  xmlNsPtr ns = NULL;
+
+  for (attribute = element->properties; attribute; attribute = attribute->next) {
+    xmlNodePtr value = NULL;
+
+    statistics->attributes++;
+    statistics->estimatedDOMBytes += sizeof(xmlAttr) + stringSize(dict, attribute->name);
+    for (value = attribute->children; value; value = value->next) {
+      statistics->estimatedDOMBytes += sizeof(xmlNode) + contentSize(dict, value);
+    }
+
+    if (xmlStrcmp(attribute->name, (const xmlChar*) CPACS_UID_ATTRIBUTE_STRING) == 0) {
+      statistics->uIDs++;
+    }
+    else if (xmlStrcmp(attribute->name, (const xmlChar*) EXTERNAL_DATA_XML_ATTR_FILENAME) == 0) {
+      statistics->externalIncludes++;
+    }
+  }
+
+  for (ns = element->nsDef; ns; ns = ns->next) {
+    statistics->estimatedDOMBytes += sizeof(xmlNs) + stringSize(NULL, ns->href) + stringSize(NULL, ns->prefix);
+  }
+}
+
+static void addNode(xmlDictPtr dict, const xmlNodePtr node, TixiDocumentStatistics* statistics)
+{
+  switch (node->type) {
+  case XML_ELEMENT_NODE:
+    statistics->elements++;
+    statistics->estimatedDOMBytes += sizeof(xmlNode) + stringSize(dict, node->name);
+    addAttributes(dict, node, statistics);
+
+    /* files referenced by externaldata elements, which are not included */
+    if (xmlStrcmp(node->name, (const xmlChar*) EXTERNAL_DATA_NODE_NAME) == 0) {
+      xmlNodePtr child = NULL;
+      for (child = node->children; child; child = child->next) {
+        if (child->type == XML_ELEMENT_NODE && xmlStrcmp(child->name, (const xmlChar*) EXTERNAL_DATA_NODE_NAME_FILENAME) == 0) {
+          statistics->externalIncludes++;
+        }
+      }
+    }
+    break;
+  case XML_TEXT_NODE:
+  case XML_CDATA_SECTION_NODE:
+    if (node->type == XML_TEXT_NODE) {
+      statistics->textNodes++;
+    }
+    else {
+      statistics->cdataNodes++;
+    }
+    statistics->textBytes += node->content ? (long long) strlen((const char*) node->content) : 0;
+    statistics->estimatedDOMBytes += sizeof(xmlNode) + contentSize(dict, node);
+    break;
+  case XML_COMMENT_NODE:
+    statistics->comments++;
+    statistics->estimatedDOMBytes += sizeof(xmlNode) + contentSize(dict, node);
+    break;
+  case XML_PI_NODE:
+    statistics->processingInstructions++;
+    statistics->estimatedDOMBytes += sizeof(xmlNode) + stringSize(dict, node->name) + contentSize(dict, node);
+    break;
+  default:
+    statistics->otherNodes++;
+    statistics->estimatedDOMBytes += sizeof(xmlNode);
+    break;
+  }
+}
+
+void statisticsGetDocument(const TixiDocument* document, TixiDocumentStatistics* statistics)
+{
+  xmlDocPtr xmlDocument = document->docPtr;
+  xmlDictPtr dict = xmlDocument->dict;
+  xmlNodePtr node = xmlDocument->children;
+  TixiMemoryListEntry* entry = NULL;
+  int depth = 1;
+
+  memset(statistics, 0, sizeof(TixiDocumentStatistics));
+  statistics->estimatedDOMBytes = sizeof(xmlDoc);
+
+  /* depth first traversal without recursion, the children of the document have depth 1 */
+  while (node) {
+    addNode(dict, node, statistics);
+    if (depth > statistics->maxDepth && node->type == XML_ELEMENT_NODE) {
+      statistics->maxDepth = depth;
+    }
+
+    if (node->type == XML_ELEMENT_NODE && node->children) {
+      node = node->children;
+      depth++;
+      continue;
+    }
+    while (node && !node->next) {
+      node = node->parent;
+      depth--;
+      if (node == (xmlNodePtr) xmlDocument) {
+        node = NULL;
+      }
+    }
+    if (node) {
+      node = node->next;
+    }
+  }
+
+  for (entry = document->memoryListHead; entry; entry = entry->next) {
+    statistics->memoryListEntries++;
+    statistics->memoryListBytes += (long long) (statisticsAllocatedSize(entry->memory) + sizeof(TixiMemoryListEntry));
+  }
+}
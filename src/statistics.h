@@ -0,0 +1,133 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_STATISTICS_H
+#define TIXI_STATISTICS_H
+
+#include "tixi.h"
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Optional instrumentation, enabled with the cmake option TIXI_ENABLE_STATISTICS.
+ *
+ * Each public function starts with STATISTICS_FUNCTION(), which counts the
+ * calls of the function and, with gcc and clang, measures the time spent in
+ * it (including the time of nested tixi calls). The per document counters are
+ * updated with STATISTICS_COUNT and STATISTICS_ADD. Without the option, all
+ * macros expand to nothing.
+ *
+ * The size and the memory of a document, see ::tixiGetDocumentStatistics,
+ * is computed with statisticsGetDocument independent of the option.
+ */
+
+typedef struct StatisticsFunction StatisticsFunction;
+struct StatisticsFunction
+{
+  const char* name;
+  volatile long long calls;
+  volatile long long nanoseconds;
+  volatile int registered;      /**< 1, if the function is in the list of called functions */
+  StatisticsFunction* next;
+};
+
+typedef struct
+{
+  StatisticsFunction* function;
+  long long start;
+} StatisticsCall;
+
+#ifdef TIXI_ENABLE_STATISTICS
+
+#if defined(__GNUC__) || defined(__clang__)
+#define STATISTICS_FUNCTION() \
+  static StatisticsFunction statisticsFunction_ = {__func__, 0, 0, 0, NULL}; \
+  StatisticsCall statisticsCall_ __attribute__((cleanup(statisticsLeave))) = statisticsEnter(&statisticsFunction_)
+#else
+/* no portable way to run code at the end of a function, only the calls are counted */
+#define STATISTICS_FUNCTION() \
+  static StatisticsFunction statisticsFunction_ = {__func__, 0, 0, 0, NULL}; \
+  statisticsEnter(&statisticsFunction_)
+#endif
+
+#define STATISTICS_COUNT(document, counter) \
+  do { if (document) { (document)->statistics.counter++; } } while (0)
+
+#define STATISTICS_ADD(document, counter, value) \
+  do { if (document) { (document)->statistics.counter += (value); } } while (0)
+
+#else
+
+#define STATISTICS_FUNCTION()
+#define STATISTICS_COUNT(document, counter) ((void) 0)
+#define STATISTICS_ADD(document, counter, value) ((void) 0)
+
+#endif
+
+/**
+ * @brief Counts a call of function and returns the start time of the call.
+ */
+TIXI_INTERNAL_EXPORT StatisticsCall statisticsEnter(StatisticsFunction* function);
+
+/**
+ * @brief Adds the time since statisticsEnter to the function of the call.
+ */
+TIXI_INTERNAL_EXPORT void statisticsLeave(StatisticsCall* call);
+
+/**
+ * @brief Returns the time of a monotonic clock in nanoseconds.
+ */
+TIXI_INTERNAL_EXPORT long long statisticsNanoseconds(void);
+
+/**
+ * @brief Returns the number of bytes allocated for a block returned by malloc, 0 if unknown.
+ */
+TIXI_INTERNAL_EXPORT size_t statisticsAllocatedSize(void* memory);
+
+/**
+ * @brief Adds the counters of a document to the totals, before the document is freed.
+ */
+TIXI_INTERNAL_EXPORT void statisticsAddClosedDocument(const TixiDocument* document);
+
+/**
+ * @brief Fills statistics with the counters of the document and all functions called so far.
+ *
+ * The array of functions is allocated with malloc and has to be released by the caller.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode statisticsGet(const TixiDocument* document, TixiStatistics* statistics);
+
+/**
+ * @brief Counts the nodes, uIDs, external files and the memory of a document.
+ */
+TIXI_INTERNAL_EXPORT void statisticsGetDocument(const TixiDocument* document, TixiDocumentStatistics* statistics);
+
+/**
+ * @brief Writes the function table and the totals of all closed documents as json.
+ *
+ * @return 0 on success
+ */
+TIXI_INTERNAL_EXPORT int statisticsWriteJson(const char* filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_STATISTICS_H
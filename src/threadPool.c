@@ -0,0 +1,163 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "threadPool.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+typedef struct
+{
+  ThreadPoolTask task;
+  void* data;
+  int nTasks;
+  int nextTask;
+#ifdef _WIN32
+  CRITICAL_SECTION mutex;
+#else
+  pthread_mutex_t mutex;
+#endif
+} ThreadPoolJob;
+
+static int takeTask(ThreadPoolJob* job)
+{
+  int index = -1;
+#ifdef _WIN32
+  EnterCriticalSection(&job->mutex);
+#else
+  pthread_mutex_lock(&job->mutex);
+#endif
+  if (job->nextTask < job->nTasks) {
+    index = job->nextTask++;
+  }
+#ifdef _WIN32
+  LeaveCriticalSection(&job->mutex);
+#else
+  pthread_mutex_unlock(&job->mutex);
+#endif
+  return index;
+}
+
+static void runTasks(ThreadPoolJob* job)
+{
+  int index;
+  while ((index = takeTask(job)) >= 0) {
+    job->task(job->data, index);
+  }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI workerMain(LPVOID job)
+{
+  runTasks((ThreadPoolJob*) job);
+  return 0;
+}
+#else
+static void* workerMain(void* job)
+{
+  runTasks((ThreadPoolJob*) job);
+  return NULL;
+}
+#endif
+
+int threadPoolDefaultSize(void)
+{
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (int) count : 1;
+#endif
+}
+
+void threadPoolRun(int nTasks, int nThreads, ThreadPoolTask task, void* data)
+{
+  ThreadPoolJob job;
+  int nWorkers = 0;
+  int i;
+#ifdef _WIN32
+  HANDLE* workers = NULL;
+#else
+  pthread_t* workers = NULL;
+#endif
+
+  if (nTasks <= 0) {
+    return;
+  }
+
+  if (nThreads <= 0) {
+    nThreads = threadPoolDefaultSize();
+  }
+  if (nThreads > nTasks) {
+    nThreads = nTasks;
+  }
+
+  job.task = task;
+  job.data = data;
+  job.nTasks = nTasks;
+  job.nextTask = 0;
+
+#ifdef _WIN32
+  InitializeCriticalSection(&job.mutex);
+#else
+  pthread_mutex_init(&job.mutex, NULL);
+#endif
+
+  /* the calling thread is one of the workers */
+  if (nThreads > 1) {
+    workers = malloc((nThreads - 1) * sizeof(*workers));
+  }
+  for (i = 0; workers && i < nThreads - 1; ++i) {
+#ifdef _WIN32
+    workers[nWorkers] = CreateThread(NULL, 0, workerMain, &job, 0, NULL);
+    if (workers[nWorkers]) {
+      nWorkers++;
+    }
+#else
+    if (pthread_create(&workers[nWorkers], NULL, workerMain, &job) == 0) {
+      nWorkers++;
+    }
+#endif
+  }
+
+  runTasks(&job);
+
+  for (i = 0; i < nWorkers; ++i) {
+#ifdef _WIN32
+    WaitForSingleObject(workers[i], INFINITE);
+    CloseHandle(workers[i]);
+#else
+    pthread_join(workers[i], NULL);
+#endif
+  }
+  free(workers);
+
+#ifdef _WIN32
+  DeleteCriticalSection(&job.mutex);
+#else
+  pthread_mutex_destroy(&job.mutex);
+#endif
+}
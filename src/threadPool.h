@@ -0,0 +1,53 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_THREADPOOL_H
+#define TIXI_THREADPOOL_H
+
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A task of a parallel job, called once for each index of the job
+ */
+typedef void (*ThreadPoolTask)(void* data, int index);
+
+/**
+ * @brief Returns the number of processors available to the process
+ */
+TIXI_INTERNAL_EXPORT int threadPoolDefaultSize(void);
+
+/**
+ * @brief Calls task(data, i) for all i in [0, nTasks) on up to nThreads threads
+ *        and returns after all tasks are finished.
+ *
+ * The calling thread works on the tasks as well, so that no thread is started
+ * for nThreads == 1. For nThreads <= 0, ::threadPoolDefaultSize threads are used.
+ * If threads cannot be started, the remaining tasks are run by the started ones.
+ * The order in which the tasks are run is not specified.
+ */
+TIXI_INTERNAL_EXPORT void threadPoolRun(int nTasks, int nThreads, ThreadPoolTask task, void* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_THREADPOOL_H
@@ -245,6 +245,16 @@ extern "C" {
 */
 typedef int TixiDocumentHandle;
 
+/**
+   Datatype for TixiSchemaHandle, a compiled XML schema as returned by ::tixiSchemaLoad.
+*/
+typedef int TixiSchemaHandle;
+
+/**
+   Datatype for TixiStylesheetHandle, a compiled XSLT stylesheet as returned by ::tixiStylesheetLoad.
+*/
+typedef int TixiStylesheetHandle;
+
 
 /**
   \defgroup Enums Enumerations
@@ -422,6 +432,133 @@ enum MessageType
 
 typedef enum MessageType MessageType;
 
+/**
+
+  \ingroup Enums
+       Flags selecting the contents of a ::TixiXPathResult in ::tixiXPathEvaluateAll.
+       The flags can be combined with a bitwise or.
+
+  Has a typedef to XPathResultFlags.
+    */
+enum XPathResultFlags
+{
+  XPATHRESULT_TEXTS = 1,             /*!< Retrieve the text content of each node */
+  XPATHRESULT_PATHS = 2,             /*!< Retrieve the XPath of each node        */
+  XPATHRESULT_NODETYPES = 4,         /*!< Retrieve the node type of each node    */
+  XPATHRESULT_ALL = 7                /*!< Retrieve all of the above              */
+};
+
+
+typedef enum XPathResultFlags XPathResultFlags;
+
+/**
+ * TixiXPathResult:
+ *
+ * Result of ::tixiXPathEvaluateAll. Each array has one entry per result node
+ * and is NULL, if it was not requested by the flags.
+ */
+struct TixiXPathResult
+{
+  int number;                        /*!< Number of nodes matching the xpath expression */
+  char** texts;                      /*!< Text content of each node, NULL for nodes without text */
+  char** paths;                      /*!< XPath of each node */
+  char** nodeTypes;                  /*!< Node type of each node, as returned by ::tixiGetNodeType */
+};
+
+typedef struct TixiXPathResult TixiXPathResult;
+
+/**
+ * TixiPathStep:
+ *
+ * Child step of a pre-split element path like "/a/b[2]/c", which is
+ * resolved without evaluating an XPath expression, see ::tixiCheckElementSteps.
+ * The path "/a/b[2]/c" consists of the steps {"a", 1, 0}, {"b", 1, 2} and {"c", 1, 0}.
+ */
+struct TixiPathStep
+{
+  const char* name;                  /*!< Qualified element name ("name" or "prefix:name"), not necessarily null terminated */
+  int nameLength;                    /*!< Number of characters of name */
+  int index;                         /*!< 1-based index among the equally named siblings, 0 for all of them */
+};
+
+typedef struct TixiPathStep TixiPathStep;
+
+/**
+ * TixiFunctionStatistics:
+ *
+ * Number of calls and total time of a public tixi function, see ::tixiGetStatistics.
+ */
+struct TixiFunctionStatistics
+{
+  const char* name;                  /*!< Name of the function, e.g. "tixiGetTextElement" */
+  long long calls;                   /*!< Number of calls in all threads */
+  double seconds;                    /*!< Total time spent in the function including nested tixi calls, 0 if not measured */
+};
+
+typedef struct TixiFunctionStatistics TixiFunctionStatistics;
+
+/**
+ * TixiStatistics:
+ *
+ * Counters of a document and the calls of all public functions, see ::tixiGetStatistics.
+ */
+struct TixiStatistics
+{
+  long long xpathEvaluations;        /*!< Number of evaluated XPath expressions */
+  long long xpathCacheHits;          /*!< Results taken from the XPath cache, see ::tixiSetCacheEnabled */
+  long long xpathCacheMisses;        /*!< Lookups of the enabled XPath cache that had to evaluate the expression */
+  long long childIndexHits;          /*!< Child lookups of an already indexed parent element */
+  long long childIndexMisses;        /*!< Parent elements that had to be indexed */
+  long long vectorCacheHits;         /*!< Vectors taken from the cache of parsed vectors */
+  long long vectorCacheMisses;       /*!< Vectors that had to be parsed */
+  long long memoryListEntries;       /*!< Number of memory blocks returned to the user and released by ::tixiCloseDocument */
+  long long memoryListBytes;         /*!< Total size of these memory blocks */
+  int nFunctions;                    /*!< Number of entries of functions */
+  TixiFunctionStatistics* functions; /*!< Public functions called so far, sorted by their total time */
+};
+
+typedef struct TixiStatistics TixiStatistics;
+
+/**
+ * TixiXPathProfileEntry:
+ *
+ * Evaluations of an XPath expression, see ::tixiGetXPathProfile.
+ */
+struct TixiXPathProfileEntry
+{
+  const char* expression;            /*!< The evaluated XPath expression */
+  int evaluations;                   /*!< Number of evaluations */
+  double seconds;                    /*!< Total time of all evaluations */
+  int nodes;                         /*!< Number of result nodes of the last evaluation */
+};
+
+typedef struct TixiXPathProfileEntry TixiXPathProfileEntry;
+
+/**
+ * TixiDocumentStatistics:
+ *
+ * Size and memory footprint of a document, see ::tixiGetDocumentStatistics.
+ */
+struct TixiDocumentStatistics
+{
+  int elements;                      /*!< Number of element nodes */
+  int attributes;                    /*!< Number of attributes */
+  int textNodes;                     /*!< Number of text nodes, including whitespace between elements */
+  int cdataNodes;                    /*!< Number of CDATA sections */
+  int comments;                      /*!< Number of comments */
+  int processingInstructions;        /*!< Number of processing instructions */
+  int otherNodes;                    /*!< Number of other nodes, e.g. the document type declaration */
+  int maxDepth;                      /*!< Maximum depth of an element, the root element has depth 1 */
+  long long textBytes;               /*!< Total length of the text nodes and CDATA sections in bytes */
+  int uIDs;                          /*!< Number of uID attributes */
+  int externalIncludes;              /*!< Number of external files, that are included or referenced by externaldata elements */
+  int memoryListEntries;             /*!< Number of memory blocks returned to the user, which are released with the document */
+  long long memoryListBytes;         /*!< Total size of these memory blocks, 0 if it cannot be determined on this platform */
+  long long estimatedDOMBytes;       /*!< Estimated memory of the libxml2 nodes and their strings */
+};
+
+typedef struct TixiDocumentStatistics TixiDocumentStatistics;
+
 /**
  * TixiPrintMsgFnc:
  * @param[in]  type The message type (error, warning, status)
@@ -458,6 +595,9 @@ DLL_EXPORT char* tixiGetVersion();
   if it is well formed. To validate the document against a XML-Schema
   or DTD use ::tixiSchemaValidateFromFile, ::tixiSchemaValidateFromString or ::tixiDTDValidate.
 
+  Compressed files are decompressed while reading: gzip files need the extension ".gz" (e.g.
+  "aircraft.xml.gz"), zstd files the extension ".zst", if TiXI is built with zstd support.
+  Multi-frame zstd files, as written by ::tixiSaveDocument, are decompressed in parallel.
 
   <b>Fortran syntax:</b>
 
@@ -490,6 +630,8 @@ DLL_EXPORT ReturnCode tixiOpenDocument (const char *xmlFilename, TixiDocumentHan
     - relative local directory: "file://relativeDirectory/" or "file://../anotherRelativeDirectory/"
     - remote http ressource: "http://www.someurl.de/"
 
+  Local external files may be gzip or zstd compressed (see ::tixiOpenDocument).
+
   Examples for the externaldata node:
   @code{.xml}
   <wings>
@@ -529,6 +671,33 @@ DLL_EXPORT ReturnCode tixiOpenDocument (const char *xmlFilename, TixiDocumentHan
  */
 DLL_EXPORT ReturnCode tixiOpenDocumentRecursive (const char *xmlFilename, TixiDocumentHandle * handle, OpenMode oMode);
 
+/**
+  @brief Opens an XML-file and validates it against an XML-schema while parsing.
+
+  In contrast to calling ::tixiOpenDocument and ::tixiSchemaValidate one after another,
+  the document is validated in the same pass in which it is parsed. Parsing stops at the
+  first validation error, such that large invalid files are rejected early and no
+  document is created for them. Default values of the schema are not inserted.
+
+  <b>Fortran syntax:</b>
+
+  tixi_open_document_with_schema( character*n xml_filename, integer schema_handle, integer handle, integer error )
+
+  @param[in]  xmlFilename  name of the XML-file to be opened
+  @param[in]  schemaHandle handle to the compiled schema as returned by ::tixiSchemaLoad.
+  @param[out] handle       handle to the XML-document. This handle is used in
+                           calls to other TIXI functions.
+
+  @return
+    - SUCCESS if successfully opened and validated the XML-file
+    - NOT_WELL_FORMED if opening the XML-file succeeds but test for
+                      well-formedness fails
+    - NOT_SCHEMA_COMPLIANT if the XML-file is not valid against the schema
+    - OPEN_FAILED if opening of the XML-file failed
+    - INVALID_HANDLE if schemaHandle is not valid
+ */
+DLL_EXPORT ReturnCode tixiOpenDocumentWithSchema (const char *xmlFilename, const TixiSchemaHandle schemaHandle, TixiDocumentHandle *handle);
+
 
 /**
   @brief Open an XML-file for reading from a http web resource.
@@ -554,6 +723,64 @@ DLL_EXPORT ReturnCode tixiOpenDocumentRecursive (const char *xmlFilename, TixiDo
  */
 DLL_EXPORT ReturnCode tixiOpenDocumentFromHTTP (const char *httpURL, TixiDocumentHandle * handle);
 
+/**
+  @brief Sets a local directory to cache documents downloaded via http or https.
+
+  Documents opened by ::tixiOpenDocumentFromHTTP and remote external data of
+  ::tixiOpenDocumentRecursive are stored in the cache directory, if the server
+  sends an ETag or Last-Modified header. Later downloads of these documents use
+  conditional requests (If-None-Match, If-Modified-Since) and read the document
+  from the cache, if it was not modified on the server.
+
+  Documents are stored by their content, such that identical documents of
+  different urls are stored once. The directory may be shared by several
+  processes, e.g. parallel jobs of a continuous integration system. Use
+  ::tixiSetHTTPCacheLimits to limit the size of the cache and to skip the
+  requests for recently validated documents.
+
+  The cache is disabled by default and by ::tixiCleanup.
+
+  <b>Fortran syntax:</b>
+
+  tixi_set_http_cache_directory( character*n cache_directory, integer error )
+
+  @param[in]  cacheDirectory path of the cache directory, which is created if it does
+                             not exist. NULL disables the cache.
+
+  @return
+    - SUCCESS if the cache directory was set
+    - FAILED if the directory cannot be created
+ */
+DLL_EXPORT ReturnCode tixiSetHTTPCacheDirectory (const char *cacheDirectory);
+
+/**
+  @brief Sets the limits of the HTTP cache set by ::tixiSetHTTPCacheDirectory.
+
+  If the cached documents exceed the maximum size, the least recently used
+  documents are removed from the cache directory.
+
+  Documents, that were downloaded or validated less than maxAge seconds ago,
+  are read from the cache without any request to the server. This allows
+  batch jobs to open the same remote documents repeatedly without network
+  access, but changes on the server are only seen after maxAge seconds.
+
+  By default and after ::tixiCleanup, the size is not limited and every
+  download is validated with the server (maxAge = 0).
+
+  <b>Fortran syntax:</b>
+
+  tixi_set_http_cache_limits( integer max_size_mb, integer max_age, integer error )
+
+  @param[in]  maxSizeMB maximum size of the cached documents in megabytes, 0 for no limit
+  @param[in]  maxAge    number of seconds, in which a downloaded document is used
+                        without validating it with the server
+
+  @return
+    - SUCCESS if the limits were set
+    - FAILED if maxSizeMB or maxAge is negative
+ */
+DLL_EXPORT ReturnCode tixiSetHTTPCacheLimits (int maxSizeMB, int maxAge);
+
 /**
 
   @brief Create an XML-document.
@@ -616,6 +843,11 @@ DLL_EXPORT ReturnCode tixiSetDocumentPath (TixiDocumentHandle handle, const char
   the main XML tree, please note that these files are saved back into the external files. The external
   nodes will not be removed from the main xml-document.
 
+  If xmlFilename (or the name of an external file) ends with ".gz" or ".zst", the file is
+  written gzip or zstd compressed. The document is split into blocks, which are compressed
+  in parallel (zstd files written this way are also decompressed in parallel). This applies to
+  ::tixiSaveCompleteDocument and ::tixiSaveAndRemoveDocument as well.
+
   <b>Fortran syntax:</b>
 
   tixi_save_document( integer  handle, character*n xml_filename, integer error )
@@ -876,6 +1108,92 @@ DLL_EXPORT ReturnCode tixiSchemaValidateWithDefaultsFromFile (const TixiDocument
  */
 DLL_EXPORT ReturnCode tixiSchemaValidateFromString (const TixiDocumentHandle handle, const char *xsdString);
 
+/**
+  @brief Loads and compiles an XML-schema for repeated validations.
+
+  Compiling a schema usually takes much longer than validating a document against it.
+  The returned schema handle can be used with ::tixiSchemaValidate for any number of
+  documents, until it is released by ::tixiSchemaFree.
+
+  Compiled schemas are cached by the absolute path and the modification time of
+  xsdFilename. Loading a schema again, which has not been modified since, returns the
+  same schema handle without parsing the file. Each successful call of this function
+  has to be matched by a call of ::tixiSchemaFree. The cache is also used by
+  ::tixiSchemaValidateFromFile and ::tixiSchemaValidateWithDefaultsFromFile, and it
+  is emptied by ::tixiCleanup.
+
+  <b>Fortran syntax:</b>
+
+  tixi_schema_load( character*n xsd_filename, integer schema_handle, integer error )
+
+  @param[in]  xsdFilename name of the XML-schema-file to be used.
+  @param[out] schemaHandle handle to the compiled schema.
+
+  @return
+    - SUCCESS              if the schema is successfully loaded
+    - OPEN_SCHEMA_FAILED   if opening of the XML-schema-file failed
+    - FAILED               if the schema is not valid or for all internal errors
+
+  @cond
+  #annotate out: 1#
+  @endcond
+ */
+DLL_EXPORT ReturnCode tixiSchemaLoad (const char *xsdFilename, TixiSchemaHandle *schemaHandle);
+
+/**
+  @brief Validate XML-document against a schema loaded by ::tixiSchemaLoad.
+
+  <b>Fortran syntax:</b>
+
+  tixi_schema_validate( integer handle, integer schema_handle, integer error )
+
+  @param[in]  handle handle to the XML-document.
+  @param[in]  schemaHandle handle to the compiled schema as returned by ::tixiSchemaLoad.
+
+  @return
+    - SUCCESS              if the document is successfully validated
+    - NOT_SCHEMA_COMPLIANT if validating against the given XML-schema fails
+    - INVALID_HANDLE       if handle or schemaHandle is not valid
+    - FAILED               for all internal errors
+ */
+DLL_EXPORT ReturnCode tixiSchemaValidate (const TixiDocumentHandle handle, const TixiSchemaHandle schemaHandle);
+
+/**
+  @brief Validate XML-document against a schema loaded by ::tixiSchemaLoad and insert
+         missing default elements and attributes.
+
+  <b>Fortran syntax:</b>
+
+  tixi_schema_validate_with_defaults( integer handle, integer schema_handle, integer error )
+
+  @param[in]  handle handle to the XML-document.
+  @param[in]  schemaHandle handle to the compiled schema as returned by ::tixiSchemaLoad.
+
+  @return
+    - SUCCESS              if the document is successfully validated
+    - NOT_SCHEMA_COMPLIANT if validating against the given XML-schema fails
+    - INVALID_HANDLE       if handle or schemaHandle is not valid
+    - FAILED               for all internal errors
+ */
+DLL_EXPORT ReturnCode tixiSchemaValidateWithDefaults (const TixiDocumentHandle handle, const TixiSchemaHandle schemaHandle);
+
+/**
+  @brief Releases a schema handle returned by ::tixiSchemaLoad.
+
+  The compiled schema stays in the cache, as long as the schema file is not modified.
+
+  <b>Fortran syntax:</b>
+
+  tixi_schema_free( integer schema_handle, integer error )
+
+  @param[in]  schemaHandle handle to the compiled schema as returned by ::tixiSchemaLoad.
+
+  @return
+    - SUCCESS              if the handle was released
+    - INVALID_HANDLE       if schemaHandle is not valid or has already been released
+ */
+DLL_EXPORT ReturnCode tixiSchemaFree (const TixiSchemaHandle schemaHandle);
+
 
 /**
   @brief Validate XML-document against a DTD.
@@ -946,6 +1264,81 @@ DLL_EXPORT ReturnCode tixiGetTextElement (const TixiDocumentHandle handle,
                                           const char *elementPath, char **text);
 
 
+/**
+  @brief Retrieve text content of an element without copying it.
+
+  Like ::tixiGetTextElement, but if the element contains only text, text points
+  directly to the text stored in the document. No memory is allocated in this case,
+  which makes the function suitable for reading many elements.
+
+  The text must neither be modified nor released by the user. It is only valid
+  until the element is changed or removed, or the document is closed.
+
+  <b>Fortran syntax:</b>
+
+  tixi_get_text_element_view( integer handle, character*n element_path,  character*n text, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive or ::tixiOpenDocumentFromHTTP
+
+  @param[in]  elementPath an XPath compliant path to an element in the document
+                    specified by handle (see section \ref XPathExamples above).
+
+  @param[out] text text content of the element specified by elementPath
+
+  @return
+    - SUCCESS if successfully retrieve the text content of a single element
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if elementPath is not a well-formed XPath-expression
+    - ELEMENT_NOT_FOUND if elementPath does not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if elementPath resolves not to a single element but to a list of elements
+ */
+DLL_EXPORT ReturnCode tixiGetTextElementView (const TixiDocumentHandle handle,
+                                              const char *elementPath, char **text);
+
+/**
+  @brief Checks if an element given by pre-split path steps exists.
+
+  The element path is given as the child steps from the document node, e.g. created
+  at compile time by the C++ binding. The steps are resolved directly without parsing
+  and evaluating an XPath expression. The element is the same as for the path
+  "/name[index]/...". Unlike ::tixiCheckElement, ELEMENT_PATH_NOT_UNIQUE is returned,
+  if the path matches several elements.
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument or ::tixiCreateDocument
+  @param[in]  steps the steps of the element path
+  @param[in]  nSteps number of steps, at least one
+
+  @return
+    - SUCCESS if the element exists and is unique
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if nSteps is not positive, a step is not a valid element name or uses an unknown namespace prefix
+    - ELEMENT_NOT_FOUND if the steps do not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if the steps resolve not to a single element but to a list of elements
+ */
+DLL_EXPORT ReturnCode tixiCheckElementSteps (const TixiDocumentHandle handle, const TixiPathStep *steps, int nSteps);
+
+/**
+  @brief Retrieves the text content of an element given by pre-split path steps without copying it.
+
+  Like ::tixiGetTextElementView, but the element is resolved from path steps as
+  described in ::tixiCheckElementSteps.
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument or ::tixiCreateDocument
+  @param[in]  steps the steps of the element path
+  @param[in]  nSteps number of steps
+  @param[out] text text content of the element
+
+  @return
+    - SUCCESS if successfully retrieve the text content of a single element
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if a step is not a valid element name or uses an unknown namespace prefix
+    - ELEMENT_NOT_FOUND if the steps do not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if the steps resolve not to a single element but to a list of elements
+ */
+DLL_EXPORT ReturnCode tixiGetTextElementViewSteps (const TixiDocumentHandle handle, const TixiPathStep *steps,
+                                                   int nSteps, char **text);
+
+
 /**
   @brief Retrieve integer content of an element.
 
@@ -1652,6 +2045,42 @@ DLL_EXPORT ReturnCode tixiAddFloatVector (const TixiDocumentHandle handle, const
 DLL_EXPORT ReturnCode tixiUpdateFloatVector (const TixiDocumentHandle handle, const char *path, const double *vector, const int numElements, const char* format);
 
 
+/**
+  @brief Stores large vectors of a document in a binary sidecar file.
+
+  Vectors with at least minElements values, which are added by ::tixiAddFloatVector or
+  ::tixiUpdateFloatVector, are not converted to text. The element is empty instead and
+  holds the number of values and their location in the attributes binarySize, binaryFile
+  and binaryOffset:
+
+  @code{.xml}
+  <aeroMap mapType="vector" binarySize="1000000" binaryFile="aircraft.xml.bin" binaryOffset="16"/>
+  @endcode
+
+  The values are written as little endian doubles into the file "<document file name>.bin"
+  when the document is saved, which has to be kept next to the document. ::tixiGetFloatVector,
+  ::tixiGetVectorSize and ::tixiGetArray read such vectors transparently from any document,
+  mapping the values directly from the file into memory without parsing them.
+
+  Other functions, e.g. ::tixiGetTextElement, ::tixiExportDocumentAsString or XSL
+  transformations, see the empty element only.
+
+  <b>Fortran syntax:</b>
+
+  tixi_set_binary_vector_threshold( integer handle, integer min_elements, integer error )
+
+  @param[in]  handle file handle as returned by ::tixiOpenDocument, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  minElements minimum number of values of a vector stored in binary form, 0 to store
+                          all vectors as text (default).
+
+  @return
+    - SUCCESS if successfully set the threshold
+    - INVALID_HANDLE if the handle is not valid
+    - FAILED if minElements is negative
+ */
+DLL_EXPORT ReturnCode tixiSetBinaryVectorThreshold (const TixiDocumentHandle handle, int minElements);
+
+
 /**
   @brief Creates an empty element.
 
@@ -1933,6 +2362,49 @@ DLL_EXPORT ReturnCode tixiGetNamedChildrenCount (const TixiDocumentHandle handle
 DLL_EXPORT ReturnCode tixiGetChildNodeName (const TixiDocumentHandle handle,
                                             const char *parentElementPath, int index, char **name);
 
+/**
+  @brief Returns the names of all child nodes beneath a given path in a single call.
+
+  In contrast to calling ::tixiGetChildNodeName for each index, the parent element is
+  resolved only once and the child nodes are traversed in a single pass. Optionally,
+  the XPath and the node type of each child node are returned as well.
+
+  The XPaths are built from parentElementPath, i.e. element children are addressed
+  as parentElementPath/name[i], text and CDATA nodes as parentElementPath/text()[i] and
+  comments as parentElementPath/comment()[i]. The node types are the same
+  strings as returned by ::tixiGetNodeType.
+
+  The memory of all returned arrays is allocated internally and must not be released
+  by the user. The deallocation is handled when the document referred to by handle is closed.
+
+  <b>Fortran syntax:</b>
+
+  tixi_get_child_node_list( integer handle, character*n parent_element_path, integer n_childs, character*n names, character*n xpaths, character*n node_types, integer error )
+
+  @param[in]  handle handle as returned by ::tixiCreateDocument, ::tixiOpenDocumentRecursive or ::tixiOpenDocumentFromHTTP
+  @param[in]  parentElementPath the path to the parent element in the document
+                                specified by handle (see section \ref XPathExamples above).
+  @param[out] nChilds Number of child nodes beneath the given parentElementPath.
+  @param[out] names   Array of child node names, as they would be returned by ::tixiGetChildNodeName.
+  @param[out] xpaths  Array of XPaths of the child nodes. May be NULL, if not required.
+  @param[out] nodeTypes Array of the node types of the child nodes. May be NULL, if not required.
+
+  @return
+    - SUCCESS if the child list was successfully retrieved
+    - FAILED if nChilds or names is NULL
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if parentElementPath is not a well-formed XPath-expression
+    - ELEMENT_NOT_FOUND if parentElementPath does not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if parentElementPath resolves not to a single element but
+                              to a list of elements
+
+  @cond
+  #annotate out: 2, 3A(2), 4A(2), 5A(2)#
+  @endcond
+*/
+DLL_EXPORT ReturnCode tixiGetChildNodeList (const TixiDocumentHandle handle, const char *parentElementPath, int *nChilds,
+                                            char ***names, char ***xpaths, char ***nodeTypes);
+
 /**
   @brief Returns the number of child elements beneath a given path.
 
@@ -2120,6 +2592,65 @@ DLL_EXPORT ReturnCode tixiGetTextAttribute (const TixiDocumentHandle handle,
                                             const char *elementPath, const char *attributeName,
                                             char **text);
 
+/**
+  @brief Retrieves value of an element's attribute as a string without copying it.
+
+  Like ::tixiGetTextAttribute, but text points directly to the value stored in
+  the document. The text must neither be modified nor released by the user. It
+  is only valid until the attribute is changed or removed, or the document is closed.
+
+  <b>Fortran syntax:</b>
+
+  tixi_get_text_attribute_view( integer  handle, character*n element_path, character*n attribute_name, character*n text, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument or ::tixiCreateDocument
+
+  @param[in]  elementPath an XPath compliant path to an element in the document
+                          specified by handle (see section \ref XPathExamples above).
+
+  @param[in]  attributeName name of the attribute. The name can also consist of a
+                            namespace prefix + ":" + the attribute name.
+
+  @param[out] text value of the specified attribute as a string
+
+  @return
+    - SUCCESS if successfully retrieve the value of the attribute
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if elementPath is not a well-formed XPath-expression
+    - ATTRIBUTE_NOT_FOUND if the element has no attribute attributeName
+    - ELEMENT_NOT_FOUND if elementPath does not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if elementPath resolves not to a single element but to a list of elements
+    - INVALID_NAMESPACE_PREFIX if the prefix in attributeName does not match to a namespace
+ */
+DLL_EXPORT ReturnCode tixiGetTextAttributeView (const TixiDocumentHandle handle,
+                                                const char *elementPath, const char *attributeName,
+                                                char **text);
+
+/**
+  @brief Retrieves the value of an attribute of an element given by pre-split path steps without copying it.
+
+  Like ::tixiGetTextAttributeView, but the element is resolved from path steps as
+  described in ::tixiCheckElementSteps.
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument or ::tixiCreateDocument
+  @param[in]  steps the steps of the element path
+  @param[in]  nSteps number of steps
+  @param[in]  attributeName name of the attribute. The name can also consist of a
+                            namespace prefix + ":" + the attribute name.
+  @param[out] text value of the specified attribute as a string
+
+  @return
+    - SUCCESS if successfully retrieve the value of the attribute
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - INVALID_XPATH if a step is not a valid element name or uses an unknown namespace prefix
+    - ATTRIBUTE_NOT_FOUND if the element has no attribute attributeName
+    - ELEMENT_NOT_FOUND if the steps do not point to a node in the XML-document
+    - ELEMENT_PATH_NOT_UNIQUE if the steps resolve not to a single element but to a list of elements
+    - INVALID_NAMESPACE_PREFIX if the prefix in attributeName does not match to a namespace
+ */
+DLL_EXPORT ReturnCode tixiGetTextAttributeViewSteps (const TixiDocumentHandle handle, const TixiPathStep *steps,
+                                                     int nSteps, const char *attributeName, char **text);
+
 /**
   @brief Retrieves value of an element's attribute as an integer.
 
@@ -2905,6 +3436,104 @@ DLL_EXPORT TixiPrintMsgFnc tixiGetPrintMsgFunc();
  */
 DLL_EXPORT ReturnCode tixiSetCacheEnabled(TixiDocumentHandle handle, int enabled);
 
+/**
+  @brief Returns the counters of a document and the number of calls and the time of all public functions.
+
+  The statistics are only collected, if tixi is built with the cmake option TIXI_ENABLE_STATISTICS,
+  which is off by default. The counters of the document start at zero when the document is opened
+  or created, the function table covers all documents and threads since the start of the process.
+  The time of the functions is only measured with gcc and clang, with other compilers only the
+  calls are counted.
+
+  If the environment variable TIXI_STATISTICS_FILE is set, ::tixiCleanup writes the function
+  table and the sum of the counters of all closed documents as json into this file.
+
+  The memory of the function table is allocated internally and must not be released
+  by the user. The deallocation is handled when the document referred to by handle is closed.
+
+  @param[in]  handle     handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[out] statistics The counters of the document and the function table
+
+  @return
+    - SUCCESS if the statistics were retrieved
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - FAILED if statistics is a null pointer, the function table cannot be allocated
+      or tixi is built without TIXI_ENABLE_STATISTICS
+ */
+DLL_EXPORT ReturnCode tixiGetStatistics(const TixiDocumentHandle handle, TixiStatistics* statistics);
+
+/**
+  @brief Returns the number of nodes, the maximum depth, the text size and the memory footprint of a document.
+
+  The numbers are computed by a single pass over all nodes of the document. They can be used
+  to decide, whether a document is small enough to be kept in memory, and to compare the
+  memory of different versions of a document.
+
+  The DOM memory is an estimate of the memory of the nodes, attributes, namespaces and strings
+  of libxml2 without the overhead of the allocator. Element and attribute names are usually
+  shared with the dictionary of libxml2 and only counted, if they are not.
+
+  @param[in]  handle     handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[out] statistics The statistics of the document
+
+  @return
+    - SUCCESS if the statistics were computed
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - FAILED if statistics is a null pointer
+ */
+DLL_EXPORT ReturnCode tixiGetDocumentStatistics(const TixiDocumentHandle handle, TixiDocumentStatistics* statistics);
+
+/**
+  @brief Starts or stops recording the XPath expressions evaluated for a document.
+
+  While profiling is enabled, tixi records the number of evaluations, the total time and the
+  number of result nodes of each XPath expression, see ::tixiGetXPathProfile. This helps to find
+  expensive queries, e.g. descendant queries like //wing[@uID="W1"]//section, which scan the
+  whole document. Paths, that are resolved without evaluating an XPath expression (e.g. simple
+  paths like /cpacs/vehicles/aircraft/model[1]) and results taken from the XPath cache
+  (see ::tixiSetCacheEnabled), are not recorded.
+
+  Enabling the profiling discards the previously recorded expressions, disabling it
+  releases them. Profiling is disabled by default.
+
+  <b>Fortran syntax:</b>
+
+  tixi_set_xpath_profiling( integer handle, integer enabled, integer error )
+
+  @param[in]  handle  handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  enabled 1 to start, 0 to stop the profiling
+
+  @return
+    - SUCCESS if the profiling was started or stopped
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - FAILED if the profile cannot be allocated
+ */
+DLL_EXPORT ReturnCode tixiSetXPathProfiling(const TixiDocumentHandle handle, int enabled);
+
+/**
+  @brief Returns the XPath expressions evaluated since ::tixiSetXPathProfiling, the slowest first.
+
+  The entries are sorted by the total time of their evaluations in descending order.
+
+  The memory of the returned array is allocated internally and must not be released
+  by the user. The deallocation is handled when the document referred to by handle is closed.
+
+  @param[in]  handle       handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[out] nExpressions Number of recorded expressions
+  @param[out] entries      Array of the recorded expressions
+
+  @return
+    - SUCCESS if the profile was retrieved
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist
+    - FAILED if an argument is a null pointer, profiling is not enabled or the
+      memory for the entries cannot be allocated
+
+  @cond
+  #annotate out: 1, 2A(1)#
+  @endcond
+ */
+DLL_EXPORT ReturnCode tixiGetXPathProfile(const TixiDocumentHandle handle, int* nExpressions, TixiXPathProfileEntry** entries);
+
 /**@}*/
 
 /**
@@ -3015,6 +3644,87 @@ DLL_EXPORT ReturnCode tixiGetVectorSize (const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiGetFloatVector (const TixiDocumentHandle handle, const char *vectorPath,
                                           double **vectorArray, const int eNumber);
 
+/**
+  @brief Copies the values of a vector into an array provided by the caller.
+
+  Like ::tixiGetFloatVector, but the first eNumber values are written into values,
+  which must hold at least eNumber elements. No memory is allocated by tixi, so
+  the function can be called repeatedly with the same array, e.g. in every time step
+  of a simulation. The Fortran 2003 binding passes a Fortran array by reference.
+
+  <b>Fortran syntax:</b>
+
+  tixiGetFloatVectorValues( integer handle, character*n vectorPath, real*8 values(eNumber), integer eNumber )
+
+  @param[in]  handle file handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  vectorPath an XPath compliant path to an element holding the vector in
+                         the document specified by handle (see section \ref XPathExamples).
+  @param[out] values array of at least eNumber elements receiving the values
+  @param[in]  eNumber number of values to read
+
+  @return
+    - SUCCESS if successfully read the vector
+    - FAILED internal error or values is NULL
+    - INVALID_HANDLE if the handle is not valid
+    - INVALID_XPATH if vectorPath is not a well-formed XPath-expression
+    - ELEMENT_PATH_NOT_UNIQUE if vectorPath resolves not to a single element but to a list of elements
+    - ELEMENT_NOT_FOUND if vectorPath points to a non-existing element
+    - INDEX_OUT_OF_RANGE if the vector has less than eNumber values
+    - NO_NUMBER if one of the first eNumber values is not a number
+
+  @cond
+  #annotate out: 2AM# values has to be preallocated with eNumber elements
+  @endcond
+    */
+DLL_EXPORT ReturnCode tixiGetFloatVectorValues (const TixiDocumentHandle handle, const char *vectorPath,
+                                                double *values, const int eNumber);
+
+
+/**
+  @brief Reads the coordinates of a list of point elements at once.
+
+  The XPath expression pointsPath is evaluated once and the coordinates of the first
+  nPoints result elements are written into the arrays x, y and z, which are provided
+  by the caller. Each point element is expected to have the structure read by ::tixiGetPoint:
+
+  @verbatim
+    <point>
+      <x>1.0</x>
+      <y>2.0</y>
+      <z>3.0</z>
+    </point>
+  @endverbatim
+
+  Like in ::tixiGetPoint, coordinates that are missing are unchanged on output.
+  The number of points can be determined by ::tixiXPathEvaluateNodeNumber.
+
+  <b>Fortran syntax:</b>
+
+  tixiGetPointList( integer handle, character*n pointsPath, real*8 x(nPoints), real*8 y(nPoints), real*8 z(nPoints), integer nPoints )
+
+  @param[in]  handle file handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  pointsPath an XPath expression selecting the point elements, e.g. "/cpacs/pointList/point"
+  @param[out] x array of at least nPoints elements receiving the x coordinates
+  @param[out] y array of at least nPoints elements receiving the y coordinates
+  @param[out] z array of at least nPoints elements receiving the z coordinates
+  @param[in]  nPoints number of points to read
+
+  @return
+    - SUCCESS if successfully read the points
+    - FAILED if one of the arrays is NULL
+    - INVALID_HANDLE if the handle is not valid
+    - INVALID_XPATH if pointsPath is not a well-formed XPath-expression
+    - ELEMENT_NOT_FOUND if pointsPath does not match any node
+    - NOT_AN_ELEMENT if pointsPath matches nodes that are no elements
+    - INDEX_OUT_OF_RANGE if pointsPath matches less than nPoints elements
+
+  @cond
+  #annotate out: 2AM, 3AM, 4AM# the coordinate arrays have to be preallocated with nPoints elements
+  @endcond
+    */
+DLL_EXPORT ReturnCode tixiGetPointList (const TixiDocumentHandle handle, const char *pointsPath,
+                                        double *x, double *y, double *z, const int nPoints);
+
 
 /**
   @brief Retrieves the number of dimensions of an Array.
@@ -3502,6 +4212,201 @@ DLL_EXPORT ReturnCode tixiXSLTransformationToString(TixiDocumentHandle handle, c
  */
 DLL_EXPORT ReturnCode tixiXSLTransformationToFile(TixiDocumentHandle handle, const char *xslFilename, const char *resultFilename);
 
+/**
+  @brief Performs a XML transformation and opens the result as a new document.
+
+  In contrast to ::tixiXSLTransformationToString followed by ::tixiImportFromString,
+  the resulting document is used directly without serializing and parsing it again.
+  The new document has to be closed with ::tixiCloseDocument.
+
+  <b>Fortran syntax:</b>
+
+  tixi_xsl_transformation_to_document( integer handle, character*n xsl_filename, integer result_handle, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  xslFilename The name of a local file with XSL mapping informations.
+  @param[out] resultHandle Handle to the resulting document of the transformation.
+  @return
+    - SUCCESS if successful
+    - INVALID_HANDLE if handle is not valid
+    - OPEN_FAILED if the stylesheet file does not exist
+    - FAILED  if the stylesheet cannot be parsed, the transformation failed or
+              its result is not an XML document (e.g. for the output method "text")
+ */
+DLL_EXPORT ReturnCode tixiXSLTransformationToDocument(TixiDocumentHandle handle, const char *xslFilename, TixiDocumentHandle *resultHandle);
+
+/**
+  @brief Performs a XML transformation with stylesheet parameters and opens the result as a new document.
+
+  The parameter values are passed to the stylesheet as strings, i.e. they are not
+  evaluated as XPath expressions. Parameters not declared in the stylesheet are ignored.
+
+  <b>Fortran syntax:</b>
+
+  tixi_xsl_transformation_to_document_with_params( integer handle, character*n xsl_filename, character*n param_names, character*n param_values, integer n_params, integer result_handle, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  xslFilename The name of a local file with XSL mapping informations.
+  @param[in]  paramNames Array of the names of the stylesheet parameters (top level xsl:param elements).
+  @param[in]  paramValues Array of the values of the stylesheet parameters.
+  @param[in]  nParams Number of stylesheet parameters.
+  @param[out] resultHandle Handle to the resulting document of the transformation.
+  @return
+    - SUCCESS if successful
+    - INVALID_HANDLE if handle is not valid
+    - OPEN_FAILED if the stylesheet file does not exist
+    - FAILED  if the stylesheet cannot be parsed, a parameter is NULL, the transformation
+              failed or its result is not an XML document
+
+  @cond
+  #annotate in: 2A(4), 3A(4) out: 5#
+  @endcond
+ */
+DLL_EXPORT ReturnCode tixiXSLTransformationToDocumentWithParams(TixiDocumentHandle handle, const char *xslFilename,
+                                                                const char **paramNames, const char **paramValues, int nParams,
+                                                                TixiDocumentHandle *resultHandle);
+
+/**
+  @brief Loads and compiles an XSLT stylesheet for repeated transformations.
+
+  The returned stylesheet handle can be used with ::tixiStylesheetTransformToString and
+  ::tixiStylesheetTransformToFile for any number of documents, until it is released by
+  ::tixiStylesheetFree.
+
+  Compiled stylesheets are cached by the absolute path and the modification time of
+  xslFilename. Loading a stylesheet again, which has not been modified since, returns the
+  same handle without parsing the file. Each successful call of this function has to be
+  matched by a call of ::tixiStylesheetFree. The cache is also used by
+  ::tixiXSLTransformationToString and ::tixiXSLTransformationToFile, and it is emptied
+  by ::tixiCleanup.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_load( character*n xsl_filename, integer stylesheet_handle, integer error )
+
+  @param[in]  xslFilename The name of a local file with XSL mapping informations.
+  @param[out] stylesheetHandle handle to the compiled stylesheet.
+  @return
+    - SUCCESS if successful
+    - OPEN_FAILED if the file does not exist
+    - FAILED if the stylesheet cannot be parsed
+
+  @cond
+  #annotate out: 1#
+  @endcond
+ */
+DLL_EXPORT ReturnCode tixiStylesheetLoad(const char *xslFilename, TixiStylesheetHandle *stylesheetHandle);
+
+/**
+  @brief Performs a XML transformation with a stylesheet loaded by ::tixiStylesheetLoad.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_transform_to_string( integer handle, integer stylesheet_handle, character*n result_text, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  stylesheetHandle handle to the compiled stylesheet as returned by ::tixiStylesheetLoad.
+  @param[out] resultText The resulting document of the transformation.
+  @return
+    - SUCCESS if successful
+    - INVALID_HANDLE if handle or stylesheetHandle is not valid
+    - FAILED  if the transformation failed
+ */
+DLL_EXPORT ReturnCode tixiStylesheetTransformToString(TixiDocumentHandle handle, const TixiStylesheetHandle stylesheetHandle, char **resultText);
+
+/**
+  @brief Performs a XML transformation with a stylesheet loaded by ::tixiStylesheetLoad
+         and saves the result to resultFilename.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_transform_to_file( integer handle, integer stylesheet_handle, character*n result_filename, integer error )
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  stylesheetHandle handle to the compiled stylesheet as returned by ::tixiStylesheetLoad.
+  @param[in]  resultFilename The name of a local file to store the resulting XML document in.
+  @return
+    - SUCCESS if successful
+    - INVALID_HANDLE if handle or stylesheetHandle is not valid
+    - FAILED  if the transformation failed
+ */
+DLL_EXPORT ReturnCode tixiStylesheetTransformToFile(TixiDocumentHandle handle, const TixiStylesheetHandle stylesheetHandle, const char *resultFilename);
+
+/**
+  @brief Transforms several documents in parallel with a stylesheet loaded by ::tixiStylesheetLoad
+         and opens the results as new documents.
+
+  The transformations run on up to nThreads threads, which share the compiled stylesheet.
+  Messages of failed transformations may be reported from these threads. The documents
+  must not be used by other threads during the call.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_transform_documents( integer stylesheet_handle, integer handles, integer n_documents, integer n_threads, integer result_handles, integer error )
+
+  @param[in]  stylesheetHandle handle to the compiled stylesheet as returned by ::tixiStylesheetLoad.
+  @param[in]  handles Array of handles to the documents to be transformed.
+  @param[in]  nDocuments Number of documents.
+  @param[in]  nThreads Maximum number of threads, a value <= 0 uses one thread per processor.
+  @param[out] resultHandles Array of size nDocuments, which receives the handles to the resulting documents.
+                            The handle is -1 for each failed transformation. All other documents
+                            have to be closed with ::tixiCloseDocument, also if an error is returned.
+  @return
+    - SUCCESS if all transformations were successful
+    - INVALID_HANDLE if stylesheetHandle or one of the document handles is not valid,
+                     in that case no transformation is performed and all result handles are -1
+    - FAILED  if at least one transformation failed
+ */
+DLL_EXPORT ReturnCode tixiStylesheetTransformDocuments(const TixiStylesheetHandle stylesheetHandle, const TixiDocumentHandle *handles,
+                                                       int nDocuments, int nThreads, TixiDocumentHandle *resultHandles);
+
+/**
+  @brief Transforms several XML files in parallel with a stylesheet loaded by ::tixiStylesheetLoad
+         and saves the results.
+
+  The transformations run on up to nThreads threads, which share the compiled stylesheet.
+  Messages of failed transformations may be reported from these threads. In contrast to
+  ::tixiOpenDocument, external data of the input files is not included.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_transform_files( integer stylesheet_handle, character*n input_filenames, character*n output_filenames, integer n_files, integer n_threads, integer error )
+
+  @param[in]  stylesheetHandle handle to the compiled stylesheet as returned by ::tixiStylesheetLoad.
+  @param[in]  inputFilenames Array of the names of the XML files to be transformed.
+  @param[in]  outputFilenames Array of the names of the files the results are written to. The names must be distinct.
+  @param[in]  nFiles Number of files.
+  @param[in]  nThreads Maximum number of threads, a value <= 0 uses one thread per processor.
+  @return
+    - SUCCESS if all transformations were successful
+    - INVALID_HANDLE if stylesheetHandle is not valid
+    - OPEN_FAILED if an input file could not be opened
+    - NOT_WELL_FORMED if an input file is not well formed
+    - FAILED  if a transformation failed or its result could not be written
+
+  @cond
+  #annotate in: 1A(3), 2A(3)#
+  @endcond
+ */
+DLL_EXPORT ReturnCode tixiStylesheetTransformFiles(const TixiStylesheetHandle stylesheetHandle, const char **inputFilenames,
+                                                   const char **outputFilenames, int nFiles, int nThreads);
+
+/**
+  @brief Releases a stylesheet handle returned by ::tixiStylesheetLoad.
+
+  The compiled stylesheet stays in the cache, as long as the stylesheet file is not modified.
+
+  <b>Fortran syntax:</b>
+
+  tixi_stylesheet_free( integer stylesheet_handle, integer error )
+
+  @param[in]  stylesheetHandle handle to the compiled stylesheet as returned by ::tixiStylesheetLoad.
+  @return
+    - SUCCESS if the handle was released
+    - INVALID_HANDLE if stylesheetHandle is not valid or has already been released
+ */
+DLL_EXPORT ReturnCode tixiStylesheetFree(const TixiStylesheetHandle stylesheetHandle);
+
 
 /**@}*/
 /**
@@ -3543,6 +4448,38 @@ DLL_EXPORT ReturnCode tixiXPathEvaluateNodeNumber(TixiDocumentHandle handle, con
  */
 DLL_EXPORT ReturnCode tixiXPathExpressionGetXPath(TixiDocumentHandle handle, const char *xPathExpression, int index, char** xPath);
 
+/**
+  @brief Evaluates a XPath expression once and returns the texts, XPaths and node types of all result nodes.
+
+  Scripts enumerating all results of an expression, e.g. all //@uID, would otherwise call
+  ::tixiXPathExpressionGetTextByIndex and ::tixiXPathExpressionGetXPath for each index. This
+  function collects everything requested by flags in a single pass over the result nodes.
+
+  The text of an element is the concatenation of its direct text children with the special
+  characters escaped as entities (e.g. "&amp;"), as returned by ::tixiXPathExpressionGetTextByIndex;
+  the text of attributes, text nodes and comments is their unescaped value.
+  The XPaths are generated from the result nodes directly. Each element is addressed by its
+  uID, e.g. /cpacs/vehicles/aircraft/model[@uID="D150"], or, if it has no uID, by its position
+  among equally named siblings, e.g. /root/list/item[3]. Attributes are returned as the path of
+  their element followed by /@name, text nodes and comments by /text()[i] and /comment()[i].
+  The node types are the same strings as returned by ::tixiGetNodeType.
+
+  The memory of the returned arrays is allocated internally and must not be released
+  by the user. The deallocation is handled when the document referred to by handle is closed.
+
+  @param[in]  handle handle as returned by ::tixiOpenDocument, ::tixiOpenDocumentRecursive, ::tixiOpenDocumentFromHTTP, ::tixiCreateDocument or ::tixiImportFromString
+  @param[in]  xPathExpression The XPath Expression to evaluate.
+  @param[in]  flags Combination of ::XPathResultFlags selecting the arrays to fill.
+  @param[out] result The number of result nodes and the requested arrays. Arrays not requested are NULL.
+
+  @return
+    - SUCCESS if the result was successfully retrieved.
+    - INVALID_HANDLE if the handle is not valid, i.e.  does not or no longer exist.
+    - INVALID_XPATH if the xpath expression could not be evaluated or does not result in a node set.
+    - FAILED  if result is NULL or an internal error occured.
+ */
+DLL_EXPORT ReturnCode tixiXPathEvaluateAll(TixiDocumentHandle handle, const char *xPathExpression, int flags, TixiXPathResult* result);
+
 /**
   @brief Evaluates a XPath expression and returns the text content of the resultnode matching this xpath expression.
 
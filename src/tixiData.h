@@ -130,6 +130,25 @@ struct TixiUIDListEntry
   TixiUIDListEntry* next;        /**< Pointer to next entry in the list */
 };
 
+typedef struct BinaryVectorStore BinaryVectorStore;
+typedef struct XPathProfile XPathProfile;
+
+/**
+ * @brief Counters of a document, only updated if tixi is built with TIXI_ENABLE_STATISTICS.
+ */
+typedef struct
+{
+  long long xpathEvaluations;   /**< Number of evaluated XPath expressions */
+  long long xpathCacheHits;     /**< Results taken from the XPath cache */
+  long long xpathCacheMisses;   /**< Lookups of the enabled XPath cache, that had to evaluate the expression */
+  long long childIndexHits;     /**< Lookups of an already indexed parent node */
+  long long childIndexMisses;   /**< Parent nodes, that had to be indexed */
+  long long vectorCacheHits;    /**< Vectors taken from the vector cache */
+  long long vectorCacheMisses;  /**< Vectors, that had to be parsed */
+  long long memoryListEntries;  /**< Number of memory blocks added to the memory list */
+  long long memoryListBytes;    /**< Bytes of the memory blocks added to the memory list */
+} DocumentStatistics;
+
 typedef struct
 {
   xmlChar* xpath;
@@ -159,6 +178,11 @@ typedef struct
   TixiUIDListEntry* uidListHead;       /**< Pointer to the head of the list of uids */
   xmlXPathContextPtr xpathContext;     /**< Pointer to the XPath Context */
   XPathCache* xpathCache;              /**< Pointer to the XPath Cache */
+  xmlHashTablePtr childIndex;          /**< Lazily built index of named children per parent node, see childIndex.h */
+  xmlHashTablePtr vectorCache;         /**< Parsed values of vector elements, see vectorCache.h */
+  BinaryVectorStore* binaryVectors;    /**< Binary vector settings, buffers and file mappings, see binaryVector.h */
+  DocumentStatistics statistics;       /**< Counters for ::tixiGetStatistics, see statistics.h */
+  XPathProfile* xpathProfile;          /**< Evaluated XPath expressions, NULL if profiling is off, see xpathProfile.h */
 } TixiDocument;
 
 typedef struct TixiDocumentListEntry TixiDocumentListEntry;
@@ -36,12 +36,21 @@
 #include "tixiInternal.h"
 #include "xslTransformation.h"
 #include "webMethods.h"
+#include "httpCache.h"
 #include "uidHelper.h"
 #include "xpathFunctions.h"
 #include "tixiUtils.h"
 #include "tixi.h"
 #include "tixi_version.h"
 #include "namespaceFunctions.h"
+#include "childIndex.h"
+#include "schemaCache.h"
+#include "compression.h"
+#include "binaryVector.h"
+#include "vectorCache.h"
+#include "tixiMutex.h"
+#include "statistics.h"
+#include "xpathProfile.h"
 
 static xmlNsPtr nameSpace = NULL;
 
@@ -123,12 +132,20 @@ void xmlErrorHandler(void * ctx, const char *message, ...) {
 
 static void tixiInit(void)
 {
+  static TixiMutex initMutex = TIXI_MUTEX_INIT;
+
+  /* documents may be opened from several threads at the same time */
+  tixiMutexLock(&initMutex);
   if (!_initialized) {
     printMsg(MESSAGETYPE_STATUS, "TiXI initialized\n");
+    /* the global state of libxml2 has to be initialized before it is used by several threads */
+    xmlInitParser();
     xmlSetGenericErrorFunc(NULL, xmlErrorHandler);
     xsltSetGenericErrorFunc(NULL, xmlErrorHandler);
     _initialized = 1;
   }
+  compressionInit();
+  tixiMutexUnlock(&initMutex);
 }
 
 
@@ -137,6 +154,7 @@ static void tixiInit(void)
 */
 DLL_EXPORT char* tixiGetVersion()
 {
+  STATISTICS_FUNCTION();
   static char version[] = TIXI_VERSION_STRING;
   return version;
 }
@@ -263,8 +281,9 @@ void printError(ReturnCode error, char *function)
 
 /**
  *  Opens the file and sets up the TixiDocument datastructure.
+ *  If schema is not NULL, the file is validated against it while parsing.
  */
-DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDocumentHandle *handle, OpenMode oMode)
+static ReturnCode openDocument(const char *xmlFilename, xmlSchemaPtr schema, TixiDocumentHandle *handle, OpenMode oMode)
 {
   /* this opens the XML-file and checks if it is well formed */
 
@@ -290,7 +309,15 @@ DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDoc
     fclose(file);
   }
 
-  xmlDocument = xmlReadFile(xmlFilename, NULL, XML_PARSE_HUGE);
+  if (schema) {
+    returnValue = readDocumentWithSchema(xmlFilename, schema, &xmlDocument);
+    if (returnValue != SUCCESS) {
+      return returnValue;
+    }
+  }
+  else {
+    xmlDocument = xmlReadFile(xmlFilename, NULL, XML_PARSE_HUGE);
+  }
 
   if (xmlDocument) {
 
@@ -301,7 +328,7 @@ DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDoc
     document->validationFilename = NULL;
     document->docPtr = xmlDocument;
     document->currentNode = NULL;
-    document->isValid = UNDEFINED;
+    document->isValid = schema ? VALID : UNDEFINED;
     document->status = OPENED;
     document->memoryListHead = NULL;
     document->memoryListTail = NULL;
@@ -310,6 +337,14 @@ DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDoc
     document->uidListHead = NULL;
     document->xpathContext = xmlXPathNewContext(xmlDocument);
     document->xpathCache = XPathNewCache();
+    document->childIndex = NULL;
+    document->vectorCache = NULL;
+    document->binaryVectors = NULL;
+    document->xpathProfile = NULL;
+    memset(&document->statistics, 0, sizeof(DocumentStatistics));
+    if (document->xpathContext) {
+      document->xpathContext->user = document;
+    }
     addDocumentToList(document, &(document->handle));
     *handle = document->handle;
     returnValue = SUCCESS; /*?*/
@@ -335,35 +370,121 @@ DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDoc
 }
 
 
+DLL_EXPORT ReturnCode tixiOpenDocumentRecursive(const char *xmlFilename, TixiDocumentHandle *handle, OpenMode oMode)
+{
+  STATISTICS_FUNCTION();
+  return openDocument(xmlFilename, NULL, handle, oMode);
+}
+
+
 DLL_EXPORT ReturnCode tixiOpenDocument(const char *xmlFilename, TixiDocumentHandle *handle)
 {
+  STATISTICS_FUNCTION();
   return tixiOpenDocumentRecursive(xmlFilename, handle, OPENMODE_PLAIN);
 }
 
 
+DLL_EXPORT ReturnCode tixiOpenDocumentWithSchema(const char *xmlFilename, const TixiSchemaHandle schemaHandle, TixiDocumentHandle *handle)
+{
+  STATISTICS_FUNCTION();
+  ReturnCode error = SUCCESS;
+  /* the reference keeps the schema alive, if the handle is freed during the parsing */
+  xmlSchemaPtr schema = schemaCacheAcquire(schemaHandle);
+
+  if (!schema) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid schema handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = openDocument(xmlFilename, schema, handle, OPENMODE_PLAIN);
+  schemaCacheRelease(schemaHandle);
+  return error;
+}
+
+
+
+/**
+ * Creates a new tixi document without a file for an xml document, which is owned by the new document afterwards
+ */
+static void addInMemoryDocument(xmlDocPtr xmlDocument, TixiDocumentHandle * handle)
+{
+  TixiDocument *document = (TixiDocument *) malloc(sizeof(TixiDocument));
+  document->xmlFilename = NULL;
+  document->dirname = NULL;
+  document->filename = NULL;
+  document->validationFilename = NULL;
+  document->docPtr = xmlDocument;
+  document->currentNode = NULL;
+  document->isValid = UNDEFINED;
+  document->status = OPENED;
+  document->memoryListHead = NULL;
+  document->memoryListTail = NULL;
+  document->hasIncludedExternalFiles = 1;
+  document->usePrettyPrint = 1;
+  document->uidListHead = NULL;
+  document->xpathContext = xmlXPathNewContext(xmlDocument);
+  document->xpathCache = XPathNewCache();
+  document->childIndex = NULL;
+  document->vectorCache = NULL;
+  document->binaryVectors = NULL;
+  document->xpathProfile = NULL;
+  memset(&document->statistics, 0, sizeof(DocumentStatistics));
+  if (document->xpathContext) {
+    document->xpathContext->user = document;
+  }
+  addDocumentToList(document, &(document->handle));
+  *handle = document->handle;
+}
 
 DLL_EXPORT ReturnCode tixiOpenDocumentFromHTTP (const char *httpURL, TixiDocumentHandle *handle)
 {
-  char* xmlDocument = NULL;
+  STATISTICS_FUNCTION();
+  xmlDocPtr xmlDocument = NULL;
   ReturnCode returnCode = FAILED;
 
   tixiInit();
   xmlKeepBlanksDefault(0);
   xmlIndentTreeOutput = 1;
 
-  xmlDocument = curlGetURLInMemory(httpURL);
-  if(xmlDocument == NULL) {
-    return OPEN_FAILED;
+  /* the document is parsed while it is downloaded */
+  returnCode = curlGetURLAsDocument(httpURL, XML_PARSE_HUGE, &xmlDocument);
+  if (returnCode == NOT_WELL_FORMED) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Document %s is not wellformed!\n", httpURL);
+  }
+  if (returnCode != SUCCESS) {
+    return returnCode;
+  }
+
+  addInMemoryDocument(xmlDocument, handle);
+  return SUCCESS;
+}
+
+
+DLL_EXPORT ReturnCode tixiSetHTTPCacheDirectory(const char *cacheDirectory)
+{
+  STATISTICS_FUNCTION();
+  tixiInit();
+  return httpCacheSetDirectory(cacheDirectory);
+}
+
+
+DLL_EXPORT ReturnCode tixiSetHTTPCacheLimits(int maxSizeMB, int maxAge)
+{
+  STATISTICS_FUNCTION();
+  if (maxSizeMB < 0 || maxAge < 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid HTTP cache limits in tixiSetHTTPCacheLimits.\n");
+    return FAILED;
   }
 
-  returnCode = tixiImportFromString(xmlDocument, handle);
-  free(xmlDocument);
-  return returnCode;
+  tixiInit();
+  httpCacheSetLimits((long long) maxSizeMB * 1024 * 1024, maxAge);
+  return SUCCESS;
 }
 
 
 DLL_EXPORT ReturnCode tixiCreateDocument(const char *rootElementName, TixiDocumentHandle *handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = NULL;
   xmlDocPtr xmlDocument = NULL;
   xmlNodePtr rootNode = NULL;
@@ -414,6 +535,14 @@ DLL_EXPORT ReturnCode tixiCreateDocument(const char *rootElementName, TixiDocume
   document->uidListHead = NULL;
   document->xpathContext = xmlXPathNewContext(xmlDocument);
   document->xpathCache = XPathNewCache();
+  document->childIndex = NULL;
+  document->vectorCache = NULL;
+  document->binaryVectors = NULL;
+  document->xpathProfile = NULL;
+  memset(&document->statistics, 0, sizeof(DocumentStatistics));
+  if (document->xpathContext) {
+    document->xpathContext->user = document;
+  }
 
   if (addDocumentToList(document, &(document->handle)) != SUCESS) {
     printMsg(MESSAGETYPE_ERROR, "Error: Failed  adding document to document list.");
@@ -426,6 +555,7 @@ DLL_EXPORT ReturnCode tixiCreateDocument(const char *rootElementName, TixiDocume
 
 DLL_EXPORT ReturnCode tixiGetDocumentPath(TixiDocumentHandle handle, char** documentPath)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = NULL;
 
   if (!documentPath) {
@@ -446,6 +576,7 @@ DLL_EXPORT ReturnCode tixiGetDocumentPath(TixiDocumentHandle handle, char** docu
 
 DLL_EXPORT ReturnCode tixiSetDocumentPath(TixiDocumentHandle handle, const char* xmlFilename)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = NULL;
 
   if (!xmlFilename) {
@@ -472,6 +603,7 @@ Distinguish internal/user/fatal errors!!!
 */
 DLL_EXPORT ReturnCode tixiSaveDocument(TixiDocumentHandle handle, const char *xmlFilename)
 {
+  STATISTICS_FUNCTION();
   return saveDocument(handle, xmlFilename, SPLITTED);
 }
 
@@ -479,18 +611,21 @@ DLL_EXPORT ReturnCode tixiSaveDocument(TixiDocumentHandle handle, const char *xm
 
 DLL_EXPORT ReturnCode tixiSaveCompleteDocument(TixiDocumentHandle handle, const char *xmlFilename)
 {
+  STATISTICS_FUNCTION();
   return saveDocument(handle, xmlFilename, COMPLETE);
 }
 
 
 DLL_EXPORT ReturnCode tixiSaveAndRemoveDocument (TixiDocumentHandle handle, const char *xmlFilename)
 {
+  STATISTICS_FUNCTION();
   return saveDocument(handle, xmlFilename, REMOVED);
 }
 
 
 DLL_EXPORT ReturnCode tixiCloseDocument(TixiDocumentHandle handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if (!document) {
@@ -516,10 +651,11 @@ DLL_EXPORT ReturnCode tixiCloseDocument(TixiDocumentHandle handle)
 
 DLL_EXPORT ReturnCode tixiCloseAllDocuments()
 {
+  STATISTICS_FUNCTION();
   ReturnCode returnValue = SUCCESS;
+  TixiDocumentHandle handle = -1;
 
-  while(documentListHead && documentListHead->document) {
-    TixiDocumentHandle handle = documentListHead->document->handle;
+  while((handle = getFirstDocumentHandle()) != -1) {
     returnValue = tixiCloseDocument(handle);
     if(returnValue != SUCCESS)
       return returnValue;
@@ -529,10 +665,23 @@ DLL_EXPORT ReturnCode tixiCloseAllDocuments()
 
 DLL_EXPORT ReturnCode tixiCleanup()
 {
+  STATISTICS_FUNCTION();
   ReturnCode ret = tixiCloseAllDocuments();
   if(ret != SUCCESS)
     return ret;
 
+  schemaCacheClear();
+  xsltCacheClear();
+  curlCleanup();
+  httpCacheCleanup();
+  compressionCleanup();
+
+#ifdef TIXI_ENABLE_STATISTICS
+  if (getenv("TIXI_STATISTICS_FILE") && statisticsWriteJson(getenv("TIXI_STATISTICS_FILE")) != 0) {
+    printMsg(MESSAGETYPE_WARNING, "Warning: Cannot write the statistics to \"%s\".\n", getenv("TIXI_STATISTICS_FILE"));
+  }
+#endif
+
   // cleanup libxml, removes valgrind leaks
   xmlCleanupParser();
   return SUCCESS;
@@ -541,6 +690,7 @@ DLL_EXPORT ReturnCode tixiCleanup()
 
 DLL_EXPORT ReturnCode tixiExportDocumentAsString(const TixiDocumentHandle handle, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlDocPtr xmlDocument = NULL;
   xmlChar *xmlbuff;
@@ -581,8 +731,8 @@ DLL_EXPORT ReturnCode tixiExportDocumentAsString(const TixiDocumentHandle handle
 
 DLL_EXPORT ReturnCode tixiImportFromString (const char *xmlImportString, TixiDocumentHandle * handle)
 {
+  STATISTICS_FUNCTION();
   /* this imports a XML-string and checks if it is well formed */
-  TixiDocument *document = NULL;
   xmlDocPtr xmlDocument = NULL;
   ReturnCode returnValue = -1;
   char *tixiFileName = NULL;
@@ -599,25 +749,7 @@ DLL_EXPORT ReturnCode tixiImportFromString (const char *xmlImportString, TixiDoc
   xmlDocument = xmlReadMemory(xmlImportString, (int) strlen(xmlImportString), tixiFileName, NULL, XML_PARSE_HUGE);
 
   if (xmlDocument) {
-
-    document = (TixiDocument *) malloc(sizeof(TixiDocument));
-    document->xmlFilename = NULL;
-    document->dirname = NULL;
-    document->filename = NULL;
-    document->validationFilename = NULL;
-    document->docPtr = xmlDocument;
-    document->currentNode = NULL;
-    document->isValid = UNDEFINED;
-    document->status = OPENED;
-    document->memoryListHead = NULL;
-    document->memoryListTail = NULL;
-    document->hasIncludedExternalFiles = 1;
-    document->usePrettyPrint = 1;
-    document->uidListHead = NULL;
-    document->xpathContext = xmlXPathNewContext(xmlDocument);
-    document->xpathCache = XPathNewCache();
-    addDocumentToList(document, &(document->handle));
-    *handle = document->handle;
+    addInMemoryDocument(xmlDocument, handle);
     returnValue = SUCCESS; /*?*/
   }
   else {
@@ -633,6 +765,7 @@ DLL_EXPORT ReturnCode tixiImportFromString (const char *xmlImportString, TixiDoc
 
 DLL_EXPORT ReturnCode tixiAddHeader(const TixiDocumentHandle handle, const char *toolName, const char *version, const char *authorName)
 {
+  STATISTICS_FUNCTION();
 
   TixiDocument *document = getDocument(handle);
   xmlNodePtr headerElement = NULL;
@@ -716,6 +849,7 @@ DLL_EXPORT ReturnCode tixiAddHeader(const TixiDocumentHandle handle, const char
     return FAILED;
   }
 
+  clearDocumentCaches(document);
   if (!xmlAddChild(rootElement, headerElement)) {
     printMsg(MESSAGETYPE_ERROR, "Error:  Failed to add header element.\n");
     return FAILED;
@@ -728,6 +862,7 @@ DLL_EXPORT ReturnCode tixiAddCpacsHeader(const TixiDocumentHandle handle,
                                          const char *name, const char *creator, const char *version,
                                          const char *description, const char * cpacsVersion)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr headerElement = NULL;
   xmlNodePtr rootElement = NULL;
@@ -818,6 +953,7 @@ DLL_EXPORT ReturnCode tixiAddCpacsHeader(const TixiDocumentHandle handle,
     return FAILED;
   }
 
+  clearDocumentCaches(document);
   if (!xmlAddChild(rootElement, headerElement)) {
     printMsg(MESSAGETYPE_ERROR, "Error:  Failed to add header element.\n");
     return FAILED;
@@ -826,24 +962,44 @@ DLL_EXPORT ReturnCode tixiAddCpacsHeader(const TixiDocumentHandle handle,
 }
 
 
-DLL_EXPORT ReturnCode tixiSchemaValidateFromFile(const TixiDocumentHandle handle, const char *xsdFilename)
+static ReturnCode validateWithSchemaFile(const TixiDocumentHandle handle, const char *xsdFilename, int withDefaults)
 {
-  xmlDocPtr schema_doc;
+  TixiDocument *document = getDocument(handle);
+  xmlSchemaPtr schema = NULL;
+  TixiSchemaHandle schemaHandle = -1;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
 
-  schema_doc = xmlReadFile(xsdFilename, NULL, XML_PARSE_NONET);
-  return( validateSchema(handle, &schema_doc, 0));
+  /* the compiled schema is cached, such that validating again against the same file skips parsing it.
+   * It is referenced during the validation, another thread might reload the file in the meantime. */
+  error = schemaCacheLoad(xsdFilename, &schemaHandle, &schema);
+  if (error != SUCCESS) {
+    return error;
+  }
+  error = validateDocumentWithSchema(document, schema, withDefaults);
+  schemaCacheRelease(schemaHandle);
+  return error;
 }
 
-DLL_EXPORT ReturnCode tixiSchemaValidateWithDefaultsFromFile(const TixiDocumentHandle handle, const char *xsdFilename)
+DLL_EXPORT ReturnCode tixiSchemaValidateFromFile(const TixiDocumentHandle handle, const char *xsdFilename)
 {
-  xmlDocPtr schema_doc;
+  STATISTICS_FUNCTION();
+  return validateWithSchemaFile(handle, xsdFilename, 0);
+}
 
-  schema_doc = xmlReadFile(xsdFilename, NULL, XML_PARSE_NONET);
-  return( validateSchema(handle, &schema_doc, 1));
+DLL_EXPORT ReturnCode tixiSchemaValidateWithDefaultsFromFile(const TixiDocumentHandle handle, const char *xsdFilename)
+{
+  STATISTICS_FUNCTION();
+  return validateWithSchemaFile(handle, xsdFilename, 1);
 }
 
 DLL_EXPORT ReturnCode tixiSchemaValidateFromString(const TixiDocumentHandle handle, const char *xsdString)
 {
+  STATISTICS_FUNCTION();
   xmlDocPtr schema_doc;
 
   schema_doc = xmlReadMemory(xsdString, (int) strlen(xsdString), NULL, NULL, 0);
@@ -851,8 +1007,68 @@ DLL_EXPORT ReturnCode tixiSchemaValidateFromString(const TixiDocumentHandle hand
 }
 
 
+DLL_EXPORT ReturnCode tixiSchemaLoad(const char *xsdFilename, TixiSchemaHandle *schemaHandle)
+{
+  STATISTICS_FUNCTION();
+  xmlSchemaPtr schema = NULL;
+
+  if (!schemaHandle) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument for schemaHandle in tixiSchemaLoad.\n");
+    return FAILED;
+  }
+
+  return schemaCacheLoad(xsdFilename, schemaHandle, &schema);
+}
+
+static ReturnCode validateWithSchemaHandle(const TixiDocumentHandle handle, const TixiSchemaHandle schemaHandle, int withDefaults)
+{
+  TixiDocument *document = getDocument(handle);
+  xmlSchemaPtr schema = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  /* the reference keeps the schema alive, if the handle is freed during the validation */
+  schema = schemaCacheAcquire(schemaHandle);
+  if (!schema) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid schema handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = validateDocumentWithSchema(document, schema, withDefaults);
+  schemaCacheRelease(schemaHandle);
+  return error;
+}
+
+DLL_EXPORT ReturnCode tixiSchemaValidate(const TixiDocumentHandle handle, const TixiSchemaHandle schemaHandle)
+{
+  STATISTICS_FUNCTION();
+  return validateWithSchemaHandle(handle, schemaHandle, 0);
+}
+
+DLL_EXPORT ReturnCode tixiSchemaValidateWithDefaults(const TixiDocumentHandle handle, const TixiSchemaHandle schemaHandle)
+{
+  STATISTICS_FUNCTION();
+  return validateWithSchemaHandle(handle, schemaHandle, 1);
+}
+
+DLL_EXPORT ReturnCode tixiSchemaFree(const TixiSchemaHandle schemaHandle)
+{
+  STATISTICS_FUNCTION();
+  if (schemaCacheRelease(schemaHandle) != SUCCESS) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid schema handle.\n");
+    return INVALID_HANDLE;
+  }
+  return SUCCESS;
+}
+
+
 DLL_EXPORT ReturnCode tixiDTDValidate(const TixiDocumentHandle handle, const char *DTDFilename)
 {
+  STATISTICS_FUNCTION();
 
   PRINT_DEBUG2("%s %d\n", DTDFilename, handle);
   printMsg(MESSAGETYPE_ERROR, "Error: tixiDTDValidate not implemented.\n");
@@ -862,6 +1078,7 @@ DLL_EXPORT ReturnCode tixiDTDValidate(const TixiDocumentHandle handle, const cha
 
 DLL_EXPORT ReturnCode tixiGetTextElement(const TixiDocumentHandle handle, const char *elementPath, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   ReturnCode error = SUCCESS;
@@ -903,8 +1120,97 @@ DLL_EXPORT ReturnCode tixiGetTextElement(const TixiDocumentHandle handle, const
   return error;
 }
 
+/* returns the text of a text node or of a node with a single text child without copying it */
+static ReturnCode getNodeTextView(TixiDocument *document, xmlNodePtr node, char **text)
+{
+  static char emptyText[] = "";
+  xmlChar *textPtr = NULL;
+
+  if (xmlNodeIsText(node)) {
+    *text = node->content ? (char *) node->content : emptyText;
+    return SUCCESS;
+  }
+  if (!node->children) {
+    *text = emptyText;
+    return SUCCESS;
+  }
+  if (!node->children->next && xmlNodeIsText(node->children)) {
+    *text = node->children->content ? (char *) node->children->content : emptyText;
+    return SUCCESS;
+  }
+
+  /* mixed content has to be concatenated */
+  textPtr = xmlNodeListGetString(document->docPtr, node->children, 0);
+  if (!textPtr) {
+    *text = emptyText;
+    return SUCCESS;
+  }
+  *text = (char *) malloc(xmlStrlen(textPtr) + 1);
+  if (!*text) {
+    xmlFree(textPtr);
+    return FAILED;
+  }
+  strcpy(*text, (char *) textPtr);
+  xmlFree(textPtr);
+  return addToMemoryList(document, (void *) *text);
+}
+
+DLL_EXPORT ReturnCode tixiGetTextElementView(const TixiDocumentHandle handle, const char *elementPath, char **text)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = checkElement(document->xpathContext, elementPath, &element);
+  if (error) {
+    return error;
+  }
+  return getNodeTextView(document, element, text);
+}
+
+DLL_EXPORT ReturnCode tixiCheckElementSteps(const TixiDocumentHandle handle, const TixiPathStep *steps, int nSteps)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  return checkElementSteps(document, steps, nSteps, &element);
+}
+
+DLL_EXPORT ReturnCode tixiGetTextElementViewSteps(const TixiDocumentHandle handle, const TixiPathStep *steps,
+                                                  int nSteps, char **text)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = checkElementSteps(document, steps, nSteps, &element);
+  if (error) {
+    return error;
+  }
+  return getNodeTextView(document, element, text);
+}
+
 DLL_EXPORT ReturnCode tixiGetIntegerElement(const TixiDocumentHandle handle, const char *elementPath, int *number)
 {
+  STATISTICS_FUNCTION();
   char *text;
   ReturnCode error = 0;
 
@@ -927,6 +1233,7 @@ DLL_EXPORT ReturnCode tixiGetIntegerElement(const TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiGetDoubleElement(const TixiDocumentHandle handle, const char *elementPath, double *number)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   ReturnCode error = 0;
 
@@ -949,6 +1256,7 @@ DLL_EXPORT ReturnCode tixiGetDoubleElement(const TixiDocumentHandle handle, cons
 
 DLL_EXPORT ReturnCode tixiGetBooleanElement(const TixiDocumentHandle handle, const char *elementPath, int *boolean)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   ReturnCode error = 0;
 
@@ -976,6 +1284,7 @@ DLL_EXPORT ReturnCode tixiGetBooleanElement(const TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiUpdateTextElement (const TixiDocumentHandle handle, const char *elementPath, const char *text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   xmlNodePtr newElement = NULL;
@@ -1013,6 +1322,11 @@ DLL_EXPORT ReturnCode tixiUpdateTextElement (const TixiDocumentHandle handle, co
       return FAILED;
     }
 
+    if (binaryVectorIsBinary(element)) {
+      binaryVectorRemove(element);
+    }
+    vectorCacheRemove(document, element);
+
     newElement = xmlNewText((xmlChar*) text);
     if(element->children) {
       xmlNodePtr nodeToReplace = element->children;
@@ -1029,6 +1343,7 @@ DLL_EXPORT ReturnCode tixiUpdateTextElement (const TixiDocumentHandle handle, co
 
 DLL_EXPORT ReturnCode tixiUpdateDoubleElement (const TixiDocumentHandle handle, const char *elementPath, double number, const char *format)
 {
+  STATISTICS_FUNCTION();
 
   ReturnCode error = SUCCESS;
   char *textBuffer = NULL;
@@ -1046,6 +1361,7 @@ DLL_EXPORT ReturnCode tixiUpdateDoubleElement (const TixiDocumentHandle handle,
 
 DLL_EXPORT ReturnCode tixiUpdateIntegerElement (const TixiDocumentHandle handle, const char *elementPath, int number, const char *format)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error = SUCCESS;
   char *textBuffer = NULL;
   
@@ -1062,6 +1378,7 @@ DLL_EXPORT ReturnCode tixiUpdateIntegerElement (const TixiDocumentHandle handle,
 
 DLL_EXPORT ReturnCode tixiUpdateBooleanElement (const TixiDocumentHandle handle, const char *elementPath, int boolean)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if (!document) {
@@ -1088,6 +1405,7 @@ DLL_EXPORT ReturnCode tixiUpdateBooleanElement (const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiGetTextAttribute(const TixiDocumentHandle handle, const char *elementPath,
                                            const char *attributeName, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   char *textPtr;
   xmlNodePtr element = NULL;
@@ -1145,9 +1463,90 @@ DLL_EXPORT ReturnCode tixiGetTextAttribute(const TixiDocumentHandle handle, cons
   return error;
 }
 
+/* returns the value of an attribute of element without copying it */
+static ReturnCode getAttributeTextView(TixiDocument *document, xmlNodePtr element,
+                                       const char *attributeName, char **text)
+{
+  xmlAttrPtr attribute = NULL;
+  char *prefix = NULL;
+  char *name = NULL;
+  ReturnCode error = SUCCESS;
+
+  extractPrefixAndName(attributeName, &prefix, &name);
+  if (prefix) {
+    xmlNsPtr ns = xmlSearchNs(element->doc, element, (xmlChar *) prefix);
+    if (!ns) {
+      printMsg(MESSAGETYPE_ERROR, "Error: unknown namespace prefix \"%s\".\n", prefix);
+      error = INVALID_NAMESPACE_PREFIX;
+    }
+    else {
+      attribute = xmlHasNsProp(element, (xmlChar *) name, ns->href);
+    }
+    free(prefix);
+  }
+  else {
+    attribute = xmlHasProp(element, (xmlChar *) attributeName);
+  }
+  free(name);
+
+  if (error) {
+    return error;
+  }
+  if (!attribute) {
+    return ATTRIBUTE_NOT_FOUND;
+  }
+  /* attributes with a default value in the DTD */
+  if (attribute->type == XML_ATTRIBUTE_DECL) {
+    *text = (char *) ((xmlAttributePtr) attribute)->defaultValue;
+    return SUCCESS;
+  }
+  return getNodeTextView(document, (xmlNodePtr) attribute, text);
+}
+
+DLL_EXPORT ReturnCode tixiGetTextAttributeView(const TixiDocumentHandle handle, const char *elementPath,
+                                               const char *attributeName, char **text)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = checkElement(document->xpathContext, elementPath, &element);
+  if (error) {
+    return error;
+  }
+  return getAttributeTextView(document, element, attributeName, text);
+}
+
+DLL_EXPORT ReturnCode tixiGetTextAttributeViewSteps(const TixiDocumentHandle handle, const TixiPathStep *steps,
+                                                    int nSteps, const char *attributeName, char **text)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = checkElementSteps(document, steps, nSteps, &element);
+  if (error) {
+    return error;
+  }
+  return getAttributeTextView(document, element, attributeName, text);
+}
+
 DLL_EXPORT ReturnCode tixiGetDoubleAttribute(const TixiDocumentHandle handle,
                                              const char *elementPath, const char *attributeName, double *number)
 {
+  STATISTICS_FUNCTION();
   char *text;
   ReturnCode error = 0;
 
@@ -1168,6 +1567,7 @@ DLL_EXPORT ReturnCode tixiGetDoubleAttribute(const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiGetIntegerAttribute(const TixiDocumentHandle handle,
                                               const char *elementPath, const char *attributeName, int *number)
 {
+  STATISTICS_FUNCTION();
   char *text;
   ReturnCode error = 0;
 
@@ -1188,6 +1588,7 @@ DLL_EXPORT ReturnCode tixiGetIntegerAttribute(const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiGetBooleanAttribute(const TixiDocumentHandle handle,
                                               const char *elementPath, const char *attributeName, int *boolean)
 {
+  STATISTICS_FUNCTION();
   char *text;
   ReturnCode error = FAILED;
 
@@ -1222,6 +1623,7 @@ DLL_EXPORT ReturnCode tixiGetBooleanAttribute(const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiAddTextElement(const TixiDocumentHandle handle, const char *parentPath,
                                          const char *elementName, const char *text)
 {
+  STATISTICS_FUNCTION();
   return tixiAddTextElementAtIndex(handle, parentPath, elementName, text, -1);
 }
 
@@ -1229,6 +1631,7 @@ DLL_EXPORT ReturnCode tixiAddTextElement(const TixiDocumentHandle handle, const
 DLL_EXPORT ReturnCode tixiAddTextElementNS(const TixiDocumentHandle handle, const char *parentPath,
                                          const char *qualifiedName, const char* namespaceURI, const char *text)
 {
+  STATISTICS_FUNCTION();
   return tixiAddTextElementNSAtIndex(handle, parentPath, qualifiedName, namespaceURI, text, -1);
 }
 
@@ -1274,7 +1677,7 @@ ReturnCode tixiAddTextElementNSAtIndexImpl(const TixiDocumentHandle handle, cons
   }
 
   /* Check parent element */
-  xpathObject = xmlXPathEvalExpression((xmlChar *) parentPath, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, parentPath);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", parentPath);
@@ -1317,7 +1720,7 @@ ReturnCode tixiAddTextElementNSAtIndexImpl(const TixiDocumentHandle handle, cons
     targetNode = targetNode->next;
 
   // structure change!, we have to empty the xpath cache
-  XPathClearCache(document->xpathCache);
+  clearDocumentCaches(document);
 
   child = xmlNewNode(NULL, (xmlChar *) elemName);
   if (text != NULL) {
@@ -1349,6 +1752,7 @@ ReturnCode tixiAddTextElementNSAtIndexImpl(const TixiDocumentHandle handle, cons
 DLL_EXPORT ReturnCode tixiAddTextElementNSAtIndex(const TixiDocumentHandle handle, const char *parentPath,
                                                   const char *qualifiedName, const char* namespaceURI, const char *text, int index)
 {
+  STATISTICS_FUNCTION();
   if (!namespaceURI) {
     printMsg(MESSAGETYPE_ERROR, "Error: null pointer for namespaceURI!\n");
     return INVALID_NAMESPACE_URI;
@@ -1360,6 +1764,7 @@ DLL_EXPORT ReturnCode tixiAddTextElementNSAtIndex(const TixiDocumentHandle handl
 DLL_EXPORT ReturnCode tixiAddTextElementAtIndex(const TixiDocumentHandle handle, const char *parentPath,
                                                const char *elementName, const char *text, int index)
 {
+  STATISTICS_FUNCTION();
   return tixiAddTextElementNSAtIndexImpl(handle, parentPath, elementName, NULL, text, index);
 }
 
@@ -1367,6 +1772,7 @@ DLL_EXPORT ReturnCode tixiAddTextElementAtIndex(const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiAddBooleanElement(const TixiDocumentHandle handle, const char *parentPath,
                                             const char *elementName, int boolean)
 {
+  STATISTICS_FUNCTION();
   if( boolean == 0 ) {
     return tixiAddTextElement(handle, parentPath, elementName, "false");
   } else if( boolean == 1 ) {
@@ -1382,6 +1788,7 @@ DLL_EXPORT ReturnCode tixiAddBooleanElement(const TixiDocumentHandle handle, con
 DLL_EXPORT ReturnCode tixiAddBooleanElementNS(const TixiDocumentHandle handle, const char *parentPath,
                                             const char *qualifiedName, const char* namespaceURI, int boolean)
 {
+  STATISTICS_FUNCTION();
   if( boolean == 0 ) {
     return tixiAddTextElementNS(handle, parentPath, qualifiedName, namespaceURI, "false");
   } else if( boolean == 1 ) {
@@ -1397,6 +1804,7 @@ DLL_EXPORT ReturnCode tixiAddBooleanElementNS(const TixiDocumentHandle handle, c
 DLL_EXPORT ReturnCode tixiAddDoubleElement(const TixiDocumentHandle handle, const char *parentPath,
                                            const char *elementName, double number, const char *format)
 {
+  STATISTICS_FUNCTION();
   int error;
   char *textBuffer = NULL;
 
@@ -1424,6 +1832,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleElementNS(const TixiDocumentHandle handle, co
                                              const char *qualifiedName,const char* namespaceURI,
                                              double number, const char *format)
 {
+  STATISTICS_FUNCTION();
   int error;
   char *textBuffer = NULL;
 
@@ -1450,6 +1859,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleElementNS(const TixiDocumentHandle handle, co
 DLL_EXPORT ReturnCode tixiAddIntegerElement(const TixiDocumentHandle handle, const char *parentPath,
                                             const char *elementName, int number, const char *format)
 {
+  STATISTICS_FUNCTION();
   int error;
   char *textBuffer = NULL;
 
@@ -1477,6 +1887,7 @@ DLL_EXPORT ReturnCode tixiAddIntegerElement(const TixiDocumentHandle handle, con
 DLL_EXPORT ReturnCode tixiAddIntegerElementNS(const TixiDocumentHandle handle, const char *parentPath,
                                               const char *qualifiedName, const char* namespaceURI, int number, const char *format)
 {
+  STATISTICS_FUNCTION();
   int error;
   char *textBuffer = NULL;
 
@@ -1504,6 +1915,7 @@ DLL_EXPORT ReturnCode tixiAddIntegerElementNS(const TixiDocumentHandle handle, c
 DLL_EXPORT ReturnCode tixiAddTextAttribute(const TixiDocumentHandle handle, const char *elementPath,
                                            const char *attributeName, const char *attributeValue)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if (!document) {
@@ -1523,6 +1935,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleAttribute(const TixiDocumentHandle handle,
                                              const char *elementPath, const char *attributeName,
                                              double number, const char *format)
 {
+  STATISTICS_FUNCTION();
   int error;
   char *textBuffer = NULL;
 
@@ -1547,6 +1960,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleAttribute(const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiAddIntegerAttribute(const TixiDocumentHandle handle,
                                               const char *elementPath, const char *attributeName, int number, const char *format)
 {
+  STATISTICS_FUNCTION();
   /* Here the format string should be parsed to determine the length of the string to be generated. Instead,
      a very large char-array is allocated the string is printed into it. */
   int error;
@@ -1572,15 +1986,21 @@ DLL_EXPORT ReturnCode tixiAddIntegerAttribute(const TixiDocumentHandle handle,
 
 DLL_EXPORT ReturnCode tixiAddFloatVector (const TixiDocumentHandle handle, const char *parentPath, const char *elementName, const double *vector, const int numElements, const char* format)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error;
   char *stringVector = NULL;
   char *textBuffer = NULL;
+  TixiDocument *document = getDocument(handle);
+  int useBinary = document && vector && binaryVectorUse(document, numElements);
 
   if (!format) {
     format = "%g";
   };
 
-  stringVector = vectorToString(vector, numElements, format);
+  /* large vectors are stored in binary form, the element is added without text */
+  if (!useBinary) {
+    stringVector = vectorToString(vector, numElements, format);
+  }
 
   /* Add element */
   error = tixiAddTextElement(handle, parentPath, elementName, stringVector);
@@ -1598,16 +2018,26 @@ DLL_EXPORT ReturnCode tixiAddFloatVector (const TixiDocumentHandle handle, const
   if(error != SUCCESS) {
     return error;
   }
-  free(textBuffer);
-  free(stringVector);
 
-  return SUCCESS;
+  if (useBinary) {
+    xmlNodePtr element = NULL;
+    error = checkElement(document->xpathContext, textBuffer, &element);
+    if (error == SUCCESS) {
+      error = binaryVectorStore(document, element, vector, numElements);
+    }
+  }
+  free(textBuffer);
+  free(stringVector);
+
+  return error;
 }
 
 DLL_EXPORT ReturnCode tixiUpdateFloatVector (const TixiDocumentHandle handle, const char *path, const double *vector, const int numElements, const char* format)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error;
   char *stringVector = NULL;
+  TixiDocument *document = NULL;
 
   if(numElements < 1) {
     return FAILED;
@@ -1617,6 +2047,21 @@ DLL_EXPORT ReturnCode tixiUpdateFloatVector (const TixiDocumentHandle handle, co
     format = "%g";
   };
 
+  document = getDocument(handle);
+  if (document && vector && binaryVectorUse(document, numElements)) {
+    xmlNodePtr element = NULL;
+
+    /* checks the element and removes its text */
+    error = tixiUpdateTextElement(handle, path, "");
+    if (error == SUCCESS) {
+      error = checkElement(document->xpathContext, path, &element);
+    }
+    if (error == SUCCESS) {
+      error = binaryVectorStore(document, element, vector, numElements);
+    }
+    return error;
+  }
+
   stringVector = vectorToString(vector, numElements, format);
 
   error = tixiUpdateTextElement(handle, path, stringVector);
@@ -1625,10 +2070,29 @@ DLL_EXPORT ReturnCode tixiUpdateFloatVector (const TixiDocumentHandle handle, co
   return error;
 }
 
+DLL_EXPORT ReturnCode tixiSetBinaryVectorThreshold (const TixiDocumentHandle handle, int minElements)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (minElements < 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Negative threshold in tixiSetBinaryVectorThreshold.\n");
+    return FAILED;
+  }
+
+  return binaryVectorSetThreshold(document, minElements);
+}
+
 
 
 DLL_EXPORT ReturnCode tixiRemoveAttribute(const TixiDocumentHandle handle, const char *elementPath, const char *attributeName)
 {
+  STATISTICS_FUNCTION();
   xmlNodePtr parent;
   int retVal = 0;
   ReturnCode errorCode = SUCCESS;
@@ -1649,7 +2113,7 @@ DLL_EXPORT ReturnCode tixiRemoveAttribute(const TixiDocumentHandle handle, const
   document = getDocument(handle);
   extractPrefixAndName(attributeName, &prefix, &name);
   if (!prefix) {
-    XPathClearCache(document->xpathCache);
+    clearDocumentCaches(document);
     retVal = xmlUnsetProp(parent, (xmlChar *) attributeName);
   }
   else {
@@ -1660,7 +2124,7 @@ DLL_EXPORT ReturnCode tixiRemoveAttribute(const TixiDocumentHandle handle, const
       errorCode = INVALID_NAMESPACE_PREFIX;
     }
     else {
-      XPathClearCache(document->xpathCache);
+      clearDocumentCaches(document);
       retVal = xmlUnsetNsProp(parent, ns, (xmlChar*) name);
     }
     free(prefix);
@@ -1684,6 +2148,7 @@ DLL_EXPORT ReturnCode tixiRenameElement(const TixiDocumentHandle handle,
                                         const char* oldName,
                                         const char* newName)
 {
+    STATISTICS_FUNCTION();
     char* elementPath = NULL;
     xmlNodePtr parent = NULL;
     xmlNodePtr element = NULL;
@@ -1705,12 +2170,14 @@ DLL_EXPORT ReturnCode tixiRenameElement(const TixiDocumentHandle handle,
         return retVal;
     }
 
+    clearDocumentCaches(getDocument(handle));
     xmlNodeSetName(element, (xmlChar*) newName);
     return SUCCESS;
 }
 
 DLL_EXPORT ReturnCode tixiRemoveElement(const TixiDocumentHandle handle, const char *elementPath)
 {
+  STATISTICS_FUNCTION();
   xmlNodePtr parent = NULL;
   ReturnCode retVal;
 
@@ -1718,7 +2185,7 @@ DLL_EXPORT ReturnCode tixiRemoveElement(const TixiDocumentHandle handle, const c
 
   if(parent != NULL) {
     TixiDocument* document = getDocument(handle);
-    XPathClearCache(document->xpathCache);
+    clearDocumentCaches(document);
     xmlUnlinkNode(parent);
     xmlFreeNode(parent);
     return SUCCESS;
@@ -1732,11 +2199,14 @@ DLL_EXPORT ReturnCode tixiRemoveElement(const TixiDocumentHandle handle, const c
 DLL_EXPORT ReturnCode tixiGetNamedChildrenCount(const TixiDocumentHandle handle,
                                                 const char *elementPath, const char *childName, int *count)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlXPathObjectPtr xpathObject = NULL;
   xmlNodeSetPtr nodes = NULL;
   char * prefix = NULL;
   char * childTagName = NULL;
+  const xmlChar * namespaceURI = NULL;
+  xmlNodePtr parent = NULL;
 
   int iNode;
   char *childElementPath =
@@ -1765,7 +2235,7 @@ DLL_EXPORT ReturnCode tixiGetNamedChildrenCount(const TixiDocumentHandle handle,
   *count = 0;
 
   /* first check parent */
-  xpathObject = xmlXPathEvalExpression((xmlChar *) elementPath, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, elementPath);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", elementPath);
@@ -1793,12 +2263,23 @@ DLL_EXPORT ReturnCode tixiGetNamedChildrenCount(const TixiDocumentHandle handle,
     return ELEMENT_PATH_NOT_UNIQUE;
   }
 
+  parent = nodes->nodeTab[0];
   xmlXPathFreeObject(xpathObject);
 
+  /* plain element names can be counted using the child index */
+  if ((parent->type == XML_ELEMENT_NODE || parent->type == XML_DOCUMENT_NODE) &&
+      childIndexResolveName(document->xpathContext, childName, &childTagName, &namespaceURI)) {
+    *count = childIndexGetCount(document, parent, (xmlChar *) childTagName, namespaceURI);
+    free(childTagName);
+    free(childElementPath);
+    free(allChildren);
+    return SUCCESS;
+  }
+
   /* check if there are children at all */
 
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) allChildren, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, allChildren);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", allChildren);
@@ -1822,7 +2303,7 @@ DLL_EXPORT ReturnCode tixiGetNamedChildrenCount(const TixiDocumentHandle handle,
 
   /* now check child */
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) childElementPath, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, childElementPath);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", childElementPath);
@@ -1878,6 +2359,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleListWithAttributes(const TixiDocumentHandle h
                                                       const double *values, const char *format,
                                                       const char **attributes, int nValues)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error = -1;
   int iValue;
   TixiDocument *document = getDocument(handle);
@@ -1954,6 +2436,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleListWithAttributes(const TixiDocumentHandle h
     }
 
 
+    clearDocumentCaches(document);
     if (!xmlAddChild(parent, listNode)) {
       printMsg(MESSAGETYPE_ERROR,
                "Error:  Failed to add list element \"%s\" to parent \"%s\".\n",
@@ -1973,6 +2456,7 @@ DLL_EXPORT ReturnCode tixiAddDoubleListWithAttributes(const TixiDocumentHandle h
 DLL_EXPORT ReturnCode tixiAddPoint(const TixiDocumentHandle handle, const char *parentPath,
                                    double x, double y, double z, const char *format)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error = -1;
   TixiDocument *document = getDocument(handle);
   xmlNodePtr parent = NULL;
@@ -2001,7 +2485,7 @@ DLL_EXPORT ReturnCode tixiAddPoint(const TixiDocumentHandle handle, const char *
 
     /* add x coordinate */
     char *textBuffer = buildString(format, x);
-    XPathClearCache(document->xpathCache);
+    clearDocumentCaches(document);
 
     if (textBuffer) {
 
@@ -2068,6 +2552,7 @@ DLL_EXPORT ReturnCode tixiAddPoint(const TixiDocumentHandle handle, const char *
 DLL_EXPORT ReturnCode tixiGetPoint(const TixiDocumentHandle handle, const char *parentPath,
                                    double *x, double *y, double *z)
 {
+  STATISTICS_FUNCTION();
   int ignoreMissingElement = 1;
   int error;
 
@@ -2081,6 +2566,7 @@ DLL_EXPORT ReturnCode tixiGetPoint(const TixiDocumentHandle handle, const char *
 DLL_EXPORT ReturnCode tixiAddExternalLink(const TixiDocumentHandle handle, const char *parentPath,
                                           const char *path, const char *filename, AddLinkMode mode)
 {
+  STATISTICS_FUNCTION();
   ReturnCode errorCode = FAILED;
   xmlNodePtr parent = NULL;
   xmlNodePtr externalNode = NULL;
@@ -2119,6 +2605,7 @@ DLL_EXPORT ReturnCode tixiAddExternalLink(const TixiDocumentHandle handle, const
       return FAILED;
   }
 
+  clearDocumentCaches(document);
   externalNode = xmlAddChild(parent, externalNode);
 
   if (mode == ADDLINK_CREATE_AND_OPEN) {
@@ -2131,6 +2618,7 @@ DLL_EXPORT ReturnCode tixiAddExternalLink(const TixiDocumentHandle handle, const
 
 DLL_EXPORT ReturnCode tixiRemoveExternalLinks(TixiDocumentHandle handle)
 {
+    STATISTICS_FUNCTION();
     TixiDocument* document = getDocument(handle);
     xmlNodePtr rootNode = 0;
 
@@ -2147,6 +2635,7 @@ DLL_EXPORT ReturnCode tixiRemoveExternalLinks(TixiDocumentHandle handle)
 
 DLL_EXPORT ReturnCode tixiUsePrettyPrint(TixiDocumentHandle handle, int usePrettyPrint)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if (!document) {
@@ -2164,6 +2653,7 @@ DLL_EXPORT ReturnCode tixiUsePrettyPrint(TixiDocumentHandle handle, int usePrett
 
 DLL_EXPORT ReturnCode tixiSetPrintMsgFunc(TixiPrintMsgFnc func)
 {
+  STATISTICS_FUNCTION();
   tixiInit();
   if (func) {
     tixiMessageHandler = func;
@@ -2176,6 +2666,7 @@ DLL_EXPORT ReturnCode tixiSetPrintMsgFunc(TixiPrintMsgFnc func)
 
 DLL_EXPORT TixiPrintMsgFnc tixiGetPrintMsgFunc()
 {
+    STATISTICS_FUNCTION();
     tixiInit();
 
     return tixiMessageHandler;
@@ -2184,26 +2675,40 @@ DLL_EXPORT TixiPrintMsgFnc tixiGetPrintMsgFunc()
 
 DLL_EXPORT ReturnCode tixiGetVectorSize (const TixiDocumentHandle handle, const char *vectorPath, int *nElements)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error = FAILED;
-  char *tmpString = NULL;
-  char *token = NULL;
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  const VectorCacheEntry *vector = NULL;
   *nElements = 0;
 
-  error = tixiGetTextElement(handle, vectorPath, &tmpString);
-  if(error != SUCCESS) {
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = checkElement(document->xpathContext, vectorPath, &element);
+  if (error != SUCCESS) {
     return error;
   }
 
-  token = strtok(tmpString, VECTOR_SEPARATOR);
-  while(token != NULL) {
-    *nElements = *nElements + 1;
-    token = strtok(0, VECTOR_SEPARATOR);
+  if (binaryVectorIsBinary(element)) {
+    return binaryVectorSize(element, nElements);
+  }
+
+  /* the text is parsed only on first access */
+  vector = vectorCacheGet(document, element);
+  if (!vector) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in tixiGetVectorSize.\n");
+    return FAILED;
   }
+  *nElements = vector->count;
   return SUCCESS;
 }
 
 DLL_EXPORT ReturnCode tixiSetCacheEnabled(TixiDocumentHandle handle, int enabled)
 {
+    STATISTICS_FUNCTION();
     TixiDocument *document = getDocument(handle);
 
     if (!document) {
@@ -2220,12 +2725,115 @@ DLL_EXPORT ReturnCode tixiSetCacheEnabled(TixiDocumentHandle handle, int enabled
     return SUCCESS;
 }
 
+DLL_EXPORT ReturnCode tixiGetStatistics(const TixiDocumentHandle handle, TixiStatistics* statistics)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument* document = getDocument(handle);
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!statistics) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null Pointer in tixiGetStatistics.\n");
+    return FAILED;
+  }
+
+#ifdef TIXI_ENABLE_STATISTICS
+  error = statisticsGet(document, statistics);
+  if (error == SUCCESS) {
+    addToMemoryList(document, statistics->functions);
+  }
+#else
+  printMsg(MESSAGETYPE_ERROR, "Error: tixi is built without statistics, enable them with the cmake option TIXI_ENABLE_STATISTICS.\n");
+  error = FAILED;
+#endif
+  return error;
+}
+
+DLL_EXPORT ReturnCode tixiGetDocumentStatistics(const TixiDocumentHandle handle, TixiDocumentStatistics* statistics)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument* document = getDocument(handle);
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!statistics) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null Pointer in tixiGetDocumentStatistics.\n");
+    return FAILED;
+  }
+
+  statisticsGetDocument(document, statistics);
+  return SUCCESS;
+}
+
+DLL_EXPORT ReturnCode tixiSetXPathProfiling(const TixiDocumentHandle handle, int enabled)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument* document = getDocument(handle);
+  XPathProfile* profile = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (enabled) {
+    profile = xpathProfileCreate();
+    if (!profile) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Cannot allocate the XPath profile.\n");
+      return FAILED;
+    }
+  }
+
+  xpathProfileFree(document->xpathProfile);
+  document->xpathProfile = profile;
+  return SUCCESS;
+}
+
+DLL_EXPORT ReturnCode tixiGetXPathProfile(const TixiDocumentHandle handle, int* nExpressions, TixiXPathProfileEntry** entries)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument* document = getDocument(handle);
+  TixiXPathProfileEntry* report = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!nExpressions || !entries) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null Pointer in tixiGetXPathProfile.\n");
+    return FAILED;
+  }
+
+  if (!document->xpathProfile) {
+    printMsg(MESSAGETYPE_ERROR, "Error: XPath profiling is not enabled, call tixiSetXPathProfiling first.\n");
+    return FAILED;
+  }
+
+  report = xpathProfileReport(document->xpathProfile, nExpressions);
+  if (!report) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in tixiGetXPathProfile.\n");
+    return FAILED;
+  }
+  addToMemoryList(document, report);
+  *entries = report;
+  return SUCCESS;
+}
+
 ReturnCode tixiGetArrayElementCountImpl (const TixiDocumentHandle handle, const char *arrayPath,
                                                     const char *elementType, int *elements);
 
 DLL_EXPORT ReturnCode tixiGetArrayDimensions (const TixiDocumentHandle handle,
                                               const char *arrayPath, int *dimensions)
 {
+  STATISTICS_FUNCTION();
 
   printMsg(MESSAGETYPE_WARNING, "DEPRECATED: tixiGetArrayDimensions is an outdated CPACS specific function. It will be removed in the next major release");
   return tixiGetArrayElementCountImpl(handle, arrayPath, "vector", dimensions);
@@ -2238,6 +2846,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionNames (const TixiDocumentHandle handl
                                                   const char *arrayPath,
                                                   char **dimensionNames)
 {
+  STATISTICS_FUNCTION();
   printMsg(MESSAGETYPE_WARNING, "DEPRECATED: tixiGetArrayDimensionNames is an outdated CPACS specific function. It will be removed in the next major release");
   return tixiGetArrayElementNamesImpl(handle, arrayPath, "vector", dimensionNames);
 }
@@ -2246,6 +2855,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionNames (const TixiDocumentHandle handl
 DLL_EXPORT ReturnCode tixiGetArrayDimensionSizes (const TixiDocumentHandle handle, const char *arrayPath,
                                                   int *sizes, int *arraySizes)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlXPathObjectPtr xpathObject = NULL;
   xmlNodeSetPtr nodes = NULL;
@@ -2270,7 +2880,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionSizes (const TixiDocumentHandle handl
   strcpy(xpathSubElementsName, arrayPath);
   strcat(xpathSubElementsName, suffix);    /* meaning: find all vector sub elements */
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) xpathSubElementsName, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, xpathSubElementsName);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", xpathSubElementsName);
@@ -2331,6 +2941,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionSizes (const TixiDocumentHandle handl
 DLL_EXPORT ReturnCode tixiGetArrayDimensionValues (const TixiDocumentHandle handle, const char *arrayPath,
                                                    const int dimension, double *dimensionValues)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlXPathObjectPtr xpathObject = NULL;
   xmlNodeSetPtr nodes = NULL;
@@ -2355,7 +2966,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionValues (const TixiDocumentHandle hand
   strcpy(xpathSubElementsName, arrayPath);
   strcat(xpathSubElementsName, suffix);    /* meaning: find all vector sub elements */
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) xpathSubElementsName, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, xpathSubElementsName);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", xpathSubElementsName);
@@ -2417,6 +3028,7 @@ DLL_EXPORT ReturnCode tixiGetArrayDimensionValues (const TixiDocumentHandle hand
 DLL_EXPORT ReturnCode tixiGetArrayParameters (const TixiDocumentHandle handle,
                                               const char *arrayPath, int *parameters)
 {
+  STATISTICS_FUNCTION();
   printMsg(MESSAGETYPE_WARNING, "DEPRECATED: tixiGetArrayParameters is an outdated CPACS specific function. It will be removed in the next major release");
   return tixiGetArrayElementCountImpl(handle, arrayPath, "array", parameters);
 }
@@ -2426,6 +3038,7 @@ DLL_EXPORT ReturnCode tixiGetArrayParameterNames (const TixiDocumentHandle handl
                                                   const char *arrayPath,
                                                   char **parameterNames)
 {
+  STATISTICS_FUNCTION();
   printMsg(MESSAGETYPE_WARNING, "DEPRECATED: tixiGetArrayParameterNames is an outdated CPACS specific function. It will be removed in the next major release");
   return tixiGetArrayElementNamesImpl(handle, arrayPath, "array", parameterNames);
 }
@@ -2434,6 +3047,7 @@ DLL_EXPORT ReturnCode tixiGetArrayParameterNames (const TixiDocumentHandle handl
 DLL_EXPORT ReturnCode tixiGetArray (const TixiDocumentHandle handle, const char *arrayPath,
                                     const char *elementName, int arraySize, double **pValues)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlXPathObjectPtr xpathObject = NULL;
   xmlNodeSetPtr nodes = NULL;
@@ -2459,7 +3073,7 @@ DLL_EXPORT ReturnCode tixiGetArray (const TixiDocumentHandle handle, const char
   strcat(xpathSubElementsName, "/");
   strcat(xpathSubElementsName, elementName);
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) xpathSubElementsName, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, xpathSubElementsName);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", xpathSubElementsName);
@@ -2503,6 +3117,25 @@ DLL_EXPORT ReturnCode tixiGetArray (const TixiDocumentHandle handle, const char
     return ATTRIBUTE_NOT_FOUND;
   }
 
+  if (binaryVectorIsBinary(node)) {
+    ReturnCode error = binaryVectorRead(document, node, &tmpArray, &count);
+
+    free(xpathSubElementsName);
+    xmlFree(attributeName);
+    xmlXPathFreeObject(xpathObject);
+    if (error != SUCCESS) {
+      return error;
+    }
+    if (count != arraySize) {
+      printMsg(MESSAGETYPE_ERROR,
+               "Error: the number of elements of array \"%s\" does not match the specified size of %d (should be %d)!\n",
+               elementName, arraySize, count);
+      return NON_MATCHING_SIZE;
+    }
+    *pValues = tmpArray;
+    return SUCCESS;
+  }
+
   node = node->children;    /* get children, because there must be a node containing the string value */
   if(!(node)) {
     printMsg(MESSAGETYPE_ERROR,
@@ -2558,6 +3191,7 @@ DLL_EXPORT ReturnCode tixiGetArray (const TixiDocumentHandle handle, const char
 
 DLL_EXPORT double tixiGetArrayValue(const double *array, const int *dimSize, const int *dimPos, const int dims)
 {
+  STATISTICS_FUNCTION();
   int i = 0;
   int index = 0;
 
@@ -2604,7 +3238,7 @@ ReturnCode tixiGetArrayElementCountImpl (const TixiDocumentHandle handle, const
   strcat(xpathSubElementsName, elementType);
   strcat(xpathSubElementsName, "\"]");
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) xpathSubElementsName, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, xpathSubElementsName);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", xpathSubElementsName);
@@ -2632,6 +3266,7 @@ ReturnCode tixiGetArrayElementCountImpl (const TixiDocumentHandle handle, const
 DLL_EXPORT ReturnCode tixiGetArrayElementCount (const TixiDocumentHandle handle, const char *arrayPath,
                                                 const char *elementType, int *elements)
 {
+    STATISTICS_FUNCTION();
     return tixiGetArrayElementCountImpl(handle, arrayPath, elementType, elements);
 }
 
@@ -2661,7 +3296,7 @@ ReturnCode tixiGetArrayElementNamesImpl (const TixiDocumentHandle handle, const
   strcat(xpathSubElementsName, elementType);
   strcat(xpathSubElementsName, "\"]");
 
-  xpathObject = xmlXPathEvalExpression((xmlChar *) xpathSubElementsName, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, xpathSubElementsName);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", xpathSubElementsName);
@@ -2697,51 +3332,198 @@ ReturnCode tixiGetArrayElementNamesImpl (const TixiDocumentHandle handle, const
 DLL_EXPORT ReturnCode tixiGetArrayElementNames (const TixiDocumentHandle handle, const char *arrayPath,
                                                 const char * elementType, char **elementNames)
 {
+    STATISTICS_FUNCTION();
     return tixiGetArrayElementNamesImpl(handle, arrayPath, elementType, elementNames);
 }
 
 
+/* copies the first eNumber values of a vector element into values */
+static ReturnCode copyVectorValues(TixiDocument *document, xmlNodePtr element, double *values, int eNumber)
+{
+  ReturnCode error;
+  int count = 0;
+  const VectorCacheEntry *vector = NULL;
+
+  if (binaryVectorIsBinary(element)) {
+    error = binaryVectorCopy(document, element, values, eNumber, &count);
+    if (error != SUCCESS) {
+      return error;
+    }
+    return count < eNumber ? INDEX_OUT_OF_RANGE : SUCCESS;
+  }
+
+  /* the text is parsed only on first access */
+  vector = vectorCacheGet(document, element);
+  if (!vector) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory for the values of a vector.\n");
+    return FAILED;
+  }
+
+  count = vector->nValid < eNumber ? vector->nValid : eNumber;
+  if (count > 0) {
+    memcpy(values, vector->values, count * sizeof(double));
+  }
+
+  if (count < eNumber && vector->invalidToken) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Cannot parse the %i-th element \"%s\" of a vector as a float.\n", count+1, vector->invalidToken);
+    return NO_NUMBER;
+  }
+  return count < eNumber ? INDEX_OUT_OF_RANGE : SUCCESS;
+}
+
 DLL_EXPORT ReturnCode tixiGetFloatVector (const TixiDocumentHandle handle, const char *vectorPath,
                                           double **vectorArray, const int eNumber)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error;
-  char *tmpString = NULL;
   int count = 0;
-  char *token = NULL;
-  TixiDocument *document = NULL;
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
 
-  error = tixiGetTextElement(handle, vectorPath, &tmpString); /* check if element is of right type */
+  error = checkElement(document->xpathContext, vectorPath, &element);
   if (error != SUCCESS) {
     return error;
   }
 
-  *vectorArray = (double *) malloc(eNumber * sizeof(double));
-  document = getDocument(handle);
+  if (binaryVectorIsBinary(element)) {
+    /* the values are mapped from the sidecar file */
+    error = binaryVectorRead(document, element, vectorArray, &count);
+    if (error != SUCCESS) {
+      return error;
+    }
+    return count < eNumber ? INDEX_OUT_OF_RANGE : SUCCESS;
+  }
+
+  /* the caller gets a copy of the values, which is owned by the document */
+  *vectorArray = (double *) malloc((eNumber > 0 ? eNumber : 1) * sizeof(double));
+  if (!*vectorArray) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in tixiGetFloatVector.\n");
+    return FAILED;
+  }
   addToMemoryList(document, *vectorArray);
 
-  token = strtok(tmpString, VECTOR_SEPARATOR);    /* modifies tmpString */
-  while(token != NULL) {  /* as long as there are tokens */
-    if (count == eNumber) {
-      return SUCCESS;
-    }
+  return copyVectorValues(document, element, *vectorArray, eNumber);
+}
 
-    trim_trailing_whitespace(token);
-    if (isNumeric(token)) {
-        (*vectorArray)[count ++] = atof(token);    /* starting with zero */
-    }
-    else {
-        printMsg(MESSAGETYPE_ERROR, "Error: tixiGetFloatVector cannot parse the %i-th element \"%s\" as a float.\n", count+1, token);
-        return NO_NUMBER;
+
+DLL_EXPORT ReturnCode tixiGetFloatVectorValues (const TixiDocumentHandle handle, const char *vectorPath,
+                                                double *values, const int eNumber)
+{
+  STATISTICS_FUNCTION();
+  ReturnCode error;
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!values && eNumber > 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer for argument 'values' in tixiGetFloatVectorValues.\n");
+    return FAILED;
+  }
+
+  error = checkElement(document->xpathContext, vectorPath, &element);
+  if (error != SUCCESS) {
+    return error;
+  }
+
+  return copyVectorValues(document, element, values, eNumber);
+}
+
+
+/* returns the number of a coordinate element like getCoordinateValue */
+static double getCoordinate(TixiDocument *document, xmlNodePtr coordinate)
+{
+  double value = 0.;
+  xmlChar *text = NULL;
+
+  /* the usual case of a single text child is read without copying it */
+  if (coordinate->children && !coordinate->children->next && xmlNodeIsText(coordinate->children)) {
+    return coordinate->children->content ? atof((char *) coordinate->children->content) : 0.;
+  }
+
+  text = xmlNodeListGetString(document->docPtr, coordinate->children, 0);
+  if (text) {
+    value = atof((char *) text);
+    xmlFree(text);
+  }
+  return value;
+}
+
+DLL_EXPORT ReturnCode tixiGetPointList (const TixiDocumentHandle handle, const char *pointsPath,
+                                        double *x, double *y, double *z, const int nPoints)
+{
+  STATISTICS_FUNCTION();
+  ReturnCode error;
+  TixiDocument *document = getDocument(handle);
+  xmlXPathObjectPtr xpathObject = NULL;
+  xmlNodeSetPtr nodes = NULL;
+  int count = 0;
+  int i;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if ((!x || !y || !z) && nPoints > 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer for a coordinate array in tixiGetPointList.\n");
+    return FAILED;
+  }
+
+  error = checkExistence(document->xpathContext, pointsPath, &xpathObject);
+  if (error != SUCCESS) {
+    return error;
+  }
+
+  nodes = xpathObject->nodesetval;
+  count = nodes->nodeNr < nPoints ? nodes->nodeNr : nPoints;
+  for (i = 0; i < count; ++i) {
+    xmlNodePtr point = nodes->nodeTab[i];
+    xmlNodePtr child = NULL;
+    int found = 0;
+
+    if (point->type != XML_ELEMENT_NODE) {
+      printMsg(MESSAGETYPE_ERROR, "Error: XPath expression \"%s\" does not point to element nodes.\n", pointsPath);
+      xmlXPathFreeObject(xpathObject);
+      return NOT_AN_ELEMENT;
     }
 
-    token = strtok(0, VECTOR_SEPARATOR);
+    /* the first x, y and z child of each point, missing coordinates are unchanged */
+    for (child = point->children; child && found != 7; child = child->next) {
+      if (child->type != XML_ELEMENT_NODE || child->ns || !child->name[0] || child->name[1]) {
+        continue;
+      }
+      if (child->name[0] == 'x' && !(found & 1)) {
+        x[i] = getCoordinate(document, child);
+        found |= 1;
+      }
+      else if (child->name[0] == 'y' && !(found & 2)) {
+        y[i] = getCoordinate(document, child);
+        found |= 2;
+      }
+      else if (child->name[0] == 'z' && !(found & 4)) {
+        z[i] = getCoordinate(document, child);
+        found |= 4;
+      }
+    }
   }
-  return count < eNumber ? INDEX_OUT_OF_RANGE : SUCCESS;
+  xmlXPathFreeObject(xpathObject);
+
+  return count < nPoints ? INDEX_OUT_OF_RANGE : SUCCESS;
 }
 
 
 DLL_EXPORT ReturnCode tixiCreateElement (const TixiDocumentHandle handle, const char *parentPath, const char *elementName)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   return tixiAddTextElement(handle, parentPath, elementName, text);
 }
@@ -2749,6 +3531,7 @@ DLL_EXPORT ReturnCode tixiCreateElement (const TixiDocumentHandle handle, const
 
 DLL_EXPORT ReturnCode tixiCreateElementNS (const TixiDocumentHandle handle, const char *parentPath, const char *qualifiedName, const char* namespaceURI)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   return tixiAddTextElementNS(handle, parentPath, qualifiedName, namespaceURI, text);
 }
@@ -2756,6 +3539,7 @@ DLL_EXPORT ReturnCode tixiCreateElementNS (const TixiDocumentHandle handle, cons
 
 DLL_EXPORT ReturnCode tixiCreateElementAtIndex (const TixiDocumentHandle handle, const char *parentPath, const char *elementName, int index)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   return tixiAddTextElementAtIndex(handle, parentPath, elementName, text,index);
 }
@@ -2764,6 +3548,7 @@ DLL_EXPORT ReturnCode tixiCreateElementAtIndex (const TixiDocumentHandle handle,
 DLL_EXPORT ReturnCode tixiCreateElementNSAtIndex (const TixiDocumentHandle handle, const char *parentPath,
                                                   const char *qualifiedName, int index, const char* namespaceURI)
 {
+  STATISTICS_FUNCTION();
   char *text = NULL;
   return tixiAddTextElementNSAtIndex(handle, parentPath, qualifiedName, namespaceURI, text,index);
 }
@@ -2771,6 +3556,7 @@ DLL_EXPORT ReturnCode tixiCreateElementNSAtIndex (const TixiDocumentHandle handl
 
 DLL_EXPORT ReturnCode tixiCheckDocumentHandle(const TixiDocumentHandle handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if (!document) {
@@ -2783,6 +3569,7 @@ DLL_EXPORT ReturnCode tixiCheckDocumentHandle(const TixiDocumentHandle handle)
 
 DLL_EXPORT ReturnCode tixiCheckElement(const TixiDocumentHandle handle, const char *elementPath)
 {
+  STATISTICS_FUNCTION();
 
   TixiDocument *document = getDocument(handle);
 
@@ -2805,6 +3592,7 @@ DLL_EXPORT ReturnCode tixiCheckElement(const TixiDocumentHandle handle, const ch
 
 DLL_EXPORT ReturnCode tixiCheckAttribute(TixiDocumentHandle handle, const char *elementPath, const char *attributeName)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   char *textPtr;
@@ -2850,6 +3638,7 @@ DLL_EXPORT ReturnCode tixiCheckAttribute(TixiDocumentHandle handle, const char *
 
 DLL_EXPORT ReturnCode tixiXSLTransformationToString(TixiDocumentHandle handle, const char *xslFilename, char **resultText)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   int error = SUCCESS;
   char *textPtr = NULL;
@@ -2870,12 +3659,242 @@ DLL_EXPORT ReturnCode tixiXSLTransformationToString(TixiDocumentHandle handle, c
 
 DLL_EXPORT ReturnCode tixiXSLTransformationToFile(TixiDocumentHandle handle, const char *xslFilename, const char *resultFilename)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   return xsltTransformToFile(document->docPtr, xslFilename, resultFilename);
 }
 
 
+DLL_EXPORT ReturnCode tixiXSLTransformationToDocument(TixiDocumentHandle handle, const char *xslFilename, TixiDocumentHandle *resultHandle)
+{
+  STATISTICS_FUNCTION();
+  return tixiXSLTransformationToDocumentWithParams(handle, xslFilename, NULL, NULL, 0, resultHandle);
+}
+
+DLL_EXPORT ReturnCode tixiXSLTransformationToDocumentWithParams(TixiDocumentHandle handle, const char *xslFilename,
+                                                                const char **paramNames, const char **paramValues, int nParams,
+                                                                TixiDocumentHandle *resultHandle)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xsltStylesheetPtr style = NULL;
+  TixiStylesheetHandle styleHandle = -1;
+  xmlDocPtr resultDocument = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!xslFilename || !resultHandle) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument in tixiXSLTransformationToDocument.\n");
+    return FAILED;
+  }
+
+  /* the reference keeps the stylesheet alive, if the file is changed during the transformation */
+  error = xsltCacheLoad(xslFilename, &styleHandle, &style);
+  if (error != SUCCESS) {
+    return error;
+  }
+
+  resultDocument = xsltApplyToDocument(document->docPtr, style, paramNames, paramValues, nParams);
+  xsltCacheRelease(styleHandle);
+  if (!resultDocument) {
+    return FAILED;
+  }
+
+  if (!xmlDocGetRootElement(resultDocument)) {
+    printMsg(MESSAGETYPE_ERROR, "Error: The result of the transformation with \"%s\" is not an XML document.\n", xslFilename);
+    xmlFreeDoc(resultDocument);
+    return FAILED;
+  }
+
+  addInMemoryDocument(resultDocument, resultHandle);
+  return SUCCESS;
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetLoad(const char *xslFilename, TixiStylesheetHandle *stylesheetHandle)
+{
+  STATISTICS_FUNCTION();
+  xsltStylesheetPtr style = NULL;
+
+  if (!stylesheetHandle) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument for stylesheetHandle in tixiStylesheetLoad.\n");
+    return FAILED;
+  }
+
+  return xsltCacheLoad(xslFilename, stylesheetHandle, &style);
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetTransformToString(TixiDocumentHandle handle, const TixiStylesheetHandle stylesheetHandle, char **resultText)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xsltStylesheetPtr style = NULL;
+  char *textPtr = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  /* the reference keeps the stylesheet alive, if the handle is freed during the transformation */
+  style = xsltCacheAcquire(stylesheetHandle);
+  if (!style) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid stylesheet handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  textPtr = xsltApplyToString(document->docPtr, style);
+  xsltCacheRelease(stylesheetHandle);
+  if (!textPtr) {
+    *resultText = NULL;
+    return FAILED;
+  }
+
+  *resultText = (char *) malloc((strlen(textPtr) + 1) * sizeof(char));
+  strcpy(*resultText, textPtr);
+  xmlFree(textPtr);
+  return addToMemoryList(document, (void *) *resultText);
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetTransformToFile(TixiDocumentHandle handle, const TixiStylesheetHandle stylesheetHandle, const char *resultFilename)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xsltStylesheetPtr style = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  style = xsltCacheAcquire(stylesheetHandle);
+  if (!style) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid stylesheet handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = xsltApplyToFile(document->docPtr, style, resultFilename);
+  xsltCacheRelease(stylesheetHandle);
+  return error;
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetTransformDocuments(const TixiStylesheetHandle stylesheetHandle, const TixiDocumentHandle *handles,
+                                                       int nDocuments, int nThreads, TixiDocumentHandle *resultHandles)
+{
+  STATISTICS_FUNCTION();
+  xsltStylesheetPtr style = NULL;
+  xmlDocPtr *documents = NULL;
+  xmlDocPtr *results = NULL;
+  ReturnCode *errors = NULL;
+  ReturnCode error = SUCCESS;
+  int i;
+
+  if (nDocuments < 0 || (nDocuments > 0 && (!handles || !resultHandles))) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument in tixiStylesheetTransformDocuments.\n");
+    return FAILED;
+  }
+
+  /* no result handle is left uninitialized, if the transformation fails */
+  for (i = 0; i < nDocuments; ++i) {
+    resultHandles[i] = -1;
+  }
+
+  style = xsltCacheAcquire(stylesheetHandle);
+  if (!style) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid stylesheet handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (nDocuments == 0) {
+    xsltCacheRelease(stylesheetHandle);
+    return SUCCESS;
+  }
+
+  documents = (xmlDocPtr *) malloc(nDocuments * sizeof(xmlDocPtr));
+  results = (xmlDocPtr *) malloc(nDocuments * sizeof(xmlDocPtr));
+  errors = (ReturnCode *) malloc(nDocuments * sizeof(ReturnCode));
+  if (!documents || !results || !errors) {
+    free(errors);
+    free(results);
+    free(documents);
+    xsltCacheRelease(stylesheetHandle);
+    return FAILED;
+  }
+
+  for (i = 0; i < nDocuments; ++i) {
+    TixiDocument *document = getDocument(handles[i]);
+    if (!document) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle %d.\n", handles[i]);
+      error = INVALID_HANDLE;
+      break;
+    }
+    documents[i] = document->docPtr;
+  }
+
+  if (error == SUCCESS) {
+    /* documents are registered after the parallel part, the document list is not thread safe */
+    xsltApplyToDocuments(style, documents, nDocuments, nThreads, results, errors);
+    for (i = 0; i < nDocuments; ++i) {
+      if (results[i] && !xmlDocGetRootElement(results[i])) {
+        printMsg(MESSAGETYPE_ERROR, "Error: The result of the transformation of document %d is not an XML document.\n", handles[i]);
+        xmlFreeDoc(results[i]);
+        errors[i] = FAILED;
+      }
+      else if (results[i]) {
+        addInMemoryDocument(results[i], &resultHandles[i]);
+      }
+      if (errors[i] != SUCCESS && error == SUCCESS) {
+        error = FAILED;
+      }
+    }
+  }
+
+  free(errors);
+  free(results);
+  free(documents);
+  xsltCacheRelease(stylesheetHandle);
+  return error;
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetTransformFiles(const TixiStylesheetHandle stylesheetHandle, const char **inputFilenames,
+                                                   const char **outputFilenames, int nFiles, int nThreads)
+{
+  STATISTICS_FUNCTION();
+  xsltStylesheetPtr style = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (nFiles < 0 || (nFiles > 0 && (!inputFilenames || !outputFilenames))) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument in tixiStylesheetTransformFiles.\n");
+    return FAILED;
+  }
+
+  style = xsltCacheAcquire(stylesheetHandle);
+  if (!style) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid stylesheet handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  error = xsltApplyToFiles(style, inputFilenames, outputFilenames, nFiles, nThreads, NULL);
+  xsltCacheRelease(stylesheetHandle);
+  return error;
+}
+
+DLL_EXPORT ReturnCode tixiStylesheetFree(const TixiStylesheetHandle stylesheetHandle)
+{
+  STATISTICS_FUNCTION();
+  if (xsltCacheRelease(stylesheetHandle) != SUCCESS) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid stylesheet handle.\n");
+    return INVALID_HANDLE;
+  }
+  return SUCCESS;
+}
+
+
 /** -----------
  * UID Functions
  *--------------*/
@@ -2883,6 +3902,7 @@ DLL_EXPORT ReturnCode tixiXSLTransformationToFile(TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiUIDCheckDuplicates(TixiDocumentHandle handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   if(!document)
@@ -2908,6 +3928,7 @@ DLL_EXPORT ReturnCode tixiUIDCheckDuplicates(TixiDocumentHandle handle)
 
 DLL_EXPORT ReturnCode tixiUIDCheckLinks(TixiDocumentHandle handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
 
   // if the UID list is already set, delete and rebuild it.
@@ -2929,6 +3950,7 @@ DLL_EXPORT ReturnCode tixiUIDCheckLinks(TixiDocumentHandle handle)
 
 DLL_EXPORT ReturnCode tixiUIDGetXPath(TixiDocumentHandle handle, const char *uID, char **xPath)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error;
   TixiDocument *document = getDocument(handle);
   char *textPtr = NULL;
@@ -2955,6 +3977,7 @@ DLL_EXPORT ReturnCode tixiUIDGetXPath(TixiDocumentHandle handle, const char *uID
 
 DLL_EXPORT ReturnCode tixiUIDCheckExists(TixiDocumentHandle handle, const char *uID)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   ReturnCode error = FAILED;
 
@@ -2982,6 +4005,7 @@ DLL_EXPORT ReturnCode tixiUIDCheckExists(TixiDocumentHandle handle, const char *
 
 DLL_EXPORT ReturnCode tixiUIDSetToXPath(TixiDocumentHandle handle, const char *xPath, const char *uID)
 {
+  STATISTICS_FUNCTION();
   ReturnCode error;
 
   error = tixiUIDCheckDuplicates(handle);
@@ -2995,6 +4019,7 @@ DLL_EXPORT ReturnCode tixiUIDSetToXPath(TixiDocumentHandle handle, const char *x
 
 DLL_EXPORT ReturnCode tixiXPathEvaluateNodeNumber(TixiDocumentHandle handle, const char *xPathExpression, int *number)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   int error = SUCCESS;
 
@@ -3008,6 +4033,7 @@ DLL_EXPORT ReturnCode tixiXPathEvaluateNodeNumber(TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiXPathExpressionGetXPath(TixiDocumentHandle handle, const char *xPathExpression, int index, char** xPath)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   char* tmpXPath = NULL;
   int error = SUCCESS;
@@ -3031,8 +4057,124 @@ DLL_EXPORT ReturnCode tixiXPathExpressionGetXPath(TixiDocumentHandle handle, con
   return error;
 }
 
+DLL_EXPORT ReturnCode tixiXPathEvaluateAll(TixiDocumentHandle handle, const char *xPathExpression, int flags, TixiXPathResult* result)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlXPathObjectPtr xpathObject = NULL;
+  xmlNodeSetPtr nodes = NULL;
+  size_t arenaSize = 0;
+  char* arena = NULL;
+  char* cursor = NULL;
+  int nArrays = 0;
+  int i = 0;
+
+  if (!result) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer argument for result in tixiXPathEvaluateAll.\n");
+    return FAILED;
+  }
+
+  result->number = 0;
+  result->texts = NULL;
+  result->paths = NULL;
+  result->nodeTypes = NULL;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  xpathObject = XPathEvaluateExpression(document, xPathExpression);
+  if (!xpathObject) {
+    return INVALID_XPATH;
+  }
+  if (xpathObject->type != XPATH_NODESET) {
+    printMsg(MESSAGETYPE_ERROR, "Error: XPath expression \"%s\" does not result in a node set.\n", xPathExpression);
+    return INVALID_XPATH;
+  }
+
+  nodes = xpathObject->nodesetval;
+  if (xmlXPathNodeSetIsEmpty(nodes)) {
+    return SUCCESS;
+  }
+
+  nArrays = ((flags & XPATHRESULT_TEXTS) ? 1 : 0) + ((flags & XPATHRESULT_PATHS) ? 1 : 0) + ((flags & XPATHRESULT_NODETYPES) ? 1 : 0);
+  result->number = nodes->nodeNr;
+  if (nArrays == 0) {
+    return SUCCESS;
+  }
+
+  /* first pass: measure all strings, such that the arrays and strings fit into a single allocation */
+  arenaSize = nArrays * nodes->nodeNr * sizeof(char*);
+  for (i = 0; i < nodes->nodeNr; ++i) {
+    xmlNodePtr node = nodes->nodeTab[i];
+    if (flags & XPATHRESULT_TEXTS) {
+      long textLength = getResultNodeTextLength(node);
+      arenaSize += textLength >= 0 ? (size_t) textLength + 1 : 0;
+    }
+    if (flags & XPATHRESULT_PATHS) {
+      arenaSize += getResultNodeXPathLength(document, node) + 1;
+    }
+    if (flags & XPATHRESULT_NODETYPES) {
+      arenaSize += strlen(getNodeTypeName(node->type)) + 1;
+    }
+  }
+
+  arena = (char*) malloc(arenaSize);
+  if (!arena) {
+    result->number = 0;
+    return FAILED;
+  }
+
+  cursor = arena;
+  if (flags & XPATHRESULT_TEXTS) {
+    result->texts = (char**) cursor;
+    cursor += nodes->nodeNr * sizeof(char*);
+  }
+  if (flags & XPATHRESULT_PATHS) {
+    result->paths = (char**) cursor;
+    cursor += nodes->nodeNr * sizeof(char*);
+  }
+  if (flags & XPATHRESULT_NODETYPES) {
+    result->nodeTypes = (char**) cursor;
+    cursor += nodes->nodeNr * sizeof(char*);
+  }
+
+  /* second pass: write the strings behind the pointer arrays */
+  for (i = 0; i < nodes->nodeNr; ++i) {
+    xmlNodePtr node = nodes->nodeTab[i];
+    if (result->texts) {
+      long textLength = getResultNodeTextLength(node);
+      if (textLength >= 0) {
+        result->texts[i] = cursor;
+        writeResultNodeText(node, cursor, (size_t) textLength);
+        cursor += textLength + 1;
+      }
+      else {
+        result->texts[i] = NULL;
+      }
+    }
+    if (result->paths) {
+      size_t pathLength = getResultNodeXPathLength(document, node);
+      result->paths[i] = cursor;
+      writeResultNodeXPath(document, node, cursor, pathLength);
+      cursor += pathLength + 1;
+    }
+    if (result->nodeTypes) {
+      const char* nodeType = getNodeTypeName(node->type);
+      result->nodeTypes[i] = cursor;
+      strcpy(cursor, nodeType);
+      cursor += strlen(nodeType) + 1;
+    }
+  }
+
+  addToMemoryList(document, (void*) arena);
+  return SUCCESS;
+}
+
 DLL_EXPORT ReturnCode tixiXPathExpressionGetTextByIndex(TixiDocumentHandle handle, const char *xPathExpression, int elementNumber, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   int error = SUCCESS;
   char *textPtr = NULL;
@@ -3052,6 +4194,7 @@ DLL_EXPORT ReturnCode tixiXPathExpressionGetTextByIndex(TixiDocumentHandle handl
 
 DLL_EXPORT ReturnCode   tixiGetChildNodeName(const TixiDocumentHandle handle, const char *elementPath,  int index, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   int error = SUCCESS;
@@ -3083,33 +4226,39 @@ DLL_EXPORT ReturnCode   tixiGetChildNodeName(const TixiDocumentHandle handle, co
       return INDEX_OUT_OF_RANGE;
     }
 
-    // return node value according to dom specification: http://www.w3schools.com/dom/dom_nodetype.asp
-    if(child->type == XML_TEXT_NODE){
-      *text = (char *) malloc(10 * sizeof(char));
-      strcpy(*text, "#text");
-    }
-    else if(child->type == XML_CDATA_SECTION_NODE){
-      *text = (char *) malloc(20 * sizeof(char));
-      strcpy(*text, "#cdata-section");
-    }
-    else if(child->type == XML_COMMENT_NODE){
-      *text = (char *) malloc(10 * sizeof(char));
-      strcpy(*text, "#comment");
-    }
-    else if (child->ns && child->ns->prefix) {
-      *text = (char *) malloc((strlen((const char*)child->name) + strlen((const char*)child->ns->prefix) + 4) * sizeof(char));
-      sprintf(*text, "%s:%s", child->ns->prefix, child->name);
-    }
-    else {
-      // get name
-      *text = (char *) malloc((strlen((const char*)child->name) + 3) * sizeof(char));
-      strcpy(*text,  (const char*) child->name);
-    }
+    *text = (char *) malloc((getNodeNameLength(child) + 1) * sizeof(char));
+    writeNodeName(child, *text);
     error = addToMemoryList(document, (void *) *text);
   }
   return error;
 }
 
+DLL_EXPORT ReturnCode tixiGetChildNodeList(const TixiDocumentHandle handle, const char *parentElementPath, int *nChilds,
+                                           char ***names, char ***xpaths, char ***nodeTypes)
+{
+  STATISTICS_FUNCTION();
+  TixiDocument *document = getDocument(handle);
+  xmlNodePtr element = NULL;
+  ReturnCode error = SUCCESS;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return INVALID_HANDLE;
+  }
+
+  if (!nChilds || !names) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Null pointer for nChilds or names in tixiGetChildNodeList.\n");
+    return FAILED;
+  }
+
+  error = checkElement(document->xpathContext, parentElementPath, &element);
+  if (error) {
+    return error;
+  }
+
+  return getChildNodeList(document, element, parentElementPath, nChilds, names, xpaths, nodeTypes);
+}
+
 ReturnCode tixiSwapElements(const TixiDocumentHandle handle, const char* element1Path, const char* element2Path)
 {
     TixiDocument *document = getDocument(handle);
@@ -3144,7 +4293,7 @@ ReturnCode tixiSwapElements(const TixiDocumentHandle handle, const char* element
     }
 
     // swap nodes
-    XPathClearCache(document->xpathCache);
+    clearDocumentCaches(document);
     tmp = xmlCopyNode(element1, 0);
     element1 = xmlReplaceNode(element1, tmp);
     element2 = xmlReplaceNode(element2, element1);
@@ -3156,6 +4305,7 @@ ReturnCode tixiSwapElements(const TixiDocumentHandle handle, const char* element
 
 DLL_EXPORT ReturnCode tixiExportElementAsString(const TixiDocumentHandle handle, const char* elementPath, char **text)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlDocPtr xmlDocument = NULL;
   xmlNodePtr element = NULL;
@@ -3202,11 +4352,13 @@ DLL_EXPORT ReturnCode tixiExportElementAsString(const TixiDocumentHandle handle,
 
 DLL_EXPORT ReturnCode tixiImportElementFromString (const TixiDocumentHandle handle, const char *parentPath, const char *xmlImportString)
 {
+  STATISTICS_FUNCTION();
   return tixiImportElementFromStringAtIndex(handle, parentPath, -1, xmlImportString);
 }
 
 DLL_EXPORT ReturnCode tixiImportElementFromStringAtIndex (const TixiDocumentHandle handle, const char *parentPath, int index, const char *xmlImportString)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlDocPtr xmlDocument = NULL;
   xmlNodePtr parentElement = NULL;
@@ -3250,7 +4402,7 @@ DLL_EXPORT ReturnCode tixiImportElementFromStringAtIndex (const TixiDocumentHand
     targetNode = targetNode->next;
 
   // structure change!, we have to empty the xpath cache
-  XPathClearCache(document->xpathCache);
+  clearDocumentCaches(document);
 
   if (targetNode != NULL && index > 0) {
     /* insert at position index */
@@ -3266,6 +4418,7 @@ DLL_EXPORT ReturnCode tixiImportElementFromStringAtIndex (const TixiDocumentHand
 
 DLL_EXPORT ReturnCode tixiGetNumberOfChilds(const TixiDocumentHandle handle, const char *elementPath, int* nChilds)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   ReturnCode error = SUCCESS;
@@ -3295,6 +4448,7 @@ DLL_EXPORT ReturnCode tixiGetNumberOfChilds(const TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiGetNumberOfAttributes(const TixiDocumentHandle handle, const char *elementPath, int* nAttributes)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   ReturnCode error = SUCCESS;
@@ -3322,6 +4476,7 @@ DLL_EXPORT ReturnCode tixiGetNumberOfAttributes(const TixiDocumentHandle handle,
 
 DLL_EXPORT ReturnCode tixiGetAttributeName(const TixiDocumentHandle handle, const char *elementPath, int attrIndex, char** attrName)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element = NULL;
   ReturnCode error = SUCCESS;
@@ -3369,6 +4524,7 @@ DLL_EXPORT ReturnCode tixiGetAttributeName(const TixiDocumentHandle handle, cons
 
 DLL_EXPORT ReturnCode tixiGetNodeType(const TixiDocumentHandle handle, const char *nodePath, char **nodeType)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   xmlNodePtr element     = NULL;
   int error = SUCCESS;
@@ -3381,72 +4537,9 @@ DLL_EXPORT ReturnCode tixiGetNodeType(const TixiDocumentHandle handle, const cha
   error = checkElement(document->xpathContext, nodePath, &element);
 
   if (!error) {
-    switch (element->type) {
-    case  XML_ELEMENT_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (12 + 3));
-      strcpy(*nodeType, "ELEMENT_NODE");
-      break;
-
-    case  XML_ATTRIBUTE_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (14 + 3));
-      strcpy(*nodeType, "ATTRIBUTE_NODE");
-      break;
-
-    case  XML_TEXT_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (9 + 3));
-      strcpy(*nodeType, "TEXT_NODE");
-      break;
-
-    case  XML_CDATA_SECTION_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (18 + 3));
-      strcpy(*nodeType, "CDATA_SECTION_NODE");
-      break;
-
-    case  XML_ENTITY_REF_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (21 + 3));
-      strcpy(*nodeType, "ENTITY_REFERENCE_NODE");
-      break;
-
-    case  XML_ENTITY_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (11 + 3));
-      strcpy(*nodeType, "ENTITY_NODE");
-      break;
-
-    case  XML_PI_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (27 + 3));
-      strcpy(*nodeType, "PROCESSING_INSTRUCTION_NODE");
-      break;
-
-    case  XML_COMMENT_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (12 + 3));
-      strcpy(*nodeType, "COMMENT_NODE");
-      break;
-
-    case  XML_DOCUMENT_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (13 + 3));
-      strcpy(*nodeType, "DOCUMENT_NODE");
-      break;
-
-    case  XML_DOCUMENT_TYPE_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (18 + 3));
-      strcpy(*nodeType, "DOCUMENT_TYPE_NODE");
-      break;
-
-    case XML_DOCUMENT_FRAG_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (22 + 3));
-      strcpy(*nodeType, "DOCUMENT_FRAGMENT_NODE");
-      break;
-
-    case  XML_NOTATION_NODE:
-      *nodeType = (char*) malloc ( sizeof(char)* (13 + 3));
-      strcpy(*nodeType, "NOTATION_NODE");
-      break;
-
-    default:
-      *nodeType = (char*) malloc ( sizeof(char)* (12 + 3));
-      strcpy(*nodeType, "UNKNOWN_NODE");
-      break;
-    }
+    const char* typeName = getNodeTypeName(element->type);
+    *nodeType = (char*) malloc((strlen(typeName) + 1) * sizeof(char));
+    strcpy(*nodeType, typeName);
 
     error = addToMemoryList(document, (void *) *nodeType);
   }
@@ -3463,6 +4556,7 @@ void tixiDefaultMessageHandler(MessageType type, const char *message)
 
 DLL_EXPORT ReturnCode tixiRegisterNamespace(const TixiDocumentHandle handle, const char* namespaceURI, const char* prefix)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   int code = 0;
 
@@ -3482,6 +4576,7 @@ DLL_EXPORT ReturnCode tixiRegisterNamespace(const TixiDocumentHandle handle, con
 
 DLL_EXPORT ReturnCode tixiRegisterNamespacesFromDocument(const TixiDocumentHandle handle)
 {
+  STATISTICS_FUNCTION();
   TixiDocument *document = getDocument(handle);
   int code = 0;
 
@@ -3501,6 +4596,7 @@ DLL_EXPORT ReturnCode tixiRegisterNamespacesFromDocument(const TixiDocumentHandl
 
 DLL_EXPORT ReturnCode tixiSetElementNamespace(const TixiDocumentHandle handle, const char* elementPath, const char* namespaceURI, const char* prefix)
 {
+  STATISTICS_FUNCTION();
   xmlNodePtr node = NULL;
   ReturnCode retval = SUCCESS;
 
@@ -3525,6 +4621,7 @@ DLL_EXPORT ReturnCode tixiSetElementNamespace(const TixiDocumentHandle handle, c
     return INVALID_XPATH;
   }
 
+  clearDocumentCaches(document);
   if (!nodeSetNamespace(document->docPtr, node, prefix, namespaceURI)) {
     return FAILED;
   }
@@ -3535,6 +4632,7 @@ DLL_EXPORT ReturnCode tixiSetElementNamespace(const TixiDocumentHandle handle, c
 
 DLL_EXPORT ReturnCode tixiDeclareNamespace(const TixiDocumentHandle handle, const char* elementPath, const char* namespaceURI, const char* prefix)
 {
+  STATISTICS_FUNCTION();
   xmlNodePtr node = NULL;
   ReturnCode retval = SUCCESS;
 
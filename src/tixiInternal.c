@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <ctype.h>
+#include <stddef.h>
 
 #include "tixi.h"
 #include "tixiData.h"
@@ -31,14 +32,27 @@
 #include "uidHelper.h"
 #include "tixiUtils.h"
 #include "webMethods.h"
+#include "compression.h"
+#include "statistics.h"
+#include "xpathProfile.h"
+#include "binaryVector.h"
+#include "vectorCache.h"
 #include "namespaceFunctions.h"
+#include "childIndex.h"
+#include "tixiMutex.h"
 #include "libxml/xmlschemas.h"
+#include "libxml/parserInternals.h"
+#include "libxml/hash.h"
+#include "libxml/entities.h"
 
 /**
    @file Auxiliary routines used to implement the interface.
 */
 
 
+/* guards documentListHead, documents may be opened and closed from different threads */
+static TixiMutex documentListMutex = TIXI_MUTEX_INIT;
+
 #ifndef max
 #define max(a, b) (((a) > (b)) ? (a) : (b))
 #endif
@@ -89,6 +103,9 @@ void freeTixiDocument(TixiDocument* document)
     free(document->filename);
     document->filename = NULL;
   }
+#ifdef TIXI_ENABLE_STATISTICS
+  statisticsAddClosedDocument(document);
+#endif
   clearMemoryList(document);
   uid_clearUIDList(document);
 
@@ -101,6 +118,11 @@ void freeTixiDocument(TixiDocument* document)
       XPathFreeCache(document->xpathCache);
       document->xpathCache = NULL;
   }
+  xpathProfileFree(document->xpathProfile);
+  document->xpathProfile = NULL;
+  childIndexClear(document);
+  vectorCacheClear(document);
+  binaryVectorFree(document);
   xmlFreeDoc(document->docPtr);
 
   free(document);
@@ -109,9 +131,12 @@ void freeTixiDocument(TixiDocument* document)
 InternalReturnCode addDocumentToList(TixiDocument* document, TixiDocumentHandle* handle)
 {
 
-  TixiDocumentListEntry* currentEntry = documentListHead;
+  TixiDocumentListEntry* currentEntry = NULL;
   static int handleCounter = 0;
 
+  tixiMutexLock(&documentListMutex);
+  currentEntry = documentListHead;
+
   if (documentListHead) {
 
     while (currentEntry->next) {
@@ -123,6 +148,7 @@ InternalReturnCode addDocumentToList(TixiDocument* document, TixiDocumentHandle*
 
     if (!currentEntry->next) {
 
+      tixiMutexUnlock(&documentListMutex);
       return MEMORY_ALLOCATION_FAILED;
     }
 
@@ -136,6 +162,7 @@ InternalReturnCode addDocumentToList(TixiDocument* document, TixiDocumentHandle*
       documentListHead = currentEntry;
     }
     else {
+      tixiMutexUnlock(&documentListMutex);
       return MEMORY_ALLOCATION_FAILED;
     }
   }
@@ -143,20 +170,29 @@ InternalReturnCode addDocumentToList(TixiDocument* document, TixiDocumentHandle*
   currentEntry->document = document;
   currentEntry->next = NULL;
 
+  /* allows to find the tixi document from an xpath context, see checkElement */
+  if (document->docPtr) {
+    document->docPtr->_private = document;
+  }
+
   handleCounter++;
   *handle = handleCounter;
 
+  tixiMutexUnlock(&documentListMutex);
   return SUCCESS;
 }
 
 ReturnCode removeDocumentFromList(TixiDocumentHandle handle)
 {
 
-  TixiDocumentListEntry* currentEntry = documentListHead;
+  TixiDocumentListEntry* currentEntry = NULL;
   TixiDocumentListEntry* previousEntry = NULL;
 
   ReturnCode returnValue = SUCCESS;
 
+  tixiMutexLock(&documentListMutex);
+  currentEntry = documentListHead;
+
   if (documentListHead) {
 
     while (currentEntry) {
@@ -185,15 +221,19 @@ ReturnCode removeDocumentFromList(TixiDocumentHandle handle)
     returnValue = FAILED;
   }
 
+  tixiMutexUnlock(&documentListMutex);
   return returnValue;
 }
 
 TixiDocument* getDocument(TixiDocumentHandle handle)
 {
 
-  TixiDocumentListEntry* currentEntry = documentListHead;
+  TixiDocumentListEntry* currentEntry = NULL;
   TixiDocument* returnValue = NULL;
 
+  tixiMutexLock(&documentListMutex);
+  currentEntry = documentListHead;
+
   if (currentEntry) {
     while (currentEntry && returnValue == NULL) {
 
@@ -209,9 +249,22 @@ TixiDocument* getDocument(TixiDocumentHandle handle)
     returnValue = NULL;
   }
 
+  tixiMutexUnlock(&documentListMutex);
   return returnValue;
 }
 
+TixiDocumentHandle getFirstDocumentHandle(void)
+{
+  TixiDocumentHandle handle = -1;
+
+  tixiMutexLock(&documentListMutex);
+  if (documentListHead && documentListHead->document) {
+    handle = documentListHead->document->handle;
+  }
+  tixiMutexUnlock(&documentListMutex);
+  return handle;
+}
+
 InternalReturnCode addToMemoryList(TixiDocument* document, void* memory)
 {
 
@@ -244,6 +297,8 @@ InternalReturnCode addToMemoryList(TixiDocument* document, void* memory)
 
   currentEntry->memory = memory;
   currentEntry->next = NULL;
+  STATISTICS_COUNT(document, memoryListEntries);
+  STATISTICS_ADD(document, memoryListBytes, (long long) statisticsAllocatedSize(memory));
 
   return SUCCESS;
 }
@@ -253,7 +308,7 @@ ReturnCode checkExistence(const xmlXPathContextPtr xpathContext, const char* ele
 
   *xpathObject = NULL;
 
-  *xpathObject = xmlXPathEvalExpression((const xmlChar*) elementPath, xpathContext);
+  *xpathObject = XPathEvaluate(xpathContext, elementPath);
   if (!(*xpathObject)) {
     printMsg(MESSAGETYPE_ERROR, "Error: Invalid XPath expression \"%s\"\n", elementPath);
     //xmlXPathFreeObject(*xpathObject);
@@ -310,23 +365,158 @@ ReturnCode checkExternalNode(const xmlNodePtr element)
 }
 
 
+/**
+  Splits paths like "/a/b/name[3]" or "/a/b/name" into the parent path and the last step.
+  The last step must be a plain (optionally prefixed) name with an optional numeric predicate.
+  If the step has no predicate, index is set to -1.
+
+  @return 1, if the path has this form, 0 otherwise
+*/
+static int splitSimpleLastStep(const char* path, size_t* slashPos, size_t* bracketPos, int* index)
+{
+  size_t length = strlen(path);
+  size_t pos = length;
+  size_t nDigits = 0;
+
+  *index = -1;
+  *bracketPos = length;
+
+  if (length > 0 && path[length - 1] == ']') {
+    pos = length - 1;
+    while (pos > 0 && isdigit((unsigned char) path[pos - 1])) {
+      pos--;
+      nDigits++;
+    }
+    if (nDigits == 0 || nDigits > 9 || pos == 0 || path[pos - 1] != '[') {
+      return 0;
+    }
+    *index = atoi(path + pos);
+    pos--;
+    *bracketPos = pos;
+  }
+
+  while (pos > 0 && (isalnum((unsigned char) path[pos - 1]) || strchr("_-.:", path[pos - 1]))) {
+    pos--;
+  }
+
+  /* the step must be preceded by a single slash */
+  if (pos == 0 || pos == *bracketPos || path[pos - 1] != '/' || (pos > 1 && path[pos - 2] == '/')) {
+    return 0;
+  }
+
+  *slashPos = pos - 1;
+  return 1;
+}
+
+/**
+  Resolves simple paths like "/a/b[2]/c[10]" step by step using the child index of
+  the document. Steps that cannot be handled are evaluated with libxml2.
+
+  @return 1, if the path could be resolved (element might be NULL, if it does not exist),
+          0 if the path has to be evaluated by libxml2
+*/
+static int findElementByChildIndex(TixiDocument* document, const xmlXPathContextPtr xpathContext,
+                                   char* path, xmlNodePtr* element)
+{
+  size_t slashPos = 0, bracketPos = 0;
+  int index = -1, count = 0;
+  xmlNodePtr parent = NULL;
+  char* name = NULL;
+  const xmlChar* namespaceURI = NULL;
+  char bracket = 0;
+
+  *element = NULL;
+
+  if (!splitSimpleLastStep(path, &slashPos, &bracketPos, &index)) {
+    return 0;
+  }
+
+  /* resolve parent */
+  if (slashPos == 0) {
+    parent = (xmlNodePtr) xpathContext->doc;
+  }
+  else {
+    path[slashPos] = '\0';
+    if (!findElementByChildIndex(document, xpathContext, path, &parent)) {
+      xmlXPathObjectPtr xpathObject = XPathEvaluate(xpathContext, path);
+      if (xpathObject && xpathObject->nodesetval && xpathObject->nodesetval->nodeNr == 1) {
+        parent = xpathObject->nodesetval->nodeTab[0];
+      }
+      xmlXPathFreeObject(xpathObject);
+      if (!parent) {
+        path[slashPos] = '/';
+        return 0;
+      }
+    }
+    path[slashPos] = '/';
+  }
+
+  if (!parent) {
+    /* parent does not exist */
+    return 1;
+  }
+
+  if (parent->type != XML_ELEMENT_NODE && parent->type != XML_DOCUMENT_NODE) {
+    return 0;
+  }
+
+  bracket = path[bracketPos];
+  path[bracketPos] = '\0';
+  if (!childIndexResolveName(xpathContext, path + slashPos + 1, &name, &namespaceURI)) {
+    path[bracketPos] = bracket;
+    return 0;
+  }
+  path[bracketPos] = bracket;
+
+  if (index < 0) {
+    /* without index, the element must be unique */
+    count = childIndexGetCount(document, parent, (xmlChar*) name, namespaceURI);
+    if (count > 1) {
+      free(name);
+      return 0;
+    }
+    index = 1;
+  }
+
+  *element = childIndexGetChild(document, parent, (xmlChar*) name, namespaceURI, index);
+  free(name);
+  return 1;
+}
+
 ReturnCode checkElement(const xmlXPathContextPtr xpathContext, const char* elementPathDirty,
                         xmlNodePtr* element)
 {
 
   xmlNodeSetPtr nodes = NULL;
   char elementPath[1024];
+  TixiDocument* document = NULL;
+  xmlNodePtr node = NULL;
 
   xmlXPathObjectPtr xpathObject = NULL;
 
   /* remove trailing slash */
   strncpy(elementPath, elementPathDirty, 1024);
+  elementPath[1023] = '\0';
   if(strlen(elementPath) > 1 && elementPath[strlen(elementPath)-1] == '/') {
     elementPath[strlen(elementPath)-1] = '\0';
   }
 
+  /* Use the child index for simple paths, if the document is managed by tixi */
+  document = xpathContext->doc ? (TixiDocument*) xpathContext->doc->_private : NULL;
+  if (document && document->docPtr == xpathContext->doc &&
+      findElementByChildIndex(document, xpathContext, elementPath, &node)) {
+    if (!node) {
+      char * errorStr = buildString("Error: element %s not found!", elementPath);
+      printMsg(MESSAGETYPE_STATUS, errorStr);
+      free(errorStr);
+      return ELEMENT_NOT_FOUND;
+    }
+    *element = node;
+    return SUCCESS;
+  }
+
   /* Evaluate Expression */
-  xpathObject = xmlXPathEvalExpression((xmlChar*) elementPath, xpathContext);
+  xpathObject = XPathEvaluate(xpathContext, elementPath);
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: Invalid XPath expression \"%s\"\n", elementPath);
     return INVALID_XPATH;
@@ -369,6 +559,99 @@ ReturnCode checkElement(const xmlXPathContextPtr xpathContext, const char* eleme
 }
 
 
+/* evaluates the steps as XPath expression "/name[index]/..." */
+static ReturnCode checkElementStepsXPath(TixiDocument* document, const TixiPathStep* steps, int nSteps,
+                                         xmlNodePtr* element)
+{
+  size_t length = 2;
+  char* path = NULL;
+  char* pos = NULL;
+  ReturnCode error = SUCCESS;
+  int i;
+
+  for (i = 0; i < nSteps; ++i) {
+    length += steps[i].nameLength + 14;
+  }
+  path = (char*) malloc(length);
+  if (!path) {
+    return FAILED;
+  }
+
+  pos = path;
+  for (i = 0; i < nSteps; ++i) {
+    *pos++ = '/';
+    memcpy(pos, steps[i].name, steps[i].nameLength);
+    pos += steps[i].nameLength;
+    if (steps[i].index > 0) {
+      pos += sprintf(pos, "[%d]", steps[i].index);
+    }
+    *pos = '\0';
+  }
+
+  error = checkElement(document->xpathContext, path, element);
+  free(path);
+  return error;
+}
+
+ReturnCode checkElementSteps(TixiDocument* document, const TixiPathStep* steps, int nSteps,
+                             xmlNodePtr* element)
+{
+  xmlNodePtr node = (xmlNodePtr) document->docPtr;
+  char qualifiedName[1024];
+  int i;
+
+  if (!steps || nSteps <= 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Element path must consist of at least one step.\n");
+    return INVALID_XPATH;
+  }
+
+  for (i = 0; i < nSteps; ++i) {
+    const TixiPathStep* step = &steps[i];
+    const xmlNodePtr* children = NULL;
+    char* name = NULL;
+    const xmlChar* namespaceURI = NULL;
+    int count = 0;
+    int index = 0;
+
+    if (!step->name || step->nameLength <= 0 || step->nameLength >= (int) sizeof(qualifiedName) || step->index < 0) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Invalid step %d of element path.\n", i + 1);
+      return INVALID_XPATH;
+    }
+    memcpy(qualifiedName, step->name, step->nameLength);
+    qualifiedName[step->nameLength] = '\0';
+
+    /* names without prefix are used directly to avoid copying them */
+    if (!memchr(step->name, ':', step->nameLength)) {
+      if (xmlValidateNCName((xmlChar*) qualifiedName, 0) != 0) {
+        printMsg(MESSAGETYPE_ERROR, "Error: Invalid element name \"%s\".\n", qualifiedName);
+        return INVALID_XPATH;
+      }
+    }
+    else if (!childIndexResolveName(document->xpathContext, qualifiedName, &name, &namespaceURI)) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Invalid element name or unknown namespace prefix \"%s\".\n", qualifiedName);
+      return INVALID_XPATH;
+    }
+
+    children = childIndexGetChildren(document, node, (xmlChar*) (name ? name : qualifiedName), namespaceURI, &count);
+    free(name);
+
+    if (step->index == 0 && count > 1) {
+      /* XPath selects all equally named children and continues with each of them */
+      return checkElementStepsXPath(document, steps, nSteps, element);
+    }
+
+    index = step->index > 0 ? step->index : 1;
+    node = index <= count ? children[index - 1] : NULL;
+    if (!node) {
+      printMsg(MESSAGETYPE_STATUS, "Error: element %s not found!", qualifiedName);
+      return ELEMENT_NOT_FOUND;
+    }
+  }
+
+  *element = node;
+  return SUCCESS;
+}
+
 ReturnCode getCoordinateValue(TixiDocument* document, char* pointPath,
                               int pointIndex, char* name, int ignoreError, double* value)
 {
@@ -621,7 +904,167 @@ char* loadExternalFileToString(const char* filename)
 }
 
 
-ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr externalDataNode, int* fileCounter)
+/* remote external files, which are downloaded in advance */
+typedef struct RemoteFile
+{
+  char* url;
+  xmlDocPtr document;
+  ReturnCode error;
+  int used;
+  struct RemoteFile* next;
+} RemoteFile;
+
+static RemoteFile* findRemoteFile(RemoteFile* remoteFiles, const char* url)
+{
+  for (; remoteFiles; remoteFiles = remoteFiles->next) {
+    if (strcmp(remoteFiles->url, url) == 0) {
+      return remoteFiles;
+    }
+  }
+  return NULL;
+}
+
+static void freeRemoteFiles(RemoteFile* remoteFiles)
+{
+  while (remoteFiles) {
+    RemoteFile* next = remoteFiles->next;
+    free(remoteFiles->url);
+    xmlFreeDoc(remoteFiles->document);
+    free(remoteFiles);
+    remoteFiles = next;
+  }
+}
+
+static xmlChar* getChildContent(const xmlNodePtr node, const char* name, xmlNodePtr* child)
+{
+  for (*child = (*child) ? (*child)->next : node->children; *child; *child = (*child)->next) {
+    if ((*child)->type == XML_ELEMENT_NODE && xmlStrcmp((*child)->name, (const xmlChar*) name) == 0) {
+      return xmlNodeGetContent(*child);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Downloads the remote files of all external data nodes in parallel,
+ * which were not yet downloaded.
+ */
+static void prefetchRemoteFiles(TixiDocument* aTixiDocument, xmlNodeSetPtr externalDataNodes, RemoteFile** remoteFiles)
+{
+  RemoteFile* newFiles = NULL;
+  RemoteFile* file = NULL;
+  const char** urls = NULL;
+  xmlDocPtr* documents = NULL;
+  ReturnCode* errors = NULL;
+  int nURLs = 0;
+  int iNode, iURL;
+
+  for (iNode = 0; iNode < externalDataNodes->nodeNr; ++iNode) {
+    xmlNodePtr node = externalDataNodes->nodeTab[iNode];
+    xmlNodePtr child = NULL;
+    xmlChar* directory = NULL;
+    xmlChar* filename = NULL;
+    char* resolvedDirectory = NULL;
+
+    if (node->type != XML_ELEMENT_NODE || !(directory = getChildContent(node, EXTERNAL_DATA_NODE_NAME_PATH, &child))) {
+      continue;
+    }
+
+    resolvedDirectory = resolveDirectory(aTixiDocument->dirname, (const char*) directory);
+    xmlFree(directory);
+    if (isURIPath(resolvedDirectory) != 0 || string_startsWith(resolvedDirectory, "file://") == 0) {
+      free(resolvedDirectory);
+      continue;
+    }
+
+    child = NULL;
+    while ((filename = getChildContent(node, EXTERNAL_DATA_NODE_NAME_FILENAME, &child)) != NULL) {
+      char* url = buildString("%s%s", resolvedDirectory, (const char*) filename);
+      xmlFree(filename);
+      if (findRemoteFile(*remoteFiles, url) || findRemoteFile(newFiles, url)) {
+        free(url);
+        continue;
+      }
+      file = (RemoteFile*) calloc(1, sizeof(RemoteFile));
+      file->url = url;
+      file->next = newFiles;
+      newFiles = file;
+      nURLs++;
+    }
+    free(resolvedDirectory);
+  }
+
+  if (nURLs == 0) {
+    return;
+  }
+
+  urls = (const char**) malloc(nURLs * sizeof(const char*));
+  documents = (xmlDocPtr*) malloc(nURLs * sizeof(xmlDocPtr));
+  errors = (ReturnCode*) malloc(nURLs * sizeof(ReturnCode));
+  for (file = newFiles, iURL = 0; file; file = file->next, ++iURL) {
+    urls[iURL] = file->url;
+  }
+
+  curlGetURLsAsDocuments(nURLs, urls, XML_PARSE_HUGE, documents, errors);
+
+  for (file = newFiles, iURL = 0; file; file = file->next, ++iURL) {
+    file->document = documents[iURL];
+    file->error = errors[iURL];
+  }
+
+  /* prepend the new files to the list */
+  for (file = newFiles; file->next; file = file->next) {
+  }
+  file->next = *remoteFiles;
+  *remoteFiles = newFiles;
+
+  free(errors);
+  free(documents);
+  free((void*) urls);
+}
+
+/* opens and parses an external file, remote files are taken from the prefetched ones */
+static ReturnCode loadExternalDocument(RemoteFile* remoteFiles, const char* filename, xmlDocPtr* document)
+{
+  RemoteFile* file = findRemoteFile(remoteFiles, filename);
+  char* content = NULL;
+
+  if (file && !file->used) {
+    *document = file->document;
+    file->document = NULL;
+    file->used = 1;
+    return file->error;
+  }
+
+  if (isURIPath(filename) != 0 || string_startsWith(filename, "file://") == 0) {
+    /* local files are read by libxml2, which also decompresses them */
+    char* localPath = isURIPath(filename) != 0 ? buildString("%s", filename) : uriToLocalPath(filename);
+    FILE* localFile = localPath ? fopen(localPath, "rb") : NULL;
+
+    *document = NULL;
+    if (!localFile) {
+      free(localPath);
+      return OPEN_FAILED;
+    }
+    fclose(localFile);
+
+    *document = xmlReadFile(localPath, NULL, XML_PARSE_HUGE);
+    free(localPath);
+    return *document ? SUCCESS : NOT_WELL_FORMED;
+  }
+
+  content = loadExternalFileToString(filename);
+  if (!content) {
+    *document = NULL;
+    return OPEN_FAILED;
+  }
+  *document = xmlReadMemory(content, (int) strlen(content), "urlResource", NULL, XML_PARSE_HUGE);
+  free(content);
+  return *document ? SUCCESS : NOT_WELL_FORMED;
+}
+
+static ReturnCode loadExternalDataNodeWithRemoteFiles(TixiDocument* aTixiDocument, xmlNodePtr externalDataNode,
+                                                      int* fileCounter, RemoteFile* remoteFiles)
 {
     int handle = aTixiDocument->handle;
     char* externalDataNodeXPath, *externalDataDirectoryXPath, *externalDataDirectory, *resolvedDirectory;
@@ -657,7 +1100,7 @@ ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr external
     }
 
     for (iNode = 1; iNode <= externalFileCount; iNode++) {
-      char* externalFileName, *externalFullFileName, *newDocumentString, *fileNameXPath;
+      char* externalFileName, *externalFullFileName, *fileNameXPath;
       xmlDocPtr xmlDocument = NULL;
 
       fileNameXPath = buildString("%s/filename[%d]", externalDataNodeXPath, iNode);
@@ -668,9 +1111,8 @@ ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr external
       /* Build complete filename */
       externalFullFileName = buildString("%s%s", resolvedDirectory, externalFileName);
 
-      /* open files */
-      newDocumentString = loadExternalFileToString(externalFullFileName);
-      if (newDocumentString == NULL) {
+      /* open and parse the file to DOM */
+      if (loadExternalDocument(remoteFiles, externalFullFileName, &xmlDocument) == OPEN_FAILED) {
         printMsg(MESSAGETYPE_ERROR, "\nError in fetching external file \"%s\".\n", externalFullFileName);
         free(externalFullFileName);
         xmlFree(externalDataNodeXPath);
@@ -678,10 +1120,6 @@ ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr external
         return OPEN_FAILED;
       }
 
-      /* now parse the file to DOM */
-      xmlDocument = xmlReadMemory(newDocumentString, (int) strlen(newDocumentString), "urlResource", NULL, XML_PARSE_HUGE);
-      free(newDocumentString);
-
       if (xmlDocument) {
         xmlNodePtr rootToInsert = xmlDocGetRootElement(xmlDocument);
 
@@ -726,13 +1164,20 @@ ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr external
     free(resolvedDirectory);
     free(externalDataNodeXPath);
     xmlFreeNode(externalDataNode);
+    clearDocumentCaches(aTixiDocument);
 
     return SUCCESS;
 
 }
 
+ReturnCode loadExternalDataNode(TixiDocument* aTixiDocument, xmlNodePtr externalDataNode, int* fileCounter)
+{
+  return loadExternalDataNodeWithRemoteFiles(aTixiDocument, externalDataNode, fileCounter, NULL);
+}
+
 ReturnCode openExternalFiles(TixiDocument* aTixiDocument, int* number)
 {
+  RemoteFile* remoteFiles = NULL;
   int iNode = 0;
 
   assert(aTixiDocument != NULL);
@@ -765,18 +1210,23 @@ ReturnCode openExternalFiles(TixiDocument* aTixiDocument, int* number)
     }
     if (iNode == nodeset->nodeNr) {
       // no element node found
-      XPathClearCache(aTixiDocument->xpathCache);
+      clearDocumentCaches(aTixiDocument);
       break; // while loop
     }
 
-    XPathClearCache(aTixiDocument->xpathCache);
+    /* download all remote files at once, the nodeset is invalidated by clearing the caches */
+    prefetchRemoteFiles(aTixiDocument, nodeset, &remoteFiles);
+
+    clearDocumentCaches(aTixiDocument);
 
-    errCode = loadExternalDataNode(aTixiDocument, cur, number);
+    errCode = loadExternalDataNodeWithRemoteFiles(aTixiDocument, cur, number, remoteFiles);
     if (errCode != SUCCESS) {
+        freeRemoteFiles(remoteFiles);
         return errCode;
     }
   }
 
+  freeRemoteFiles(remoteFiles);
   return SUCCESS;
 }
 
@@ -825,14 +1275,12 @@ xmlNodePtr createExternalNode(const char* urlPath, const char* filename)
 
 ReturnCode saveExternalFiles(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
 {
-  TixiDocumentHandle handle = aTixiDocument->handle;
   xmlNodePtr cur_node = NULL;
   xmlNodePtr copiedNode = NULL;
   xmlNodePtr externalNode = NULL;
   char* externalDataDirectory = NULL;
   char* externalFileName = NULL;
   char* fullExternalFileName = NULL;
-  char* externalDataNodePath = NULL;
   xmlDocPtr xmlDocument = NULL;
 
   /* find external data nodes */
@@ -847,22 +1295,11 @@ ReturnCode saveExternalFiles(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
 
     if ( cur_node->type == XML_ELEMENT_NODE ) {
       char* dirResolved = NULL;
-      char* includetNodeName = (char*) xmlGetNodePath(cur_node);
-
-      /* collect node information - externalFileName */
-      tixiGetTextAttribute(handle, includetNodeName,
-                           EXTERNAL_DATA_XML_ATTR_FILENAME, &externalFileName);
-
-      /* collect node information - externalDataDirectory */
-      tixiGetTextAttribute(handle, includetNodeName,
-                           EXTERNAL_DATA_XML_ATTR_DIRECTORY, &externalDataDirectory);
-
-      /* collect node information - externalDataNodePath */
-      tixiGetTextAttribute(handle, includetNodeName,
-                           EXTERNAL_DATA_XML_ATTR_NODEPATH, &externalDataNodePath);
-
-      free(includetNodeName);
 
+      /* collect node information directly from the node, the nodes of the
+       * document are replaced below and the xpath caches would be stale */
+      externalFileName = (char*) xmlGetProp(cur_node, (xmlChar*) EXTERNAL_DATA_XML_ATTR_FILENAME);
+      externalDataDirectory = (char*) xmlGetProp(cur_node, (xmlChar*) EXTERNAL_DATA_XML_ATTR_DIRECTORY);
 
       /* remove attributes */
       xmlUnsetProp(cur_node, (xmlChar*) EXTERNAL_DATA_XML_ATTR_FILENAME);
@@ -874,6 +1311,8 @@ ReturnCode saveExternalFiles(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
       xmlDocument = xmlNewDoc((xmlChar*) "1.0");
       if (!xmlDocument) {
         printMsg(MESSAGETYPE_ERROR, "Error in TIXI::saveExternalFiles ==> Could not create new document.\n");
+        xmlFree(externalFileName);
+        xmlFree(externalDataDirectory);
         return FAILED;
       }
 
@@ -890,7 +1329,7 @@ ReturnCode saveExternalFiles(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
         assert(externalDataDirectoryNotUrl);
 
         fullExternalFileName = buildString("%s%s", externalDataDirectoryNotUrl, externalFileName);
-        xmlSaveFormatFileEnc(fullExternalFileName, xmlDocument, "utf-8", 1);
+        compressionSaveDocument(fullExternalFileName, xmlDocument, 1, 0);
         free(fullExternalFileName);
         free(externalDataDirectoryNotUrl);
       }
@@ -900,9 +1339,12 @@ ReturnCode saveExternalFiles(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
       /* create external data node structure */
       externalNode = createExternalNode(externalDataDirectory, externalFileName);
       xmlReplaceNode(cur_node, externalNode);
+      xmlFree(externalFileName);
+      xmlFree(externalDataDirectory);
 
       /* remove old node */
       xmlFreeNode(cur_node);
+      clearDocumentCaches(aTixiDocument);
 
       cur_node = externalNode;
 
@@ -925,6 +1367,7 @@ void removeExternalNodes(xmlNodePtr aNodePtr, TixiDocument* aTixiDocument)
       xmlNodePtr next = cur_node->next;
       xmlUnlinkNode(cur_node);
       xmlFreeNode(cur_node);
+      clearDocumentCaches(aTixiDocument);
       cur_node = next;
     }
     else {
@@ -948,7 +1391,7 @@ xmlNodePtr getParentNodeToXPath(TixiDocumentHandle handle, const char* elementPa
     return parent;
   }
 
-  xpathObject = xmlXPathEvalExpression((xmlChar*) elementPath, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, elementPath);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", elementPath);
@@ -1049,7 +1492,7 @@ ReturnCode getNodePtrFromElementPath(TixiDocumentHandle handle, const char* elem
     return INVALID_HANDLE;
   }
 
-  xpathObject = xmlXPathEvalExpression((xmlChar*) elementPath, document->xpathContext);
+  xpathObject = XPathEvaluate(document->xpathContext, elementPath);
 
   if (!xpathObject) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to evaluate xpath expression \"%s\"\n", elementPath);
@@ -1152,6 +1595,14 @@ int copyDocument(const TixiDocumentHandle oldTixiDocumentHandle, TixiDocumentHan
   dstDocument->usePrettyPrint = srcDocument->usePrettyPrint;
   dstDocument->xpathContext = xmlXPathNewContext(xmlDocument);
   dstDocument->xpathCache = XPathNewCache();
+  dstDocument->childIndex = NULL;
+  dstDocument->vectorCache = NULL;
+  dstDocument->binaryVectors = NULL;
+  dstDocument->xpathProfile = NULL;
+  memset(&dstDocument->statistics, 0, sizeof(DocumentStatistics));
+  if (dstDocument->xpathContext) {
+    dstDocument->xpathContext->user = dstDocument;
+  }
 
   if (addDocumentToList(dstDocument, &(dstDocument->handle)) != SUCESS) {
     printMsg(MESSAGETYPE_ERROR, "Error in TIXI::copyDocument => Failed  adding document to document list.");
@@ -1180,8 +1631,14 @@ ReturnCode saveDocument (TixiDocumentHandle handle, const char* xmlFilename, Int
     return INVALID_HANDLE;
   }
 
+  /* the attributes of binary vectors refer to the new sidecar file before the document is written */
+  if (binaryVectorSave(document, xmlFilename) != SUCCESS) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Failed in writing binary vectors of the document.\n");
+    return FAILED;
+  }
+
   if (saveMode == COMPLETE) {
-    if (xmlSaveFormatFileEnc(xmlFilename, document->docPtr, "utf-8", document->usePrettyPrint) == -1) {
+    if (compressionSaveDocument(xmlFilename, document->docPtr, document->usePrettyPrint, 0) == -1) {
       printMsg(MESSAGETYPE_ERROR, "Error: Failed in writing document to file.\n");
       return FAILED;
     };
@@ -1205,7 +1662,7 @@ ReturnCode saveDocument (TixiDocumentHandle handle, const char* xmlFilename, Int
     rootNode = xmlDocGetRootElement(cpyDoc->docPtr);
     saveExternalFiles(rootNode, cpyDoc);
 
-    if (xmlSaveFormatFileEnc(xmlFilename, cpyDoc->docPtr, "utf-8", document->usePrettyPrint) == -1) {
+    if (compressionSaveDocument(xmlFilename, cpyDoc->docPtr, document->usePrettyPrint, 0) == -1) {
       printMsg(MESSAGETYPE_ERROR, "Error: Failed in writing document to file.\n");
       return FAILED;
     };
@@ -1220,7 +1677,7 @@ ReturnCode saveDocument (TixiDocumentHandle handle, const char* xmlFilename, Int
     rootNode = xmlDocGetRootElement(cpyDoc->docPtr);
     removeExternalNodes(rootNode, cpyDoc);
 
-    if (xmlSaveFormatFileEnc(xmlFilename, cpyDoc->docPtr, "utf-8", cpyDoc->usePrettyPrint) == -1) {
+    if (compressionSaveDocument(xmlFilename, cpyDoc->docPtr, cpyDoc->usePrettyPrint, 0) == -1) {
       printMsg(MESSAGETYPE_ERROR, "Error: Failed in writing document to file.\n");
       return FAILED;
     };
@@ -1245,14 +1702,19 @@ ReturnCode validateSchema(const TixiDocumentHandle handle, xmlDocPtr* schema_doc
   TixiDocument* document = getDocument(handle);
   xmlSchemaParserCtxtPtr parser_ctxt;
   xmlSchemaPtr schema;
-  xmlSchemaValidCtxtPtr valid_ctxt;
-  int is_valid;
+  ReturnCode error;
 
   if (*schema_doc == NULL) {
     /* the schema cannot be loaded or is not well-formed */
     return OPEN_SCHEMA_FAILED;
   }
 
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    xmlFreeDoc(*schema_doc);
+    return INVALID_HANDLE;
+  }
+
   parser_ctxt = xmlSchemaNewDocParserCtxt(*schema_doc);
   if (parser_ctxt == NULL) {
     printMsg(MESSAGETYPE_ERROR, "Error: validateSchema: unable to create a parser context for the schema.\n");
@@ -1266,12 +1728,22 @@ ReturnCode validateSchema(const TixiDocumentHandle handle, xmlDocPtr* schema_doc
     xmlFreeDoc(*schema_doc);
     return FAILED;
   }
+
+  error = validateDocumentWithSchema(document, schema, withDefaults);
+  xmlSchemaFree(schema);
+  xmlSchemaFreeParserCtxt(parser_ctxt);
+  xmlFreeDoc(*schema_doc);
+  return error;
+}
+
+ReturnCode validateDocumentWithSchema(TixiDocument* document, xmlSchemaPtr schema, int withDefaults)
+{
+  xmlSchemaValidCtxtPtr valid_ctxt;
+  int is_valid;
+
   valid_ctxt = xmlSchemaNewValidCtxt(schema);
   if (valid_ctxt == NULL) {
     printMsg(MESSAGETYPE_ERROR, "Error: validateSchema: unable to create a validation context for the schema.\n");
-    xmlSchemaFree(schema);
-    xmlSchemaFreeParserCtxt(parser_ctxt);
-    xmlFreeDoc(*schema_doc);
     return FAILED;
   }
 
@@ -1282,9 +1754,11 @@ ReturnCode validateSchema(const TixiDocumentHandle handle, xmlDocPtr* schema_doc
   }
   is_valid = (xmlSchemaValidateDoc(valid_ctxt, document->docPtr) == 0);
   xmlSchemaFreeValidCtxt(valid_ctxt);
-  xmlSchemaFree(schema);
-  xmlSchemaFreeParserCtxt(parser_ctxt);
-  xmlFreeDoc(*schema_doc);
+
+  if (withDefaults) {
+    /* default elements and attributes may have been added */
+    clearDocumentCaches(document);
+  }
 
   if (is_valid) {
     return SUCCESS;
@@ -1294,52 +1768,408 @@ ReturnCode validateSchema(const TixiDocumentHandle handle, xmlDocPtr* schema_doc
   }
 }
 
-char* generateXPathFromNodePtr(TixiDocumentHandle handle, xmlNodePtr aNodePtr)
+/* reports a validation error and stops the parser, such that invalid documents are rejected early */
+static void streamValidationErrorHandler(void* userData, xmlError const* error)
 {
-  xmlNodePtr nodePtr = aNodePtr;
-  TixiDocument* document = getDocument(handle);
-  char* generatedXPath = NULL;
-  char* textPtr = NULL;
-  char* tmpText = NULL;
-  char* nodeName = NULL;
-  size_t size = 0;
-  generatedXPath = malloc(1 * sizeof(char));
-  generatedXPath[0] = '\0';
+  xmlStructuredErrorHandler(NULL, error);
+  xmlStopParser((xmlParserCtxtPtr) userData);
+}
 
-  if (!document) {
-    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
-    free(generatedXPath);
+ReturnCode readDocumentWithSchema(const char* xmlFilename, xmlSchemaPtr schema, xmlDocPtr* xmlDocument)
+{
+  xmlParserCtxtPtr parserContext = NULL;
+  xmlSchemaValidCtxtPtr validContext = NULL;
+  xmlSchemaSAXPlugPtr plug = NULL;
+  ReturnCode error = SUCCESS;
+
+  *xmlDocument = NULL;
+
+  /* same options as xmlReadFile in tixiOpenDocument */
+  parserContext = xmlCreateURLParserCtxt(xmlFilename, XML_PARSE_HUGE);
+  if (!parserContext) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Unable to open file \"%s\".\n", xmlFilename);
+    return OPEN_FAILED;
+  }
+
+  validContext = xmlSchemaNewValidCtxt(schema);
+  if (!validContext) {
+    printMsg(MESSAGETYPE_ERROR, "Error: unable to create a validation context for the schema.\n");
+    xmlFreeParserCtxt(parserContext);
+    return FAILED;
+  }
+  /* the error is const since libxml2 2.12, the handler fits both signatures */
+  xmlSchemaSetValidStructuredErrors(validContext, (xmlStructuredErrorFunc) streamValidationErrorHandler, parserContext);
+
+  plug = xmlSchemaSAXPlug(validContext, &parserContext->sax, &parserContext->userData);
+  if (!plug) {
+    printMsg(MESSAGETYPE_ERROR, "Error: unable to plug the schema validation into the parser.\n");
+    xmlSchemaFreeValidCtxt(validContext);
+    xmlFreeParserCtxt(parserContext);
+    return FAILED;
+  }
+
+  xmlParseDocument(parserContext);
+  xmlSchemaSAXUnplug(plug);
+
+  if (xmlSchemaIsValid(validContext) != 1) {
+    printMsg(MESSAGETYPE_ERROR, "Error: \"%s\" is not schema compliant.\n", xmlFilename);
+    error = NOT_SCHEMA_COMPLIANT;
+  }
+  else if (!parserContext->wellFormed) {
+    printMsg(MESSAGETYPE_ERROR, "Error: \"%s\" is not a wellformed XML-file.\n", xmlFilename);
+    error = NOT_WELL_FORMED;
+  }
+
+  if (error == SUCCESS) {
+    *xmlDocument = parserContext->myDoc;
+  }
+  else {
+    xmlFreeDoc(parserContext->myDoc);
+  }
+  parserContext->myDoc = NULL;
+
+  xmlSchemaFreeValidCtxt(validContext);
+  xmlFreeParserCtxt(parserContext);
+  return error;
+}
+
+/* value of the uID attribute of an element without copying it, NULL if there is none */
+static const xmlChar* getNodeUID(const xmlNodePtr node)
+{
+  xmlAttrPtr attribute = xmlHasProp(node, (const xmlChar*) "uID");
+  if (!attribute) {
     return NULL;
   }
+  if (attribute->children && attribute->children->type == XML_TEXT_NODE && !attribute->children->next) {
+    return attribute->children->content;
+  }
+  return (const xmlChar*) "";
+}
+
+static int isSameElementName(const xmlNodePtr node, const xmlNodePtr other)
+{
+  const xmlChar* namespaceURI = node->ns ? node->ns->href : NULL;
+  const xmlChar* otherNamespaceURI = other->ns ? other->ns->href : NULL;
+  return other->type == XML_ELEMENT_NODE
+         && xmlStrEqual(node->name, other->name)
+         && xmlStrEqual(namespaceURI, otherNamespaceURI);
+}
+
+/* position of an element among its equally named siblings, 0 if it has no such siblings */
+static int getElementPosition(TixiDocument* document, const xmlNodePtr node)
+{
+  xmlNodePtr sibling = NULL;
+  int count = 0;
+  int position = document ? childIndexGetPosition(document, node, &count) : -1;
+
+  if (position > 0) {
+    return count > 1 ? position : 0;
+  }
+
+  /* without an index, the siblings are scanned */
+  position = 1;
+
+  for (sibling = node->prev; sibling; sibling = sibling->prev) {
+    if (isSameElementName(node, sibling)) {
+      position++;
+    }
+  }
+  if (position > 1) {
+    return position;
+  }
+  for (sibling = node->next; sibling; sibling = sibling->next) {
+    if (isSameElementName(node, sibling)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* parts of the path step "/prefix:name[predicate]" of an element */
+typedef struct {
+  const xmlChar* prefix;
+  const xmlChar* uID;
+  size_t prefixLength;
+  size_t nameLength;
+  size_t predicateLength;
+  char positionText[16];
+} ElementStep;
+
+/* collects the parts of the path step of an element and returns its length */
+static size_t getElementStep(TixiDocument* document, const xmlNodePtr node, ElementStep* step)
+{
+  int position = 0;
+
+  step->prefix = node->ns ? node->ns->prefix : NULL;
+  step->uID = getNodeUID(node);
+  step->prefixLength = step->prefix ? strlen((const char*) step->prefix) + 1 : 0;
+  step->nameLength = strlen((const char*) node->name);
+  step->predicateLength = 0;
+  step->positionText[0] = '\0';
+
+  if (step->uID) {
+    step->predicateLength = strlen("[@uID=\"\"]") + strlen((const char*) step->uID);
+  }
+  else if ((position = getElementPosition(document, node)) > 0) {
+    step->predicateLength = (size_t) sprintf(step->positionText, "[%d]", position);
+  }
+
+  return 1 + step->prefixLength + step->nameLength + step->predicateLength;
+}
+
+/* writes the path step to buffer without terminating it */
+static void writeElementStep(const xmlNodePtr node, const ElementStep* step, char* buffer)
+{
+  *buffer++ = '/';
+  if (step->prefix) {
+    memcpy(buffer, step->prefix, step->prefixLength - 1);
+    buffer[step->prefixLength - 1] = ':';
+    buffer += step->prefixLength;
+  }
+  memcpy(buffer, node->name, step->nameLength);
+  buffer += step->nameLength;
+  if (step->uID) {
+    size_t uIDLength = step->predicateLength - strlen("[@uID=\"\"]");
+    memcpy(buffer, "[@uID=\"", 7);
+    memcpy(buffer + 7, step->uID, uIDLength);
+    memcpy(buffer + 7 + uIDLength, "\"]", 2);
+  }
+  else {
+    memcpy(buffer, step->positionText, step->predicateLength);
+  }
+}
+
+size_t getNodeXPathLength(TixiDocument* document, const xmlNodePtr node)
+{
+  xmlNodePtr nodePtr = NULL;
+  size_t length = 0;
 
-  while ((nodePtr != NULL) && (nodePtr->parent != NULL)) {
+  ElementStep step;
+
+  for (nodePtr = node; nodePtr && nodePtr->parent; nodePtr = nodePtr->parent) {
     if (nodePtr->type == XML_ELEMENT_NODE) {
+      length += getElementStep(document, nodePtr, &step);
+    }
+  }
+  return length;
+}
 
-      /* handle uIDs */
-      textPtr = (char*) xmlGetProp(nodePtr, (xmlChar*) "uID");
-      if (textPtr) {
-        // do something with the attribute...
-        size = strlen((char*) nodePtr->name) + strlen(textPtr) + strlen("[@uID=\"\"]") + 1;
-        nodeName = (char*) malloc(size * sizeof(char));
-        sprintf(nodeName, "%s[@uID=\"%s\"]", nodePtr->name, textPtr);
-        xmlFree(textPtr);
-      }
-      else {
-        nodeName = (char*) malloc((strlen((char*) nodePtr->name) + 1) * sizeof(char));
-        strcpy(nodeName, (char*) nodePtr->name);
+void writeNodeXPath(TixiDocument* document, const xmlNodePtr node, char* buffer, size_t length)
+{
+  xmlNodePtr nodePtr = NULL;
+  char* end = buffer + length;
+  ElementStep step;
+
+  *end = '\0';
+  for (nodePtr = node; nodePtr && nodePtr->parent; nodePtr = nodePtr->parent) {
+    if (nodePtr->type == XML_ELEMENT_NODE) {
+      end -= getElementStep(document, nodePtr, &step);
+      writeElementStep(nodePtr, &step, end);
+    }
+  }
+}
+
+static int isSameNodeTest(const xmlNodePtr node, const xmlNodePtr other)
+{
+  if (node->type == XML_TEXT_NODE || node->type == XML_CDATA_SECTION_NODE) {
+    return other->type == XML_TEXT_NODE || other->type == XML_CDATA_SECTION_NODE;
+  }
+  return other->type == node->type;
+}
+
+/* position of a text, comment or processing instruction node among its siblings of the same kind */
+static int getNodeTestPosition(const xmlNodePtr node)
+{
+  xmlNodePtr sibling = NULL;
+  int position = 1;
+
+  for (sibling = node->prev; sibling; sibling = sibling->prev) {
+    if (isSameNodeTest(node, sibling)) {
+      position++;
+    }
+  }
+  return position;
+}
+
+/* the element containing a result node, or the node itself if it is an element */
+static xmlNodePtr getResultNodeElement(const xmlNodePtr node)
+{
+  if (node->type == XML_NAMESPACE_DECL) {
+    /* xpath stores the parent element of namespace nodes in next */
+    return (xmlNodePtr) ((xmlNsPtr) node)->next;
+  }
+  return node->type == XML_ELEMENT_NODE ? node : node->parent;
+}
+
+/* writes the last path step of a non-element result node, e.g. "/@name" or "/text()[2]",
+ * as with snprintf, and returns its length */
+static size_t writeResultNodeStep(const xmlNodePtr node, char* buffer, size_t size)
+{
+  int length = 0;
+
+  switch (node->type) {
+  case XML_ATTRIBUTE_NODE:
+    if (node->ns && node->ns->prefix) {
+      length = snprintf(buffer, size, "/@%s:%s", (const char*) node->ns->prefix, (const char*) node->name);
+    }
+    else {
+      length = snprintf(buffer, size, "/@%s", (const char*) node->name);
+    }
+    break;
+  case XML_TEXT_NODE:
+  case XML_CDATA_SECTION_NODE:
+    length = snprintf(buffer, size, "/text()[%d]", getNodeTestPosition(node));
+    break;
+  case XML_COMMENT_NODE:
+    length = snprintf(buffer, size, "/comment()[%d]", getNodeTestPosition(node));
+    break;
+  case XML_PI_NODE:
+    length = snprintf(buffer, size, "/processing-instruction()[%d]", getNodeTestPosition(node));
+    break;
+  case XML_NAMESPACE_DECL:
+    if (((xmlNsPtr) node)->prefix) {
+      length = snprintf(buffer, size, "/namespace::%s", (const char*) ((xmlNsPtr) node)->prefix);
+    }
+    else {
+      length = snprintf(buffer, size, "/namespace::*[not(name())]");
+    }
+    break;
+  case XML_DOCUMENT_NODE:
+    length = snprintf(buffer, size, "/");
+    break;
+  default:
+    break;
+  }
+
+  return length > 0 ? (size_t) length : 0;
+}
+
+size_t getResultNodeXPathLength(TixiDocument* document, const xmlNodePtr node)
+{
+  return getNodeXPathLength(document, getResultNodeElement(node)) + writeResultNodeStep(node, NULL, 0);
+}
+
+void writeResultNodeXPath(TixiDocument* document, const xmlNodePtr node, char* buffer, size_t length)
+{
+  size_t stepLength = writeResultNodeStep(node, NULL, 0);
+
+  writeNodeXPath(document, getResultNodeElement(node), buffer, length - stepLength);
+  writeResultNodeStep(node, buffer + length - stepLength, stepLength + 1);
+}
+
+/* 1, if xmlEncodeEntitiesReentrant would change the text */
+static int textNeedsEscaping(const xmlChar* text)
+{
+  for (; *text; ++text) {
+    if (*text == '&' || *text == '<' || *text == '>' || *text == '\r' || *text >= 0x80) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* appends the text content of the element children list to buffer, if not NULL, like
+ * xmlNodeListGetString(doc, list, 0), i.e. with special characters escaped as entities.
+ * At most capacity characters are written into buffer. */
+static long writeElementText(const xmlNodePtr element, char* buffer, size_t capacity)
+{
+  xmlNodePtr child = NULL;
+  long length = -1;
+
+  for (child = element->children; child; child = child->next) {
+    const xmlChar* content = NULL;
+    xmlChar* escaped = NULL;
+    size_t childLength = 0;
+
+    if (child->type == XML_TEXT_NODE || child->type == XML_CDATA_SECTION_NODE) {
+      content = child->content ? child->content : (const xmlChar*) "";
+      /* most texts contain no special characters and are copied without allocation */
+      if (textNeedsEscaping(content)) {
+        escaped = xmlEncodeEntitiesReentrant(element->doc, content);
       }
+    }
+    else if (child->type == XML_ENTITY_REF_NODE) {
+      escaped = xmlStrncatNew((const xmlChar*) "&", child->name, -1);
+      escaped = xmlStrcat(escaped, (const xmlChar*) ";");
+      content = (const xmlChar*) "";
+    }
+    else {
+      continue;
+    }
 
-      tmpText = (char*) malloc((strlen(generatedXPath) + 1) * sizeof(char));
-      strcpy(tmpText, generatedXPath);
-      free(generatedXPath);
-      generatedXPath = (char*) malloc((strlen(tmpText) + strlen(nodeName) + 2) * sizeof(char));     // + slash + null
-      sprintf(generatedXPath, "/%s%s", nodeName, tmpText);
-      free(tmpText);
-      free(nodeName);
+    if (escaped) {
+      content = escaped;
     }
-    nodePtr = nodePtr->parent;
+    childLength = strlen((const char*) content);
+    if (buffer) {
+      childLength = childLength < capacity ? childLength : capacity;
+      memcpy(buffer, content, childLength);
+      buffer += childLength;
+      capacity -= childLength;
+    }
+    xmlFree(escaped);
+
+    length = (length < 0 ? 0 : length) + (long) childLength;
+  }
+
+  return length;
+}
+
+/* the text of a result node stored directly in the tree, NULL for element nodes */
+static const xmlChar* getResultNodeContent(const xmlNodePtr node)
+{
+  switch (node->type) {
+  case XML_ATTRIBUTE_NODE:
+    return node->children ? node->children->content : NULL;
+  case XML_TEXT_NODE:
+  case XML_CDATA_SECTION_NODE:
+  case XML_COMMENT_NODE:
+  case XML_PI_NODE:
+    return node->content;
+  case XML_NAMESPACE_DECL:
+    return ((xmlNsPtr) node)->href;
+  default:
+    return NULL;
+  }
+}
+
+long getResultNodeTextLength(const xmlNodePtr node)
+{
+  const xmlChar* content = NULL;
+
+  if (node->type == XML_ELEMENT_NODE) {
+    return writeElementText(node, NULL, 0);
+  }
+  content = getResultNodeContent(node);
+  return content ? (long) strlen((const char*) content) : -1;
+}
+
+void writeResultNodeText(const xmlNodePtr node, char* buffer, size_t length)
+{
+  if (node->type == XML_ELEMENT_NODE) {
+    writeElementText(node, buffer, length);
+  }
+  else {
+    memcpy(buffer, getResultNodeContent(node), length);
+  }
+  buffer[length] = '\0';
+}
+
+char* generateXPathFromNodePtr(TixiDocumentHandle handle, xmlNodePtr aNodePtr)
+{
+  TixiDocument* document = getDocument(handle);
+  char* generatedXPath = NULL;
+  size_t length = 0;
+
+  if (!document) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Invalid document handle.\n");
+    return NULL;
   }
 
+  length = getNodeXPathLength(document, aNodePtr);
+  generatedXPath = (char*) malloc((length + 1) * sizeof(char));
+  writeNodeXPath(document, aNodePtr, generatedXPath, length);
+
   addToMemoryList(document, (void*) generatedXPath);
   return generatedXPath;
 }
@@ -1366,3 +2196,234 @@ int getChildNodeCount(const xmlNodePtr nodePtr)
     return i--;
 }
 
+void clearDocumentCaches(TixiDocument* document)
+{
+  XPathClearCache(document->xpathCache);
+  childIndexClear(document);
+  vectorCacheClear(document);
+}
+
+
+size_t getNodeNameLength(const xmlNodePtr node)
+{
+  switch (node->type) {
+  case XML_TEXT_NODE:
+    return strlen("#text");
+  case XML_CDATA_SECTION_NODE:
+    return strlen("#cdata-section");
+  case XML_COMMENT_NODE:
+    return strlen("#comment");
+  default:
+    if (node->ns && node->ns->prefix) {
+      return strlen((const char*) node->ns->prefix) + 1 + strlen((const char*) node->name);
+    }
+    return strlen((const char*) node->name);
+  }
+}
+
+char* writeNodeName(const xmlNodePtr node, char* buffer)
+{
+  // return node value according to dom specification: http://www.w3schools.com/dom/dom_nodetype.asp
+  switch (node->type) {
+  case XML_TEXT_NODE:
+    strcpy(buffer, "#text");
+    break;
+  case XML_CDATA_SECTION_NODE:
+    strcpy(buffer, "#cdata-section");
+    break;
+  case XML_COMMENT_NODE:
+    strcpy(buffer, "#comment");
+    break;
+  default:
+    if (node->ns && node->ns->prefix) {
+      sprintf(buffer, "%s:%s", node->ns->prefix, node->name);
+    }
+    else {
+      strcpy(buffer, (const char*) node->name);
+    }
+  }
+  return buffer + strlen(buffer) + 1;
+}
+
+const char* getNodeTypeName(xmlElementType type)
+{
+  switch (type) {
+  case XML_ELEMENT_NODE:
+    return "ELEMENT_NODE";
+  case XML_ATTRIBUTE_NODE:
+    return "ATTRIBUTE_NODE";
+  case XML_TEXT_NODE:
+    return "TEXT_NODE";
+  case XML_CDATA_SECTION_NODE:
+    return "CDATA_SECTION_NODE";
+  case XML_ENTITY_REF_NODE:
+    return "ENTITY_REFERENCE_NODE";
+  case XML_ENTITY_NODE:
+    return "ENTITY_NODE";
+  case XML_PI_NODE:
+    return "PROCESSING_INSTRUCTION_NODE";
+  case XML_COMMENT_NODE:
+    return "COMMENT_NODE";
+  case XML_DOCUMENT_NODE:
+    return "DOCUMENT_NODE";
+  case XML_DOCUMENT_TYPE_NODE:
+    return "DOCUMENT_TYPE_NODE";
+  case XML_DOCUMENT_FRAG_NODE:
+    return "DOCUMENT_FRAGMENT_NODE";
+  case XML_NOTATION_NODE:
+    return "NOTATION_NODE";
+  case XML_NAMESPACE_DECL:
+    return "NAMESPACE_NODE";
+  default:
+    return "UNKNOWN_NODE";
+  }
+}
+
+/* maximum number of decimal digits of a positive int */
+#define MAX_INDEX_DIGITS 10
+
+ReturnCode getChildNodeList(TixiDocument* document, const xmlNodePtr parent, const char* parentPath,
+                            int* nChilds, char*** names, char*** xpaths, char*** nodeTypes)
+{
+  xmlNodePtr child = NULL;
+  xmlHashTablePtr elementIndices = NULL;
+  int parentPathLength = (int) strlen(parentPath);
+  size_t nPointers = 0;
+  size_t bufferSize = 0;
+  char** pointers = NULL;
+  char* buffer = NULL;
+  int count = 0;
+  int iChild = 0;
+  int nText = 0, nComment = 0, nPI = 0;
+
+  *nChilds = 0;
+  *names = NULL;
+  if (xpaths) {
+    *xpaths = NULL;
+  }
+  if (nodeTypes) {
+    *nodeTypes = NULL;
+  }
+
+  /* the child paths are appended with a slash, e.g. "/" + "/plane[1]" would select descendants */
+  while (parentPathLength > 0 && parentPath[parentPathLength - 1] == '/') {
+    parentPathLength--;
+  }
+
+  /* first pass: determine the size of the result arena */
+  for (child = parent->children; child; child = child->next) {
+    // Ignore DTD nodes, we don't select them with xpath
+    if (child->type == XML_DTD_NODE) {
+      continue;
+    }
+    count++;
+    bufferSize += getNodeNameLength(child) + 1;
+    if (xpaths) {
+      /* "/" + longest of name and "processing-instruction()" + "[index]" + trailing zero */
+      size_t nameLength = getNodeNameLength(child);
+      if (nameLength < strlen("processing-instruction()")) {
+        nameLength = strlen("processing-instruction()");
+      }
+      bufferSize += (size_t) parentPathLength + nameLength + MAX_INDEX_DIGITS + 4;
+    }
+    if (nodeTypes) {
+      bufferSize += strlen(getNodeTypeName(child->type)) + 1;
+    }
+  }
+
+  if (count == 0) {
+    return SUCCESS;
+  }
+
+  /* one arena holding all pointer arrays followed by the string data */
+  nPointers = (size_t) count * (1 + (xpaths ? 1 : 0) + (nodeTypes ? 1 : 0));
+  pointers = (char**) malloc(nPointers * sizeof(char*) + bufferSize);
+  if (!pointers) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Memory allocation failed in getChildNodeList.\n");
+    return FAILED;
+  }
+  buffer = (char*) (pointers + nPointers);
+
+  if (xpaths) {
+    elementIndices = xmlHashCreate(count);
+    if (!elementIndices) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Memory allocation failed in getChildNodeList.\n");
+      free(pointers);
+      return FAILED;
+    }
+  }
+
+  *names = pointers;
+  pointers += count;
+  if (xpaths) {
+    *xpaths = pointers;
+    pointers += count;
+  }
+  if (nodeTypes) {
+    *nodeTypes = pointers;
+  }
+
+  /* second pass: fill the arena */
+  for (child = parent->children; child; child = child->next) {
+    if (child->type == XML_DTD_NODE) {
+      continue;
+    }
+
+    (*names)[iChild] = buffer;
+    buffer = writeNodeName(child, buffer);
+
+    if (xpaths) {
+      (*xpaths)[iChild] = buffer;
+      switch (child->type) {
+      case XML_ELEMENT_NODE: {
+        const xmlChar* prefix = child->ns ? child->ns->prefix : NULL;
+        ptrdiff_t index = (ptrdiff_t) xmlHashLookup2(elementIndices, child->name, prefix) + 1;
+        xmlHashUpdateEntry2(elementIndices, child->name, prefix, (void*) index, NULL);
+        buffer += sprintf(buffer, "%.*s/", parentPathLength, parentPath);
+        buffer = writeNodeName(child, buffer) - 1;
+        buffer += sprintf(buffer, "[%d]", (int) index) + 1;
+        break;
+      }
+      case XML_TEXT_NODE:
+      case XML_CDATA_SECTION_NODE:
+        buffer += sprintf(buffer, "%.*s/text()[%d]", parentPathLength, parentPath, ++nText) + 1;
+        break;
+      case XML_COMMENT_NODE:
+        buffer += sprintf(buffer, "%.*s/comment()[%d]", parentPathLength, parentPath, ++nComment) + 1;
+        break;
+      case XML_PI_NODE:
+        buffer += sprintf(buffer, "%.*s/processing-instruction()[%d]", parentPathLength, parentPath, ++nPI) + 1;
+        break;
+      default:
+        buffer += sprintf(buffer, "%.*s/node()[%d]", parentPathLength, parentPath, iChild + 1) + 1;
+      }
+    }
+
+    if (nodeTypes) {
+      (*nodeTypes)[iChild] = buffer;
+      strcpy(buffer, getNodeTypeName(child->type));
+      buffer += strlen(buffer) + 1;
+    }
+    iChild++;
+  }
+
+  if (elementIndices) {
+    xmlHashFree(elementIndices, NULL);
+  }
+
+  if (addToMemoryList(document, (void*) *names) != SUCESS) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Memory allocation failed in getChildNodeList.\n");
+    free(*names);
+    *names = NULL;
+    if (xpaths) {
+      *xpaths = NULL;
+    }
+    if (nodeTypes) {
+      *nodeTypes = NULL;
+    }
+    return FAILED;
+  }
+
+  *nChilds = count;
+  return SUCCESS;
+}
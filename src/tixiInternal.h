@@ -88,6 +88,11 @@ TIXI_INTERNAL_EXPORT ReturnCode removeDocumentFromList(TixiDocumentHandle handle
  */
 TIXI_INTERNAL_EXPORT TixiDocument* getDocument(TixiDocumentHandle handle);
 
+/**
+ * @brief Returns the handle of the first document in the list, -1 if the list is empty.
+ */
+TIXI_INTERNAL_EXPORT TixiDocumentHandle getFirstDocumentHandle(void);
+
 /**
  @brief Adds pointer to memory allcoated by libxml to list of managed memory.
 
@@ -126,6 +131,25 @@ TIXI_INTERNAL_EXPORT void freeTixiDocument(TixiDocument* document);
  */
 TIXI_INTERNAL_EXPORT ReturnCode checkElement(const xmlXPathContextPtr xpathContext, const char* elementPath, xmlNodePtr* element);
 
+/**
+  @brief Resolves a pre-split element path like ::checkElement without evaluating an XPath expression.
+
+  The steps are resolved directly using the child index. If a step without index is not unique,
+  the path is evaluated as XPath expression to get the same result as ::checkElement.
+
+  @param document (in) the document
+  @param steps (in) the child steps starting at the document node
+  @param nSteps (in) number of steps
+  @param element (out) the XML-node pointed to by the steps
+  @return
+    - SUCCESS element exists and is unique
+    - INVALID_XPATH if there are no steps, a step is not a valid name or its namespace prefix is unknown
+    - ELEMENT_NOT_FOUND
+    - ELEMENT_PATH_NOT_UNIQUE
+ */
+TIXI_INTERNAL_EXPORT ReturnCode checkElementSteps(TixiDocument* document, const TixiPathStep* steps, int nSteps,
+                                                  xmlNodePtr* element);
+
 
 /**
   @brief Checks if the given element or attribute path exists
@@ -393,6 +417,95 @@ TIXI_INTERNAL_EXPORT ReturnCode saveDocument (TixiDocumentHandle handle, const c
  */
 TIXI_INTERNAL_EXPORT ReturnCode validateSchema(const TixiDocumentHandle handle, xmlDocPtr* schema_doc, int withDefaults);
 
+/**
+  @brief Validates a tixiDocument against a compiled schema.
+
+  @param TixiDocument document (in) The TIXIDocument
+  @param xmlSchemaPtr schema (in) The compiled schema to validate against
+  @param int withDefaults (in) a flag indicating that default elements/attributes in the schema
+                                                            should be added to the tixiDocument
+  @return ReturnCode
+    - SUCCESS              if the document is successfully validated
+    - NOT_SCHEMA_COMPLIANT if validating against the given XML-schema fails
+    - FAILED               for all internal errors
+ */
+TIXI_INTERNAL_EXPORT ReturnCode validateDocumentWithSchema(TixiDocument* document, xmlSchemaPtr schema, int withDefaults);
+
+/**
+  @brief Parses an XML file and validates it against a compiled schema in the same pass.
+
+  The validation is plugged into the SAX events of the parser and parsing stops at the first
+  validation error, such that invalid files are rejected without reading them completely.
+
+  @param const char* xmlFilename (in) Name of the XML file
+  @param xmlSchemaPtr schema (in) The compiled schema to validate against
+  @param xmlDocPtr* xmlDocument (out) The parsed document, if it is valid, NULL otherwise
+  @return ReturnCode
+    - SUCCESS              if the document is well-formed and valid
+    - NOT_WELL_FORMED      if the XML-document is not well formed
+    - NOT_SCHEMA_COMPLIANT if validating against the given XML-schema fails
+    - OPEN_FAILED          if the file cannot be opened
+    - FAILED               for all internal errors
+ */
+TIXI_INTERNAL_EXPORT ReturnCode readDocumentWithSchema(const char* xmlFilename, xmlSchemaPtr schema, xmlDocPtr* xmlDocument);
+
+
+/**
+  @brief Returns the length of the XPath generated by ::writeNodeXPath for node, without the terminating null.
+
+  Attributes and other non-element nodes are mapped to the path of their parent element.
+ */
+TIXI_INTERNAL_EXPORT size_t getNodeXPathLength(TixiDocument* document, const xmlNodePtr node);
+
+/**
+  @brief Writes the XPath of node into buffer, which must hold length + 1 characters.
+
+  Each element is addressed by its uID, if it has one, and otherwise by its
+  position among equally named siblings, if there are any. The buffer is filled
+  from the end in a single pass.
+
+  @param document (in) The document of node, whose child index is used to find the
+                       positions. If NULL, the siblings of each element are scanned.
+  @param node (in) The node to generate the XPath from
+  @param buffer (out) The buffer receiving the XPath
+  @param length (in) The length as returned by ::getNodeXPathLength
+ */
+TIXI_INTERNAL_EXPORT void writeNodeXPath(TixiDocument* document, const xmlNodePtr node, char* buffer, size_t length);
+
+/**
+  @brief Returns the length of the XPath generated by ::writeResultNodeXPath for a node of an XPath result.
+ */
+TIXI_INTERNAL_EXPORT size_t getResultNodeXPathLength(TixiDocument* document, const xmlNodePtr node);
+
+/**
+  @brief Writes the XPath of a node of an XPath result into buffer, which must hold length + 1 characters.
+
+  In contrast to ::writeNodeXPath, non-element nodes are addressed by an additional
+  path step, e.g. /@name for attributes, /text()[2] for text nodes or /comment()[1] for comments.
+
+  @param document (in) The document of node, see ::writeNodeXPath
+  @param node (in) The node to generate the XPath from
+  @param buffer (out) The buffer receiving the XPath
+  @param length (in) The length as returned by ::getResultNodeXPathLength
+ */
+TIXI_INTERNAL_EXPORT void writeResultNodeXPath(TixiDocument* document, const xmlNodePtr node, char* buffer, size_t length);
+
+/**
+  @brief Returns the length of the text content of a node of an XPath result, or -1 if it has none.
+
+  The text of an element is the concatenation of its direct text children, escaped like
+  xmlNodeListGetString, the text of attributes, text nodes and comments is their value.
+ */
+TIXI_INTERNAL_EXPORT long getResultNodeTextLength(const xmlNodePtr node);
+
+/**
+  @brief Writes the text content of a node of an XPath result into buffer, which must hold length + 1 characters.
+
+  @param node (in) The node to get the text from
+  @param buffer (out) The buffer receiving the text
+  @param length (in) The length as returned by ::getResultNodeTextLength, must not be -1
+ */
+TIXI_INTERNAL_EXPORT void writeResultNodeText(const xmlNodePtr node, char* buffer, size_t length);
 
 /**
   @brief Generates an XPath from a given nodePtr containing all uIDs and indices.
@@ -436,6 +549,54 @@ int isParent(xmlNodePtr p, xmlNodePtr n);
  */
 TIXI_INTERNAL_EXPORT int getChildNodeCount(const xmlNodePtr nodePtr);
 
+/**
+ * @brief Clears the XPath cache and the child index of the document.
+ *
+ * This has to be called whenever elements are added, removed, renamed or moved.
+ */
+TIXI_INTERNAL_EXPORT void clearDocumentCaches(TixiDocument* document);
+
+
+/**
+ * @brief Returns the length of the node name as reported by ::tixiGetChildNodeName
+ *        (i.e. "#text", "#comment", "#cdata-section" or the optionally prefixed name)
+ *        without the terminating zero.
+ */
+TIXI_INTERNAL_EXPORT size_t getNodeNameLength(const xmlNodePtr node);
+
+/**
+ * @brief Writes the node name as reported by ::tixiGetChildNodeName into buffer.
+ *        The buffer must hold at least getNodeNameLength(node) + 1 characters.
+ *
+ * @return Pointer behind the terminating zero of the written name
+ */
+TIXI_INTERNAL_EXPORT char* writeNodeName(const xmlNodePtr node, char* buffer);
+
+/**
+ * @brief Returns the DOM node type name (e.g. "ELEMENT_NODE") of a libxml2 node type
+ */
+TIXI_INTERNAL_EXPORT const char* getNodeTypeName(xmlElementType type);
+
+/**
+  @brief Collects the names and optionally XPaths and node types of all child nodes
+         of an element in a single traversal.
+
+  All arrays and strings are stored in one memory block which is added to the memory
+  list of the document.
+
+  @param document (in) the TIXI document
+  @param parent (in) the parent node
+  @param parentPath (in) XPath of the parent node used as prefix of the child XPaths
+  @param nChilds (out) number of child nodes (DTD nodes are ignored)
+  @param names (out) array of child node names
+  @param xpaths (out) array of child node XPaths, may be NULL if not required
+  @param nodeTypes (out) array of child node types, may be NULL if not required
+  @return
+    - SUCCESS
+    - FAILED if memory allocation failed
+ */
+TIXI_INTERNAL_EXPORT ReturnCode getChildNodeList(TixiDocument* document, const xmlNodePtr parent, const char* parentPath,
+                                                 int* nChilds, char*** names, char*** xpaths, char*** nodeTypes);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,56 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*   http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_MUTEX_H
+#define TIXI_MUTEX_H
+
+#include "tixiInternal.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A mutex, which can be initialized statically with TIXI_MUTEX_INIT. It
+ * protects global state like the document list, as documents may be used
+ * from different threads (e.g. by the python extension, which does not hold
+ * the GIL while calling tixi).
+ */
+#ifdef _WIN32
+typedef SRWLOCK TixiMutex;
+#define TIXI_MUTEX_INIT SRWLOCK_INIT
+#else
+typedef pthread_mutex_t TixiMutex;
+#define TIXI_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+#endif
+
+TIXI_INTERNAL_EXPORT void tixiMutexLock(TixiMutex* mutex);
+
+TIXI_INTERNAL_EXPORT void tixiMutexUnlock(TixiMutex* mutex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_MUTEX_H
@@ -17,6 +17,7 @@
 */
 #include "uidHelper.h"
 #include "tixiInternal.h"
+#include "xpathFunctions.h"
 #include <stdlib.h>
 
 extern void printMsg(MessageType type, const char* message, ...);
@@ -26,7 +27,7 @@ int uid_readDocumentUIDs(TixiDocument* tixiDocument)
   xmlXPathObjectPtr xpathObj;
 
   /* Evaluate xpath expression */
-  xpathObj = xmlXPathEvalExpression((xmlChar*) CPACS_UID_XPATH, tixiDocument->xpathContext);
+  xpathObj = XPathEvaluate(tixiDocument->xpathContext, CPACS_UID_XPATH);
   if (xpathObj == NULL) {
     printMsg(MESSAGETYPE_ERROR,"Error: unable to evaluate xpath expression \"%s\"\n", CPACS_UID_XPATH);
     return(FAILED);
@@ -133,7 +134,7 @@ int uid_checkForBrokenLinks(TixiDocument *document)
   ReturnCode foundUID = FAILED;
 
   /* Evaluate xpath expression */
-  xpathObj = xmlXPathEvalExpression((xmlChar*) CPACS_UID_LINK_XPATH, document->xpathContext);
+  xpathObj = XPathEvaluate(document->xpathContext, CPACS_UID_LINK_XPATH);
   if (xpathObj == NULL) {
     printMsg(MESSAGETYPE_ERROR,"Error: unable to evaluate xpath expression \"%s\"\n", CPACS_UID_LINK_XPATH);
     return(FAILED);
@@ -0,0 +1,151 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "vectorCache.h"
+
+#include "tixiUtils.h"
+#include "statistics.h"
+#include <libxml/hash.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static void freeVectorCacheEntry(void* payload, const xmlChar* name)
+{
+  VectorCacheEntry* entry = (VectorCacheEntry*) payload;
+  (void) name;
+  free(entry->values);
+  free(entry->invalidToken);
+  free(entry);
+}
+
+static void elementKey(const xmlNodePtr element, char* key, size_t size)
+{
+  snprintf(key, size, "%p", (void*) element);
+}
+
+/* the text of the element, as returned by tixiGetTextElement */
+static xmlChar* getElementText(TixiDocument* document, xmlNodePtr element)
+{
+  if (xmlNodeIsText(element)) {
+    return xmlNodeGetContent(element);
+  }
+  else if (element->children && !element->children->next && xmlNodeIsText(element->children)) {
+    return xmlNodeGetContent(element->children);
+  }
+  else {
+    return xmlNodeListGetString(document->docPtr, element->children, 0);
+  }
+}
+
+/* Splits the text like strtok at VECTOR_SEPARATOR, skipping empty values */
+static VectorCacheEntry* parseVector(char* text)
+{
+  VectorCacheEntry* entry = (VectorCacheEntry*) calloc(1, sizeof(VectorCacheEntry));
+  int capacity = 0;
+  char* token = text;
+
+  if (!entry) {
+    return NULL;
+  }
+
+  while (token && *token) {
+    char* end = strchr(token, VECTOR_SEPARATOR[0]);
+    if (end) {
+      *end = '\0';
+    }
+
+    if (*token) {
+      if (!entry->invalidToken) {
+        trim_trailing_whitespace(token);
+        if (isNumeric(token)) {
+          if (entry->nValid == capacity) {
+            double* values = NULL;
+            capacity = capacity > 0 ? 2 * capacity : 16;
+            values = (double*) realloc(entry->values, capacity * sizeof(double));
+            if (!values) {
+              freeVectorCacheEntry(entry, NULL);
+              return NULL;
+            }
+            entry->values = values;
+          }
+          entry->values[entry->nValid++] = atof(token);
+        }
+        else {
+          entry->invalidToken = (char*) malloc(strlen(token) + 1);
+          strcpy(entry->invalidToken, token);
+        }
+      }
+      entry->count++;
+    }
+
+    token = end ? end + 1 : NULL;
+  }
+
+  return entry;
+}
+
+const VectorCacheEntry* vectorCacheGet(TixiDocument* document, xmlNodePtr element)
+{
+  char key[64];
+  VectorCacheEntry* entry = NULL;
+  xmlChar* text = NULL;
+
+  if (!document->vectorCache) {
+    document->vectorCache = xmlHashCreate(0);
+    if (!document->vectorCache) {
+      return NULL;
+    }
+  }
+
+  elementKey(element, key, sizeof(key));
+  entry = (VectorCacheEntry*) xmlHashLookup(document->vectorCache, (const xmlChar*) key);
+  if (entry) {
+    STATISTICS_COUNT(document, vectorCacheHits);
+    return entry;
+  }
+
+  STATISTICS_COUNT(document, vectorCacheMisses);
+  text = getElementText(document, element);
+  entry = parseVector(text ? (char*) text : "");
+  xmlFree(text);
+  if (entry && xmlHashAddEntry(document->vectorCache, (const xmlChar*) key, entry) != 0) {
+    freeVectorCacheEntry(entry, NULL);
+    return NULL;
+  }
+  return entry;
+}
+
+void vectorCacheRemove(TixiDocument* document, xmlNodePtr element)
+{
+  char key[64];
+
+  if (document->vectorCache) {
+    elementKey(element, key, sizeof(key));
+    xmlHashRemoveEntry(document->vectorCache, (const xmlChar*) key, freeVectorCacheEntry);
+  }
+}
+
+void vectorCacheClear(TixiDocument* document)
+{
+  if (document->vectorCache) {
+    xmlHashFree(document->vectorCache, freeVectorCacheEntry);
+    document->vectorCache = NULL;
+  }
+}
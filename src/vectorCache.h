@@ -0,0 +1,66 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_VECTORCACHE_H
+#define TIXI_VECTORCACHE_H
+
+#include <libxml/tree.h>
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The vector cache stores the parsed values of vector elements (values
+ * separated by VECTOR_SEPARATOR), such that the text of an element is
+ * tokenized only once. The entry of an element has to be removed with
+ * ::vectorCacheRemove if its text changes, the whole cache has to be
+ * cleared with ::vectorCacheClear whenever nodes are removed or replaced.
+ */
+
+typedef struct
+{
+  int count;            /**< number of values in the text */
+  int nValid;           /**< number of values before the first one that is not a number */
+  double* values;       /**< the first nValid values */
+  char* invalidToken;   /**< the first value that is not a number or NULL */
+} VectorCacheEntry;
+
+/**
+ * @brief Returns the parsed values of the text of a vector element, parsing it on first access.
+ *
+ * @return The entry owned by the cache or NULL, if memory cannot be allocated
+ */
+TIXI_INTERNAL_EXPORT const VectorCacheEntry* vectorCacheGet(TixiDocument* document, xmlNodePtr element);
+
+/**
+ * @brief Removes the cached values of an element, e.g. if its text is updated.
+ */
+TIXI_INTERNAL_EXPORT void vectorCacheRemove(TixiDocument* document, xmlNodePtr element);
+
+/**
+ * @brief Drops all cached values of the document
+ */
+TIXI_INTERNAL_EXPORT void vectorCacheClear(TixiDocument* document);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_VECTORCACHE_H
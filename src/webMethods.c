@@ -21,14 +21,59 @@
 */
 
 #include "webMethods.h"
+#include "httpCache.h"
+#include "tixiUtils.h"
+#include "tixiMutex.h"
 
 #include <curl/curl.h>
-#include <curl/easy.h>
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 extern void printMsg(MessageType type, const char* message, ...);
 
+/* maximum number of parallel connections to a single host */
+#define MAX_HOST_CONNECTIONS 8
+
+/* Each call runs its transfers on its own multi handle, such that different
+ * threads can download at the same time. The connections are kept in the
+ * connection cache of a share handle and reused by later calls. */
+static CURLSH* shareHandle = NULL;
+static int shareUsers = 0;            /* calls, which currently use the share handle */
+static int cleanupPending = 0;        /* curlCleanup was called while the share handle was in use */
+static TixiMutex shareHandleMutex = TIXI_MUTEX_INIT;
+
+/* the shared data is locked by curl for each kind of data separately */
+static TixiMutex shareMutex = TIXI_MUTEX_INIT;
+static TixiMutex connectMutex = TIXI_MUTEX_INIT;
+static TixiMutex dnsMutex = TIXI_MUTEX_INIT;
+static TixiMutex sslSessionMutex = TIXI_MUTEX_INIT;
+
+typedef struct
+{
+  const char* url;
+  CURL* curl;
+  CURLcode result;
+  long responseCode;
+  struct MemoryStruct body;
+  FILE* file;                   /* if set, the body is written to file */
+  xmlParserCtxtPtr parser;      /* if set, the body is parsed while downloading */
+  int parseOptions;
+  HttpCacheWriter* cacheWriter; /* if set, the body is also written to the HTTP cache */
+  int bodyStarted;
+  char* etag;                   /* validators of the response */
+  char* lastModified;
+  HttpCacheEntry cacheEntry;    /* cached response of the url */
+  int cached;
+  int done;                     /* the result was already read from the cache */
+  char* content;                /* results */
+  xmlDocPtr document;
+  ReturnCode error;
+  struct curl_slist* headers;
+  char errorBuffer[CURL_ERROR_SIZE];
+} Transfer;
+
 void* myrealloc(void* ptr, size_t size)
 {
   /* There might be a realloc() out there that doesn't like reallocing
@@ -46,92 +91,548 @@ size_t writeMemoryCallback(void* ptr, size_t size, size_t nmemb, void* data)
   size_t realsize = size * nmemb;
   struct MemoryStruct* mem = (struct MemoryStruct*) data;
 
-  mem->memory = (char*) myrealloc(mem->memory, mem->size + realsize + 1);
-  if (mem->memory) {
-    memcpy(&(mem->memory[mem->size]), ptr, realsize);
-    mem->size += realsize;
-    mem->memory[mem->size] = 0;
+  /* the buffer grows geometrically to avoid copying it for each chunk */
+  if (mem->size + realsize + 1 > mem->capacity) {
+    size_t capacity = mem->capacity > 0 ? mem->capacity : 16384;
+    char* memory = NULL;
+    while (capacity < mem->size + realsize + 1) {
+      capacity *= 2;
+    }
+    memory = (char*) myrealloc(mem->memory, capacity);
+    if (!memory) {
+      return 0;
+    }
+    mem->memory = memory;
+    mem->capacity = capacity;
   }
+
+  memcpy(&(mem->memory[mem->size]), ptr, realsize);
+  mem->size += realsize;
+  mem->memory[mem->size] = 0;
   return realsize;
 }
 
-char* curlGetURLInMemory(const char* url)
+static TixiMutex* getShareMutex(curl_lock_data data)
+{
+  switch (data) {
+  case CURL_LOCK_DATA_CONNECT:
+    return &connectMutex;
+  case CURL_LOCK_DATA_DNS:
+    return &dnsMutex;
+  case CURL_LOCK_DATA_SSL_SESSION:
+    return &sslSessionMutex;
+  default:
+    return &shareMutex;
+  }
+}
+
+static void lockShare(CURL* curl, curl_lock_data data, curl_lock_access access, void* userData)
+{
+  (void) curl;
+  (void) access;
+  (void) userData;
+  tixiMutexLock(getShareMutex(data));
+}
+
+static void unlockShare(CURL* curl, curl_lock_data data, void* userData)
+{
+  (void) curl;
+  (void) userData;
+  tixiMutexUnlock(getShareMutex(data));
+}
+
+static void webCleanupLocked(void)
+{
+  curl_share_cleanup(shareHandle);
+  shareHandle = NULL;
+  cleanupPending = 0;
+  curl_global_cleanup();
+}
+
+/* initializes curl on first use and registers a user of the share handle, which
+ * has to call webRelease after all its easy handles are freed */
+static int webInit(void)
+{
+  int result = 0;
+
+  tixiMutexLock(&shareHandleMutex);
+  if (!shareHandle) {
+    if (curl_global_init(CURL_GLOBAL_ALL) != CURLE_OK) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Could not initialize curl.\n");
+      result = -1;
+    }
+    else if ((shareHandle = curl_share_init()) == NULL) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Could not initialize curl.\n");
+      curl_global_cleanup();
+      result = -1;
+    }
+    else {
+      curl_share_setopt(shareHandle, CURLSHOPT_LOCKFUNC, lockShare);
+      curl_share_setopt(shareHandle, CURLSHOPT_UNLOCKFUNC, unlockShare);
+      curl_share_setopt(shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+      curl_share_setopt(shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+  }
+  if (result == 0) {
+    shareUsers++;
+  }
+  tixiMutexUnlock(&shareHandleMutex);
+  return result;
+}
+
+static void webRelease(void)
+{
+  tixiMutexLock(&shareHandleMutex);
+  shareUsers--;
+  if (shareUsers == 0 && cleanupPending) {
+    webCleanupLocked();
+  }
+  tixiMutexUnlock(&shareHandleMutex);
+}
+
+void curlCleanup(void)
+{
+  tixiMutexLock(&shareHandleMutex);
+  if (shareHandle) {
+    if (shareUsers > 0) {
+      /* the last running call cleans up */
+      cleanupPending = 1;
+    }
+    else {
+      webCleanupLocked();
+    }
+  }
+  tixiMutexUnlock(&shareHandleMutex);
+}
+
+static int isHTTPURL(const char* url)
+{
+  return string_startsWith(url, "http://") == 0 || string_startsWith(url, "https://") == 0;
+}
+
+/* returns the value of the header line, if it is the header name */
+static char* getHeaderValue(const char* line, size_t length, const char* name)
+{
+  size_t nameLength = strlen(name);
+  size_t start = nameLength + 1;
+  char* value = NULL;
+
+  if (length <= nameLength || line[nameLength] != ':' || my_strncasecmp(line, name, nameLength) != 0) {
+    return NULL;
+  }
+
+  while (start < length && (line[start] == ' ' || line[start] == '\t')) {
+    start++;
+  }
+  while (length > start && (line[length - 1] == '\r' || line[length - 1] == '\n' || line[length - 1] == ' ')) {
+    length--;
+  }
+
+  value = (char*) malloc(length - start + 1);
+  if (!value) {
+    return NULL;
+  }
+  memcpy(value, line + start, length - start);
+  value[length - start] = '\0';
+  return value;
+}
+
+static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* data)
 {
-  CURL* curl_handle;
-  CURLcode res;
-  char curl_error_buffer[CURL_ERROR_SIZE];
+  size_t length = size * nitems;
+  Transfer* transfer = (Transfer*) data;
+  char* value = NULL;
+
+  if (length >= 5 && strncmp(buffer, "HTTP/", 5) == 0) {
+    /* start of a new response, e.g. after a redirect */
+    free(transfer->etag);
+    free(transfer->lastModified);
+    transfer->etag = NULL;
+    transfer->lastModified = NULL;
+  }
+  else if ((value = getHeaderValue(buffer, length, "ETag")) != NULL) {
+    free(transfer->etag);
+    transfer->etag = value;
+  }
+  else if ((value = getHeaderValue(buffer, length, "Last-Modified")) != NULL) {
+    free(transfer->lastModified);
+    transfer->lastModified = value;
+  }
+  return length;
+}
+
+static size_t bodyCallback(char* buffer, size_t size, size_t nitems, void* data)
+{
+  size_t length = size * nitems;
+  Transfer* transfer = (Transfer*) data;
+
+  if (!transfer->bodyStarted) {
+    /* all headers are received at this point */
+    transfer->bodyStarted = 1;
+    curl_easy_getinfo(transfer->curl, CURLINFO_RESPONSE_CODE, &transfer->responseCode);
+    if (isHTTPURL(transfer->url) && transfer->responseCode == 200 && (transfer->etag || transfer->lastModified)) {
+      transfer->cacheWriter = httpCacheBeginStore();
+    }
+  }
 
-  struct MemoryStruct chunk;
+  /* the body of an error response is not used */
+  if (isHTTPURL(transfer->url) && transfer->responseCode >= 400) {
+    return length;
+  }
 
-  chunk.memory = NULL; /* we expect realloc(NULL, size) to work */
-  chunk.size = 0; /* no data at this point */
+  httpCacheWrite(transfer->cacheWriter, buffer, length);
+  if (transfer->parser) {
+    xmlParseChunk(transfer->parser, buffer, (int) length, 0);
+    return length;
+  }
+  return writeMemoryCallback(buffer, size, nitems, &transfer->body);
+}
 
-  curl_global_init(CURL_GLOBAL_ALL);
+/* asks the server to send the body only if it differs from the cached one */
+static void addConditionalHeaders(Transfer* transfer)
+{
+  char* header = NULL;
 
-  /* init the curl session */
-  curl_handle = curl_easy_init();
+  if (transfer->cacheEntry.etag) {
+    header = buildString("If-None-Match: %s", transfer->cacheEntry.etag);
+    transfer->headers = curl_slist_append(transfer->headers, header);
+    free(header);
+  }
+  if (transfer->cacheEntry.lastModified) {
+    header = buildString("If-Modified-Since: %s", transfer->cacheEntry.lastModified);
+    transfer->headers = curl_slist_append(transfer->headers, header);
+    free(header);
+  }
+}
 
-  /* specify URL to get */
-  curl_easy_setopt(curl_handle, CURLOPT_URL, url);
+static int initTransfer(Transfer* transfer, const char* url, FILE* file)
+{
+  memset(transfer, 0, sizeof(Transfer));
+  transfer->url = url;
+  transfer->file = file;
+  transfer->result = CURLE_FAILED_INIT;
+  transfer->error = OPEN_FAILED;
 
-  /* send all data to this function  */
-  curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, writeMemoryCallback);
+  transfer->curl = curl_easy_init();
+  if (!transfer->curl) {
+    return -1;
+  }
 
-  /* we pass our 'chunk' struct to the callback function */
-  curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void*)&chunk);
+  if (!file && isHTTPURL(url) && httpCacheLookup(url, &transfer->cacheEntry)) {
+    transfer->cached = 1;
+    addConditionalHeaders(transfer);
+  }
 
-  /* For error reasons set error puffer */
-  curl_easy_setopt(curl_handle, CURLOPT_ERRORBUFFER, curl_error_buffer);
+  curl_easy_setopt(transfer->curl, CURLOPT_URL, url);
+  curl_easy_setopt(transfer->curl, CURLOPT_SHARE, shareHandle);
+  curl_easy_setopt(transfer->curl, CURLOPT_PRIVATE, transfer);
+  curl_easy_setopt(transfer->curl, CURLOPT_ERRORBUFFER, transfer->errorBuffer);
+  curl_easy_setopt(transfer->curl, CURLOPT_HEADERFUNCTION, headerCallback);
+  curl_easy_setopt(transfer->curl, CURLOPT_HEADERDATA, transfer);
+  curl_easy_setopt(transfer->curl, CURLOPT_HTTPHEADER, transfer->headers);
+  if (file) {
+    curl_easy_setopt(transfer->curl, CURLOPT_WRITEDATA, file);
+  }
+  else {
+    curl_easy_setopt(transfer->curl, CURLOPT_WRITEFUNCTION, bodyCallback);
+    curl_easy_setopt(transfer->curl, CURLOPT_WRITEDATA, transfer);
+  }
 
   /* some servers don't like requests that are made without a user-agent
      field, so we provide one */
-  curl_easy_setopt(curl_handle, CURLOPT_USERAGENT, "libcurl-agent/1.0-TIXI");
+  curl_easy_setopt(transfer->curl, CURLOPT_USERAGENT, "libcurl-agent/1.0-TIXI");
+  return 0;
+}
 
-  /* get it! */
-  res = curl_easy_perform(curl_handle);
+static void freeTransfer(Transfer* transfer)
+{
+  if (transfer->curl) {
+    curl_easy_cleanup(transfer->curl);
+  }
+  curl_slist_free_all(transfer->headers);
+  free(transfer->body.memory);
+  free(transfer->etag);
+  free(transfer->lastModified);
+  httpCacheFreeEntry(&transfer->cacheEntry);
+  httpCacheAbortStore(transfer->cacheWriter);
+  free(transfer->content);
+  if (transfer->parser) {
+    xmlFreeDoc(transfer->parser->myDoc);
+    xmlFreeParserCtxt(transfer->parser);
+  }
+  xmlFreeDoc(transfer->document);
+}
 
-  /* cleanup curl stuff */
-  curl_easy_cleanup(curl_handle);
-  curl_global_cleanup();
+/* runs all transfers in parallel and returns after all are finished */
+static void performTransfers(Transfer* transfers, int nTransfers)
+{
+  CURLM* multiHandle = curl_multi_init();
+  CURLMsg* message = NULL;
+  CURLMcode code = CURLM_OK;
+  int running = 0;
+  int nMessages = 0;
+  int i;
 
-  if (res != CURLE_OK) {
-    printMsg(MESSAGETYPE_ERROR, "curl request failed: %s", curl_error_buffer);
-    return NULL;
+  if (!multiHandle) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Could not initialize curl.\n");
+    return;
+  }
+  curl_multi_setopt(multiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, (long) MAX_HOST_CONNECTIONS);
+  curl_multi_setopt(multiHandle, CURLMOPT_PIPELINING, (long) CURLPIPE_MULTIPLEX);
+
+  for (i = 0; i < nTransfers; ++i) {
+    if (transfers[i].curl) {
+      curl_multi_add_handle(multiHandle, transfers[i].curl);
+    }
   }
 
-  return (chunk.memory);
+  do {
+    code = curl_multi_perform(multiHandle, &running);
+    if (code == CURLM_OK && running) {
+      code = curl_multi_poll(multiHandle, NULL, 0, 1000, NULL);
+    }
+  } while (code == CURLM_OK && running);
+
+  while ((message = curl_multi_info_read(multiHandle, &nMessages)) != NULL) {
+    if (message->msg == CURLMSG_DONE) {
+      Transfer* transfer = NULL;
+      curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, (char**) &transfer);
+      transfer->result = message->data.result;
+    }
+  }
+
+  for (i = 0; i < nTransfers; ++i) {
+    if (transfers[i].curl) {
+      curl_easy_getinfo(transfers[i].curl, CURLINFO_RESPONSE_CODE, &transfers[i].responseCode);
+      curl_multi_remove_handle(multiHandle, transfers[i].curl);
+    }
+  }
+  curl_multi_cleanup(multiHandle);
 }
 
+static int checkTransfer(const Transfer* transfer)
+{
+  if (transfer->result != CURLE_OK) {
+    printMsg(MESSAGETYPE_ERROR, "curl request failed: %s\n",
+             transfer->errorBuffer[0] ? transfer->errorBuffer : curl_easy_strerror(transfer->result));
+    return -1;
+  }
+  if (isHTTPURL(transfer->url) && transfer->responseCode >= 400) {
+    printMsg(MESSAGETYPE_ERROR, "curl request for %s failed with HTTP status %ld\n", transfer->url, transfer->responseCode);
+    return -1;
+  }
+  return 0;
+}
 
-int curlGetFileToLocalDisk(const char* url, const char* local)
+/* reads the result from the cache, returns 0 on success */
+static int readCachedResult(Transfer* transfer, int revalidated)
 {
-  CURL* curl;
-  CURLcode res;
-  FILE* localFile;
+  if (!transfer->parser) {
+    transfer->content = httpCacheRead(transfer->url, &transfer->cacheEntry, revalidated);
+    return transfer->content ? 0 : -1;
+  }
+
+  transfer->document = xmlReadFile(transfer->cacheEntry.dataFilename, NULL, transfer->parseOptions);
+  if (!transfer->document) {
+    if (revalidated) {
+      transfer->error = NOT_WELL_FORMED;
+    }
+    return -1;
+  }
+  xmlFree((xmlChar*) transfer->document->URL);
+  transfer->document->URL = xmlStrdup((const xmlChar*) transfer->url);
+  httpCacheMarkUsed(transfer->url, revalidated);
+  transfer->error = SUCCESS;
+  return 0;
+}
+
+/* takes the downloaded body as result */
+static void finishResult(Transfer* transfer)
+{
+  httpCacheEndStore(transfer->cacheWriter, transfer->url, transfer->etag, transfer->lastModified);
+  transfer->cacheWriter = NULL;
 
-  curl = curl_easy_init();
-  if (curl) {
-    /* local file name to store the file as */
-    localFile = fopen(local, "wb"); /* b is binary for win */
+  if (!transfer->parser) {
+    transfer->content = transfer->body.memory;
+    transfer->body.memory = NULL;
+    return;
+  }
+
+  xmlParseChunk(transfer->parser, NULL, 0, 1);
+  if (transfer->parser->wellFormed || transfer->parser->recovery) {
+    transfer->document = transfer->parser->myDoc;
+    transfer->error = SUCCESS;
+  }
+  else {
+    xmlFreeDoc(transfer->parser->myDoc);
+    transfer->error = NOT_WELL_FORMED;
+  }
+  transfer->parser->myDoc = NULL;
+}
 
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_FILE, localFile);
+static void freeTransfers(Transfer* transfers, int nTransfers)
+{
+  int i;
+  for (i = 0; i < nTransfers; ++i) {
+    freeTransfer(&transfers[i]);
+  }
+  free(transfers);
+}
 
-    res = curl_easy_perform(curl);
+/* Downloads the urls in parallel. If parseDocuments is set, the bodies are
+ * parsed while downloading, otherwise they are stored in memory. */
+static ReturnCode getURLs(int nURLs, const char** urls, int parseDocuments, int parseOptions, Transfer** result)
+{
+  Transfer* transfers = (Transfer*) malloc(nURLs * sizeof(Transfer));
+  int i;
 
-    /* always cleanup */
-    curl_easy_cleanup(curl);
-    curl_global_cleanup();
+  if (!transfers) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in getURLs.\n");
+    return FAILED;
+  }
 
-    if (res != CURLE_OK) {
-      return -1;
+  for (i = 0; i < nURLs; ++i) {
+    Transfer* transfer = &transfers[i];
+    if (initTransfer(transfer, urls[i], NULL) != 0) {
+      printMsg(MESSAGETYPE_ERROR, "Error: Could not initialize the curl request for %s.\n", urls[i]);
+      freeTransfers(transfers, i + 1);
+      return FAILED;
     }
+    if (parseDocuments) {
+      transfer->parseOptions = parseOptions;
+      transfer->parser = xmlCreatePushParserCtxt(NULL, NULL, NULL, 0, urls[i]);
+      if (transfer->parser) {
+        xmlCtxtUseOptions(transfer->parser, parseOptions);
+      }
+      else if (transfer->curl) {
+        curl_easy_cleanup(transfer->curl);
+        transfer->curl = NULL;
+      }
+    }
+    if (transfer->cached && transfer->cacheEntry.fresh && readCachedResult(transfer, 0) == 0) {
+      /* validated recently, the server is not asked again */
+      transfer->done = 1;
+      if (transfer->curl) {
+        curl_easy_cleanup(transfer->curl);
+        transfer->curl = NULL;
+      }
+    }
+  }
 
-    fclose(localFile); /* close the local file */
-    return 0;
+  performTransfers(transfers, nURLs);
+
+  for (i = 0; i < nURLs; ++i) {
+    Transfer* transfer = &transfers[i];
+    if (transfer->done || checkTransfer(transfer) != 0) {
+      continue;
+    }
+    if (transfer->responseCode == 304 && transfer->cached) {
+      /* not modified, use the cached body */
+      readCachedResult(transfer, 1);
+    }
+    else {
+      finishResult(transfer);
+    }
+  }
+  *result = transfers;
+  return SUCCESS;
+}
+
+void curlGetURLsInMemory(int nURLs, const char** urls, char** contents)
+{
+  Transfer* transfers = NULL;
+  int i;
+
+  for (i = 0; i < nURLs; ++i) {
+    contents[i] = NULL;
+  }
+
+  if (nURLs <= 0 || webInit() != 0) {
+    return;
+  }
+
+  if (getURLs(nURLs, urls, 0, 0, &transfers) == SUCCESS) {
+    for (i = 0; i < nURLs; ++i) {
+      contents[i] = transfers[i].content;
+      transfers[i].content = NULL;
+    }
+    freeTransfers(transfers, nURLs);
+  }
+  webRelease();
+}
+
+char* curlGetURLInMemory(const char* url)
+{
+  char* content = NULL;
+  curlGetURLsInMemory(1, &url, &content);
+  return content;
+}
+
+void curlGetURLsAsDocuments(int nURLs, const char** urls, int parseOptions, xmlDocPtr* documents, ReturnCode* errors)
+{
+  Transfer* transfers = NULL;
+  int i;
+
+  for (i = 0; i < nURLs; ++i) {
+    documents[i] = NULL;
+    errors[i] = OPEN_FAILED;
+  }
+
+  if (nURLs <= 0 || webInit() != 0) {
+    return;
+  }
+
+  if (getURLs(nURLs, urls, 1, parseOptions, &transfers) == SUCCESS) {
+    for (i = 0; i < nURLs; ++i) {
+      documents[i] = transfers[i].document;
+      errors[i] = transfers[i].error;
+      transfers[i].document = NULL;
+    }
+    freeTransfers(transfers, nURLs);
   }
   else {
-    curl_global_cleanup();
+    for (i = 0; i < nURLs; ++i) {
+      errors[i] = FAILED;
+    }
+  }
+  webRelease();
+}
+
+ReturnCode curlGetURLAsDocument(const char* url, int parseOptions, xmlDocPtr* document)
+{
+  ReturnCode error = OPEN_FAILED;
+  curlGetURLsAsDocuments(1, &url, parseOptions, document, &error);
+  return error;
+}
+
+int curlGetFileToLocalDisk(const char* url, const char* local)
+{
+  Transfer transfer;
+  FILE* localFile = NULL;
+  int result = -1;
+
+  if (webInit() != 0) {
+    return -1;
+  }
+
+  /* local file name to store the file as */
+  localFile = fopen(local, "wb"); /* b is binary for win */
+  if (!localFile) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Could not open file %s for writing.\n", local);
+    webRelease();
     return -1;
   }
+
+  if (initTransfer(&transfer, url, localFile) == 0) {
+    performTransfers(&transfer, 1);
+    result = checkTransfer(&transfer);
+  }
+  freeTransfer(&transfer);
+  webRelease();
+
+  if (fclose(localFile) != 0) {
+    result = -1;
+  }
+  return result;
 }
@@ -40,6 +40,7 @@ extern "C" {
 struct MemoryStruct {
   char* memory;
   size_t size;
+  size_t capacity;
 };
 
 
@@ -81,12 +82,62 @@ TIXI_INTERNAL_EXPORT size_t writeMemoryCallback(void* ptr, size_t size, size_t n
 /**
   @brief Simple download a URL source into local memory.
 
+  If the HTTP cache is enabled, the cached content is returned, if it was
+  validated recently or the server reports it as not modified.
+
   @param const char* url   (in) The source (http) URL of the resource
   @return char*
-    The content of the url-resource as string.
+    The content of the url-resource as string, NULL on errors.
  */
 TIXI_INTERNAL_EXPORT char* curlGetURLInMemory(const char* url);
 
+
+/**
+  @brief Downloads several URL sources in parallel into local memory.
+
+  Connections to the same host are reused, also by later downloads.
+
+  @param int nURLs           (in)  Number of URLs
+  @param const char** urls   (in)  The source (http) URLs of the resources
+  @param char** contents     (out) The contents of the resources, NULL for failed downloads.
+                                   Each content has to be freed by the caller.
+ */
+TIXI_INTERNAL_EXPORT void curlGetURLsInMemory(int nURLs, const char** urls, char** contents);
+
+
+/**
+  @brief Downloads several XML documents in parallel and parses them while downloading.
+
+  The documents are parsed chunk by chunk as they are received, without
+  holding the whole document text in memory. If the HTTP cache is enabled,
+  documents are parsed from the cached files, if they were validated
+  recently or the server reports them as not modified.
+
+  @param int nURLs            (in)  Number of URLs
+  @param const char** urls    (in)  The source (http) URLs of the documents
+  @param int parseOptions     (in)  libxml2 parser options (xmlParserOption)
+  @param xmlDocPtr* documents (out) The parsed documents, NULL on errors.
+                                    Each document has to be freed by the caller.
+  @param ReturnCode* errors   (out) For each document
+                                    - SUCCESS
+                                    - OPEN_FAILED if the download failed
+                                    - NOT_WELL_FORMED if the document is not well formed
+ */
+TIXI_INTERNAL_EXPORT void curlGetURLsAsDocuments(int nURLs, const char** urls, int parseOptions,
+                                                 xmlDocPtr* documents, ReturnCode* errors);
+
+
+/**
+  @brief Downloads a XML document and parses it while downloading, see ::curlGetURLsAsDocuments.
+ */
+TIXI_INTERNAL_EXPORT ReturnCode curlGetURLAsDocument(const char* url, int parseOptions, xmlDocPtr* document);
+
+
+/**
+  @brief Closes all cached connections and frees the curl library.
+ */
+TIXI_INTERNAL_EXPORT void curlCleanup(void);
+
 #ifdef __cplusplus
 }
 #endif
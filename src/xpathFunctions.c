@@ -17,6 +17,8 @@
 */
 #include "xpathFunctions.h"
 #include "tixiInternal.h"
+#include "statistics.h"
+#include "xpathProfile.h"
 
 #include "libxml/xpathInternals.h"
 
@@ -25,6 +27,24 @@
 
 extern void printMsg(MessageType type, const char* message, ...);
 
+xmlXPathObjectPtr XPathEvaluate(xmlXPathContextPtr xpathContext, const char* xPathExpression)
+{
+  TixiDocument* document = (TixiDocument*) xpathContext->user;
+  xmlXPathObjectPtr xpathObject = NULL;
+  long long start = 0;
+
+  STATISTICS_COUNT(document, xpathEvaluations);
+  if (!document || !document->xpathProfile) {
+    return xmlXPathEvalExpression((const xmlChar*) xPathExpression, xpathContext);
+  }
+
+  start = statisticsNanoseconds();
+  xpathObject = xmlXPathEvalExpression((const xmlChar*) xPathExpression, xpathContext);
+  xpathProfileRecord(document->xpathProfile, xPathExpression, statisticsNanoseconds() - start,
+                     xpathObject && xpathObject->nodesetval ? xpathObject->nodesetval->nodeNr : 0);
+  return xpathObject;
+}
+
 xmlXPathObjectPtr XPathEvaluateExpression(TixiDocument* doc, const char* xPathExpression)
 {
   xmlXPathObjectPtr xpathObject;
@@ -35,11 +55,15 @@ xmlXPathObjectPtr XPathEvaluateExpression(TixiDocument* doc, const char* xPathEx
   
   xpathObject = XPathCacheGet(doc->xpathCache,(const xmlChar*) xPathExpression);
   if (xpathObject) {
+    STATISTICS_COUNT(doc, xpathCacheHits);
     return xpathObject;
   }
+  if (doc->xpathCache && doc->xpathCache->enabled) {
+    STATISTICS_COUNT(doc, xpathCacheMisses);
+  }
 
   /* Evaluate Expression */
-  xpathObject = xmlXPathEvalExpression((const xmlChar*) xPathExpression, doc->xpathContext);
+  xpathObject = XPathEvaluate(doc->xpathContext, xPathExpression);
   if (!(xpathObject)) {
     printMsg(MESSAGETYPE_ERROR, "Error: Invalid XPath expression \"%s\"\n", xPathExpression);
     return NULL;
@@ -221,7 +245,7 @@ int XPathRegisterDocumentNamespaces(xmlXPathContextPtr xpathContext)
 
 
   /* Get all unique namespace declarations */
-  xpathObj = xmlXPathEvalExpression((xmlChar *)"//*/namespace::*", xpathContext);
+  xpathObj = XPathEvaluate(xpathContext, "//*/namespace::*");
   if (xpathObj == NULL) {
     printMsg(MESSAGETYPE_ERROR, "Error: unable to retrieve all namespaces \n");
     return -1;
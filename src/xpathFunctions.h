@@ -48,6 +48,13 @@ TIXI_INTERNAL_EXPORT void XPathClearCache(XPathCache*);
 TIXI_INTERNAL_EXPORT xmlXPathObjectPtr XPathCacheGet(const XPathCache* cache, const xmlChar* xpath);
 TIXI_INTERNAL_EXPORT void XPathCacheInsert(XPathCache* cache, const xmlChar* xpath, const xmlXPathObjectPtr result);
 
+/**
+ * @brief Evaluates an xpath expression in the context of a document without using the cache.
+ *
+ * All evaluations of tixi go through this function, such that they are counted by the statistics.
+ */
+TIXI_INTERNAL_EXPORT xmlXPathObjectPtr XPathEvaluate(xmlXPathContextPtr xpathContext, const char* xPathExpression);
+
 TIXI_INTERNAL_EXPORT xmlXPathObjectPtr XPathEvaluateExpression(TixiDocument *tixiDocument, const char *xPathExpression);
 
 TIXI_INTERNAL_EXPORT int XPathGetNodeNumber(TixiDocument *tixiDocument, const char *xPathExpression);
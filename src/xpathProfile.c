@@ -0,0 +1,151 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "xpathProfile.h"
+
+#include <libxml/hash.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+  int evaluations;
+  long long nanoseconds;
+  int nodes;
+} XPathProfileRecord;
+
+struct XPathProfile
+{
+  xmlHashTablePtr expressions;   /**< XPathProfileRecord per expression */
+};
+
+typedef struct
+{
+  TixiXPathProfileEntry* entries;
+  char* strings;
+  int count;
+} ReportState;
+
+static void freeRecord(void* payload, const xmlChar* name)
+{
+  (void) name;
+  free(payload);
+}
+
+XPathProfile* xpathProfileCreate(void)
+{
+  XPathProfile* profile = (XPathProfile*) malloc(sizeof(XPathProfile));
+  if (!profile) {
+    return NULL;
+  }
+
+  profile->expressions = xmlHashCreate(0);
+  if (!profile->expressions) {
+    free(profile);
+    return NULL;
+  }
+  return profile;
+}
+
+void xpathProfileFree(XPathProfile* profile)
+{
+  if (!profile) {
+    return;
+  }
+  xmlHashFree(profile->expressions, freeRecord);
+  free(profile);
+}
+
+void xpathProfileRecord(XPathProfile* profile, const char* expression, long long nanoseconds, int nodes)
+{
+  XPathProfileRecord* record = (XPathProfileRecord*) xmlHashLookup(profile->expressions, (const xmlChar*) expression);
+  if (!record) {
+    record = (XPathProfileRecord*) calloc(1, sizeof(XPathProfileRecord));
+    if (!record) {
+      return;
+    }
+    if (xmlHashAddEntry(profile->expressions, (const xmlChar*) expression, record) != 0) {
+      free(record);
+      return;
+    }
+  }
+
+  record->evaluations++;
+  record->nanoseconds += nanoseconds;
+  record->nodes = nodes;
+}
+
+static void addStringLength(void* payload, void* data, const xmlChar* name)
+{
+  (void) payload;
+  *(size_t*) data += strlen((const char*) name) + 1;
+}
+
+static void addEntry(void* payload, void* data, const xmlChar* name)
+{
+  const XPathProfileRecord* record = (const XPathProfileRecord*) payload;
+  ReportState* state = (ReportState*) data;
+  TixiXPathProfileEntry* entry = &state->entries[state->count];
+  size_t length = strlen((const char*) name) + 1;
+
+  memcpy(state->strings, name, length);
+  entry->expression = state->strings;
+  entry->evaluations = record->evaluations;
+  entry->seconds = (double) record->nanoseconds * 1e-9;
+  entry->nodes = record->nodes;
+
+  state->strings += length;
+  state->count++;
+}
+
+static int compareEntries(const void* a, const void* b)
+{
+  const TixiXPathProfileEntry* left = (const TixiXPathProfileEntry*) a;
+  const TixiXPathProfileEntry* right = (const TixiXPathProfileEntry*) b;
+  if (left->seconds != right->seconds) {
+    return left->seconds < right->seconds ? 1 : -1;
+  }
+  if (left->evaluations != right->evaluations) {
+    return left->evaluations < right->evaluations ? 1 : -1;
+  }
+  return strcmp(left->expression, right->expression);
+}
+
+TixiXPathProfileEntry* xpathProfileReport(const XPathProfile* profile, int* nExpressions)
+{
+  int count = xmlHashSize(profile->expressions);
+  size_t stringsSize = 0;
+  ReportState state;
+
+  xmlHashScan(profile->expressions, addStringLength, &stringsSize);
+
+  /* the entries are followed by the expressions */
+  state.entries = (TixiXPathProfileEntry*) malloc(sizeof(TixiXPathProfileEntry) * count + stringsSize + 1);
+  if (!state.entries) {
+    return NULL;
+  }
+  state.strings = (char*) (state.entries + count);
+  state.count = 0;
+
+  xmlHashScan(profile->expressions, addEntry, &state);
+  qsort(state.entries, state.count, sizeof(TixiXPathProfileEntry), compareEntries);
+
+  *nExpressions = state.count;
+  return state.entries;
+}
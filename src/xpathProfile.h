@@ -0,0 +1,64 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_XPATHPROFILE_H
+#define TIXI_XPATHPROFILE_H
+
+#include "tixi.h"
+#include "tixiInternal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The XPath profile of a document records the number of evaluations, the
+ * time and the number of result nodes of each expression evaluated by
+ * XPathEvaluate. It is created by ::tixiSetXPathProfiling and stored in
+ * TixiDocument::xpathProfile, which is NULL while profiling is off.
+ */
+
+/**
+ * @brief Creates an empty profile.
+ *
+ * @return NULL, if memory cannot be allocated
+ */
+TIXI_INTERNAL_EXPORT XPathProfile* xpathProfileCreate(void);
+
+TIXI_INTERNAL_EXPORT void xpathProfileFree(XPathProfile* profile);
+
+/**
+ * @brief Adds an evaluation of expression, that took nanoseconds and returned nodes result nodes.
+ */
+TIXI_INTERNAL_EXPORT void xpathProfileRecord(XPathProfile* profile, const char* expression, long long nanoseconds, int nodes);
+
+/**
+ * @brief Returns the recorded expressions, sorted by their total time, the slowest first.
+ *
+ * The entries and the expressions are allocated in a single block, which
+ * has to be released with free.
+ *
+ * @return NULL, if memory cannot be allocated
+ */
+TIXI_INTERNAL_EXPORT TixiXPathProfileEntry* xpathProfileReport(const XPathProfile* profile, int* nExpressions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIXI_XPATHPROFILE_H
@@ -20,61 +20,406 @@
  */
 
 #include "xslTransformation.h"
+#include "fileCache.h"
+#include "threadPool.h"
+#include "libxslt/variables.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 extern void printMsg(MessageType type, const char* message, ...);
 
-char* xsltTransformToString(xmlDocPtr doc, const char* xslFilename)
+static ReturnCode loadStylesheet(const char* filename, void** data)
+{
+  xsltStylesheetPtr style = xsltParseStylesheetFile((const xmlChar*) filename);
+  if (style == NULL) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Could not parse XSLT file: %s\n", filename);
+    return FAILED;
+  }
+  *data = style;
+  return SUCCESS;
+}
+
+static void freeStylesheet(void* data)
+{
+  xsltFreeStylesheet((xsltStylesheetPtr) data);
+}
+
+static FileCache stylesheetCache = FILE_CACHE_INIT(loadStylesheet, freeStylesheet);
+
+ReturnCode xsltCacheLoad(const char* xslFilename, TixiStylesheetHandle* handle, xsltStylesheetPtr* style)
+{
+  void* data = NULL;
+  ReturnCode error = fileCacheLoad(&stylesheetCache, xslFilename, handle, &data);
+  if (error == SUCCESS) {
+    *style = (xsltStylesheetPtr) data;
+  }
+  return error;
+}
+
+xsltStylesheetPtr xsltCacheAcquire(TixiStylesheetHandle handle)
+{
+  return (xsltStylesheetPtr) fileCacheAcquire(&stylesheetCache, handle);
+}
+
+ReturnCode xsltCacheRelease(TixiStylesheetHandle handle)
+{
+  return fileCacheRelease(&stylesheetCache, handle);
+}
+
+void xsltCacheClear(void)
+{
+  fileCacheClear(&stylesheetCache);
+}
+
+char* xsltApplyToString(xmlDocPtr doc, xsltStylesheetPtr style)
 {
   xmlDocPtr res;
   xmlChar* string;
   int len;
-  xsltStylesheetPtr style;
-
-  style = xsltParseStylesheetFile ((const xmlChar*) xslFilename);
-  if (style == NULL) {
-    printMsg(MESSAGETYPE_ERROR, "xsltTransformToString: Could not parse XSLT file");
-    return NULL;
-  }
 
   res = xsltApplyStylesheet(style, doc, NULL);
   if (res == NULL) {
     printMsg(MESSAGETYPE_ERROR, "xsltTransformToString: Problem applying stylesheet");
-    xsltFreeStylesheet(style);
     return NULL;
   }
 
   xsltSaveResultToString(&string, &len, res, style);
   xmlFreeDoc(res);
-  xsltFreeStylesheet(style);
   return (char*) string;
 }
 
-
-ReturnCode xsltTransformToFile(xmlDocPtr doc, const char* xslFilename, const char* outputFilename)
+ReturnCode xsltApplyToFile(xmlDocPtr doc, xsltStylesheetPtr style, const char* outputFilename)
 {
   xmlDocPtr res;
-  xsltStylesheetPtr style;
 
-  if ( (xslFilename == NULL) || (outputFilename == NULL) ) {
+  if (outputFilename == NULL) {
     printMsg(MESSAGETYPE_ERROR, "xsltTransformToFile: Null pointer error");
     return FAILED;
   }
 
-  style = xsltParseStylesheetFile ((const xmlChar*) xslFilename);
-  if (style == NULL) {
-    printMsg(MESSAGETYPE_ERROR, "xsltTransformToFile: Could not parse XSLT file: %s", xslFilename);
-    return FAILED;
-  }
-
   res = xsltApplyStylesheet(style, doc, NULL);
   if (res == NULL) {
     printMsg(MESSAGETYPE_ERROR, "xsltTransformToFile: Problem applying stylesheet");
-    xsltFreeStylesheet(style);
     return FAILED;
   }
 
   xsltSaveResultToFilename(outputFilename, res, style, 0);
   xmlFreeDoc(res);
-  xsltFreeStylesheet(style);
   return SUCCESS;
 }
+
+xmlDocPtr xsltApplyToDocument(xmlDocPtr doc, xsltStylesheetPtr style,
+                              const char** paramNames, const char** paramValues, int nParams)
+{
+  xsltTransformContextPtr ctxt = NULL;
+  const char** params = NULL;
+  xmlDocPtr res = NULL;
+  int i;
+
+  if (nParams < 0 || (nParams > 0 && (paramNames == NULL || paramValues == NULL))) {
+    printMsg(MESSAGETYPE_ERROR, "xsltApplyToDocument: Null pointer error");
+    return NULL;
+  }
+
+  /* libxslt expects a NULL terminated list of name/value pairs */
+  params = (const char**) malloc((2 * nParams + 1) * sizeof(const char*));
+  if (params == NULL) {
+    return NULL;
+  }
+  for (i = 0; i < nParams; ++i) {
+    if (paramNames[i] == NULL || paramValues[i] == NULL) {
+      printMsg(MESSAGETYPE_ERROR, "xsltApplyToDocument: Null pointer error in stylesheet parameter %d", i + 1);
+      free((void*) params);
+      return NULL;
+    }
+    params[2 * i] = paramNames[i];
+    params[2 * i + 1] = paramValues[i];
+  }
+  params[2 * nParams] = NULL;
+
+  ctxt = xsltNewTransformContext(style, doc);
+  if (ctxt == NULL) {
+    free((void*) params);
+    return NULL;
+  }
+
+  /* the values are passed as strings, not as XPath expressions */
+  if (xsltQuoteUserParams(ctxt, params) == 0) {
+    res = xsltApplyStylesheetUser(style, doc, NULL, NULL, NULL, ctxt);
+  }
+  if (res != NULL && ctxt->state != XSLT_STATE_OK) {
+    xmlFreeDoc(res);
+    res = NULL;
+  }
+  if (res == NULL) {
+    printMsg(MESSAGETYPE_ERROR, "xsltApplyToDocument: Problem applying stylesheet");
+  }
+
+  xsltFreeTransformContext(ctxt);
+  free((void*) params);
+  return res;
+}
+
+/* state of a parallel transformation of documents or files */
+typedef struct
+{
+  xsltStylesheetPtr style;
+  xmlDocPtr* documents;
+  xmlDocPtr* results;
+  const char** inputFilenames;
+  const char** outputFilenames;
+  int* taskIndices;
+  ReturnCode* errors;
+  xmlGenericErrorFunc errorFunc;
+  void* errorContext;
+} BatchTransformation;
+
+static void transformBatchDocument(void* data, int task)
+{
+  BatchTransformation* batch = (BatchTransformation*) data;
+  int index = batch->taskIndices[task];
+
+  /* the generic error handler of libxml2 is thread local */
+  xmlSetGenericErrorFunc(batch->errorContext, batch->errorFunc);
+
+  batch->results[index] = xsltApplyToDocument(batch->documents[index], batch->style, NULL, NULL, 0);
+  batch->errors[index] = batch->results[index] ? SUCCESS : FAILED;
+}
+
+static void transformBatchFile(void* data, int index)
+{
+  BatchTransformation* batch = (BatchTransformation*) data;
+  const char* inputFilename = batch->inputFilenames[index];
+  const char* outputFilename = batch->outputFilenames[index];
+  xmlDocPtr doc = NULL;
+  xmlDocPtr res = NULL;
+  FILE* file = NULL;
+
+  xmlSetGenericErrorFunc(batch->errorContext, batch->errorFunc);
+
+  if (inputFilename == NULL || outputFilename == NULL) {
+    printMsg(MESSAGETYPE_ERROR, "xsltApplyToFiles: Null pointer error for file %d\n", index + 1);
+    batch->errors[index] = FAILED;
+    return;
+  }
+
+  /* same as xmlKeepBlanksDefault(0) in tixiOpenDocument, which is thread local */
+  doc = xmlReadFile(inputFilename, NULL, XML_PARSE_HUGE | XML_PARSE_NOBLANKS);
+  if (doc == NULL) {
+    file = fopen(inputFilename, "r");
+    if (file) {
+      fclose(file);
+      printMsg(MESSAGETYPE_ERROR, "Error: Document %s is not well formed.\n", inputFilename);
+      batch->errors[index] = NOT_WELL_FORMED;
+    }
+    else {
+      printMsg(MESSAGETYPE_ERROR, "Error: Could not open file %s.\n", inputFilename);
+      batch->errors[index] = OPEN_FAILED;
+    }
+    return;
+  }
+
+  res = xsltApplyToDocument(doc, batch->style, NULL, NULL, 0);
+  if (res == NULL) {
+    batch->errors[index] = FAILED;
+  }
+  else if (xsltSaveResultToFilename(outputFilename, res, batch->style, 0) < 0) {
+    printMsg(MESSAGETYPE_ERROR, "Error: Could not write file %s.\n", outputFilename);
+    batch->errors[index] = FAILED;
+  }
+  else {
+    batch->errors[index] = SUCCESS;
+  }
+
+  xmlFreeDoc(res);
+  xmlFreeDoc(doc);
+}
+
+typedef struct
+{
+  xmlDocPtr document;
+  int index;
+} DocumentIndex;
+
+static int compareDocumentIndex(const void* a, const void* b)
+{
+  const DocumentIndex* left = (const DocumentIndex*) a;
+  const DocumentIndex* right = (const DocumentIndex*) b;
+  if (left->document != right->document) {
+    return (uintptr_t) left->document < (uintptr_t) right->document ? -1 : 1;
+  }
+  return left->index - right->index;
+}
+
+static ReturnCode firstError(const ReturnCode* errors, int n)
+{
+  int i;
+  for (i = 0; i < n; ++i) {
+    if (errors[i] != SUCCESS) {
+      return errors[i];
+    }
+  }
+  return SUCCESS;
+}
+
+static void initBatch(BatchTransformation* batch, xsltStylesheetPtr style, ReturnCode* errors)
+{
+  memset(batch, 0, sizeof(BatchTransformation));
+  batch->style = style;
+  batch->errors = errors;
+  batch->errorFunc = xmlGenericError;
+  batch->errorContext = xmlGenericErrorContext;
+
+  /* global initialization must not happen in the worker threads */
+  xmlInitParser();
+  xsltInit();
+}
+
+ReturnCode xsltApplyToDocuments(xsltStylesheetPtr style, xmlDocPtr* documents, int nDocuments, int nThreads,
+                                xmlDocPtr* results, ReturnCode* errors)
+{
+  BatchTransformation batch;
+  ReturnCode* ownErrors = NULL;
+  DocumentIndex* sorted = NULL;
+  int* sources = NULL;
+  int nTasks = 0;
+  int i;
+  ReturnCode error;
+
+  if (nDocuments <= 0) {
+    return SUCCESS;
+  }
+
+  for (i = 0; i < nDocuments; ++i) {
+    results[i] = NULL;
+  }
+
+  if (errors == NULL) {
+    errors = ownErrors = (ReturnCode*) malloc(nDocuments * sizeof(ReturnCode));
+  }
+  initBatch(&batch, style, errors);
+  batch.documents = documents;
+  batch.results = results;
+  batch.taskIndices = (int*) malloc(nDocuments * sizeof(int));
+
+  /* libxslt modifies the source document (document order), so that each
+   * document must be transformed by a single thread only */
+  sorted = (DocumentIndex*) malloc(nDocuments * sizeof(DocumentIndex));
+  sources = (int*) malloc(nDocuments * sizeof(int));
+  if (!errors || !batch.taskIndices || !sorted || !sources) {
+    printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in xsltApplyToDocuments.\n");
+    for (i = 0; errors && i < nDocuments; ++i) {
+      errors[i] = FAILED;
+    }
+    free(batch.taskIndices);
+    free(sources);
+    free(sorted);
+    free(ownErrors);
+    return FAILED;
+  }
+
+  for (i = 0; i < nDocuments; ++i) {
+    sorted[i].document = documents[i];
+    sorted[i].index = i;
+  }
+  qsort(sorted, nDocuments, sizeof(DocumentIndex), compareDocumentIndex);
+  for (i = 0; i < nDocuments; ++i) {
+    if (i == 0 || sorted[i].document != sorted[i - 1].document) {
+      batch.taskIndices[nTasks++] = sorted[i].index;
+      sources[sorted[i].index] = sorted[i].index;
+    }
+    else {
+      sources[sorted[i].index] = sources[sorted[i - 1].index];
+    }
+  }
+
+  threadPoolRun(nTasks, nThreads, transformBatchDocument, &batch);
+
+  for (i = 0; i < nDocuments; ++i) {
+    if (sources[i] != i) {
+      errors[i] = errors[sources[i]];
+      if (results[sources[i]]) {
+        results[i] = xmlCopyDoc(results[sources[i]], 1);
+        errors[i] = results[i] ? SUCCESS : FAILED;
+      }
+    }
+  }
+
+  error = firstError(errors, nDocuments);
+  free(batch.taskIndices);
+  free(sources);
+  free(sorted);
+  free(ownErrors);
+  return error;
+}
+
+ReturnCode xsltApplyToFiles(xsltStylesheetPtr style, const char** inputFilenames, const char** outputFilenames,
+                            int nFiles, int nThreads, ReturnCode* errors)
+{
+  BatchTransformation batch;
+  ReturnCode* ownErrors = NULL;
+  ReturnCode error;
+
+  if (nFiles <= 0) {
+    return SUCCESS;
+  }
+
+  if (errors == NULL) {
+    errors = ownErrors = (ReturnCode*) malloc(nFiles * sizeof(ReturnCode));
+    if (!errors) {
+      printMsg(MESSAGETYPE_ERROR, "Internal Error: Failed to allocate memory in xsltApplyToFiles.\n");
+      return FAILED;
+    }
+  }
+  initBatch(&batch, style, errors);
+  batch.inputFilenames = inputFilenames;
+  batch.outputFilenames = outputFilenames;
+
+  threadPoolRun(nFiles, nThreads, transformBatchFile, &batch);
+
+  error = firstError(errors, nFiles);
+  free(ownErrors);
+  return error;
+}
+
+char* xsltTransformToString(xmlDocPtr doc, const char* xslFilename)
+{
+  xsltStylesheetPtr style;
+  TixiStylesheetHandle styleHandle = -1;
+  char* result = NULL;
+
+  /* the reference keeps the stylesheet alive, if the file is changed during the transformation */
+  if (xsltCacheLoad(xslFilename, &styleHandle, &style) != SUCCESS) {
+    printMsg(MESSAGETYPE_ERROR, "xsltTransformToString: Could not parse XSLT file");
+    return NULL;
+  }
+
+  result = xsltApplyToString(doc, style);
+  xsltCacheRelease(styleHandle);
+  return result;
+}
+
+
+ReturnCode xsltTransformToFile(xmlDocPtr doc, const char* xslFilename, const char* outputFilename)
+{
+  xsltStylesheetPtr style;
+  TixiStylesheetHandle styleHandle = -1;
+  ReturnCode error = SUCCESS;
+
+  if ( (xslFilename == NULL) || (outputFilename == NULL) ) {
+    printMsg(MESSAGETYPE_ERROR, "xsltTransformToFile: Null pointer error");
+    return FAILED;
+  }
+
+  if (xsltCacheLoad(xslFilename, &styleHandle, &style) != SUCCESS) {
+    printMsg(MESSAGETYPE_ERROR, "xsltTransformToFile: Could not parse XSLT file: %s", xslFilename);
+    return FAILED;
+  }
+
+  error = xsltApplyToFile(doc, style, outputFilename);
+  xsltCacheRelease(styleHandle);
+  return error;
+}
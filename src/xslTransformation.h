@@ -66,6 +66,107 @@ char* xsltTransformToString(xmlDocPtr doc, const char *xslFilename);
  */
 ReturnCode xsltTransformToFile(xmlDocPtr doc, const char *xslFilename, const char *outputFilename);
 
+/**
+  @brief Returns the compiled stylesheet of a file from the stylesheet cache, parsing it
+         only if the file is not cached or was modified since it was cached.
+
+  @param char *xslFilename (in) Filename of the stylesheet file
+  @param TixiStylesheetHandle *handle (out) Handle of the stylesheet in the cache. It holds a reference
+                                            to the stylesheet, which has to be dropped with ::xsltCacheRelease
+  @param xsltStylesheetPtr *style (out) The compiled stylesheet, owned by the cache
+
+  @return ReturnCode
+    - SUCCESS              if the stylesheet was loaded
+    - OPEN_FAILED          if the file does not exist
+    - FAILED               if the stylesheet cannot be parsed
+ */
+ReturnCode xsltCacheLoad(const char* xslFilename, TixiStylesheetHandle* handle, xsltStylesheetPtr* style);
+
+/**
+  @brief Adds a reference to the compiled stylesheet of a handle returned by ::xsltCacheLoad, which has
+         to be dropped with ::xsltCacheRelease. Returns NULL if the handle is not valid.
+ */
+xsltStylesheetPtr xsltCacheAcquire(TixiStylesheetHandle handle);
+
+/**
+  @brief Drops a reference added by ::xsltCacheLoad or ::xsltCacheAcquire, returns INVALID_HANDLE if the handle holds none.
+ */
+ReturnCode xsltCacheRelease(TixiStylesheetHandle handle);
+
+/**
+  @brief Frees all cached stylesheets.
+ */
+void xsltCacheClear(void);
+
+/**
+  @brief Applies a compiled stylesheet to a document and returns the result doc as string.
+
+  @return char*
+    The resulting document as string, to be freed with xmlFree
+ */
+char* xsltApplyToString(xmlDocPtr doc, xsltStylesheetPtr style);
+
+/**
+  @brief Applies a compiled stylesheet to a document and saves the resulting doc in a local file.
+
+  @return ReturnCode
+    - SUCCESS              if the result was saved
+    - FAILED               for all internal errors
+ */
+ReturnCode xsltApplyToFile(xmlDocPtr doc, xsltStylesheetPtr style, const char* outputFilename);
+
+/**
+  @brief Applies a compiled stylesheet to a document and returns the resulting document.
+
+  @param xmlDocPtr doc (in) The document on which the transformation should be performed
+  @param xsltStylesheetPtr style (in) The compiled stylesheet
+  @param char **paramNames (in) Names of the stylesheet parameters, may be NULL if nParams is 0
+  @param char **paramValues (in) String values of the stylesheet parameters
+  @param int nParams (in) Number of stylesheet parameters
+
+  @return xmlDocPtr
+    The resulting document to be freed with xmlFreeDoc, or NULL if the transformation failed
+ */
+xmlDocPtr xsltApplyToDocument(xmlDocPtr doc, xsltStylesheetPtr style,
+                              const char** paramNames, const char** paramValues, int nParams);
+
+/**
+  @brief Applies a compiled stylesheet to several documents in parallel.
+
+  Each thread uses its own transformation context, the stylesheet is shared read-only.
+  Documents occuring multiple times are transformed only once and the result is copied.
+
+  @param xsltStylesheetPtr style (in) The compiled stylesheet
+  @param xmlDocPtr *documents (in) The documents to be transformed
+  @param int nDocuments (in) Number of documents
+  @param int nThreads (in) Maximum number of threads, or <= 0 for the number of processors
+  @param xmlDocPtr *results (out) The resulting documents, NULL for failed transformations
+  @param ReturnCode *errors (out) The error code for each document, may be NULL
+
+  @return ReturnCode
+    - SUCCESS              if all documents were transformed
+    - FAILED               if at least one transformation failed
+ */
+ReturnCode xsltApplyToDocuments(xsltStylesheetPtr style, xmlDocPtr* documents, int nDocuments, int nThreads,
+                                xmlDocPtr* results, ReturnCode* errors);
+
+/**
+  @brief Reads several XML files, applies a compiled stylesheet and saves the results, in parallel.
+
+  @param xsltStylesheetPtr style (in) The compiled stylesheet
+  @param char **inputFilenames (in) The files to be transformed
+  @param char **outputFilenames (in) The files the results are written to
+  @param int nFiles (in) Number of files
+  @param int nThreads (in) Maximum number of threads, or <= 0 for the number of processors
+  @param ReturnCode *errors (out) The error code for each file, may be NULL
+
+  @return ReturnCode
+    - SUCCESS              if all files were transformed
+    - the error of the first failed file otherwise (OPEN_FAILED, NOT_WELL_FORMED or FAILED)
+ */
+ReturnCode xsltApplyToFiles(xsltStylesheetPtr style, const char** inputFilenames, const char** outputFilenames,
+                            int nFiles, int nThreads, ReturnCode* errors);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,7 @@
+<?xml version="1.0" encoding="utf-8"?>
+<xsl:stylesheet version="1.0" xmlns:xsl="http://www.w3.org/1999/XSL/Transform">
+ <xsl:output method="text" />
+ <xsl:template match="/">
+  <xsl:value-of select="cpacs/aircraft/configurations/configuration/reference/area" />
+ </xsl:template>
+</xsl:stylesheet>
@@ -0,0 +1,14 @@
+<?xml version="1.0" encoding="utf-8"?>
+<xsl:stylesheet version="1.0" xmlns:xsl="http://www.w3.org/1999/XSL/Transform" xmlns:c="http://www.w3.org/1999/xhtml" exclude-result-prefixes="c">
+ <xsl:output method="xml" />
+ <xsl:param name="toolName" select="'defaultTool'" />
+ <xsl:param name="version" select="'1.0'" />
+ <xsl:template match="/">
+  <toolInput>
+   <tool version="{$version}"><xsl:value-of select="$toolName" /></tool>
+   <data>
+    <var1><xsl:value-of select="c:cpacs/c:aircraft/c:configurations/c:configuration/c:reference/c:area" /></var1>
+   </data>
+  </toolInput>
+ </xsl:template>
+</xsl:stylesheet>
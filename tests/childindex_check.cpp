@@ -0,0 +1,141 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tixi.h"
+
+#include <string>
+
+class ChildIndexTests : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+    ASSERT_EQ(SUCCESS, tixiCreateElement(handle, "/root", "sections"));
+    for (int i = 1; i <= 100; ++i) {
+      ASSERT_EQ(SUCCESS, tixiAddIntegerElement(handle, "/root/sections", "section", i, NULL));
+      ASSERT_EQ(SUCCESS, tixiAddIntegerElement(handle, "/root/sections", "other", -i, NULL));
+    }
+  }
+
+  void TearDown()
+  {
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+  }
+
+  TixiDocumentHandle handle;
+};
+
+TEST_F(ChildIndexTests, namedChildrenCount)
+{
+  int count = 0;
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "section", &count));
+  EXPECT_EQ(100, count);
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "other", &count));
+  EXPECT_EQ(100, count);
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "none", &count));
+  EXPECT_EQ(0, count);
+}
+
+TEST_F(ChildIndexTests, indexedAccess)
+{
+  int value = 0;
+  for (int i = 1; i <= 100; ++i) {
+    std::string path = "/root/sections/section[" + std::to_string(i) + "]";
+    ASSERT_EQ(SUCCESS, tixiGetIntegerElement(handle, path.c_str(), &value));
+    EXPECT_EQ(i, value);
+  }
+
+  ASSERT_EQ(SUCCESS, tixiGetIntegerElement(handle, "/root[1]/sections/other[42]", &value));
+  EXPECT_EQ(-42, value);
+
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiCheckElement(handle, "/root/sections/section[0]"));
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiCheckElement(handle, "/root/sections/section[101]"));
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiCheckElement(handle, "/root/none/section[1]"));
+  EXPECT_EQ(ELEMENT_PATH_NOT_UNIQUE, tixiGetIntegerElement(handle, "/root/sections/section", &value));
+}
+
+TEST_F(ChildIndexTests, invalidation)
+{
+  int count = 0;
+  int value = 0;
+
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "section", &count));
+  ASSERT_EQ(100, count);
+
+  ASSERT_EQ(SUCCESS, tixiRemoveElement(handle, "/root/sections/section[1]"));
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "section", &count));
+  EXPECT_EQ(99, count);
+  ASSERT_EQ(SUCCESS, tixiGetIntegerElement(handle, "/root/sections/section[1]", &value));
+  EXPECT_EQ(2, value);
+
+  ASSERT_EQ(SUCCESS, tixiCreateElementAtIndex(handle, "/root/sections", "section", 1));
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "section", &count));
+  EXPECT_EQ(100, count);
+  EXPECT_EQ(SUCCESS, tixiCheckElement(handle, "/root/sections/section[100]"));
+
+  ASSERT_EQ(SUCCESS, tixiRenameElement(handle, "/root/sections", "other[1]", "section"));
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "section", &count));
+  EXPECT_EQ(101, count);
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/sections", "other", &count));
+  EXPECT_EQ(99, count);
+
+  ASSERT_EQ(SUCCESS, tixiSwapElements(handle, "/root/sections/section[2]", "/root/sections/other[1]"));
+
+  // the results must be consistent with plain xpath evaluation
+  const char* paths[] = {"/root/sections/section[2]", "/root/sections/section[3]", "/root/sections/other[1]"};
+  for (const char* path : paths) {
+    char* text = NULL;
+    char* xpathText = NULL;
+    ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, path, &text));
+    ASSERT_EQ(SUCCESS, tixiXPathExpressionGetTextByIndex(handle, path, 1, &xpathText));
+    EXPECT_STREQ(xpathText, text);
+  }
+}
+
+TEST(ChildIndex, namespaces)
+{
+  TixiDocumentHandle handle = -1;
+  int count = 0;
+  char* text = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/namespaces_1.xml", &handle));
+  ASSERT_EQ(SUCCESS, tixiRegisterNamespace(handle, "http://www.w3.org/TR/html4/", "h"));
+  ASSERT_EQ(SUCCESS, tixiRegisterNamespace(handle, "http://www.dlr.de/cpacs", "c"));
+
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/h:table/h:tr", "h:td", &count));
+  EXPECT_EQ(2, count);
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root/h:table/h:tr", "td", &count));
+  EXPECT_EQ(0, count);
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root", "table", &count));
+  EXPECT_EQ(0, count);
+
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/root/h:table/h:tr/h:td[2]", &text));
+  EXPECT_STREQ("Bananas", text);
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/root/c:aircraft/c:modelname", &text));
+  EXPECT_STREQ("D150", text);
+
+  // the default namespace does not apply to xpath expressions
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiCheckElement(handle, "/root/aircraft"));
+
+  // unregistered prefix
+  EXPECT_EQ(INVALID_XPATH, tixiCheckElement(handle, "/root/x:table"));
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
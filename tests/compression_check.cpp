@@ -0,0 +1,187 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tixi.h"
+#include "compression.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<unsigned char> readBytes(const char* filename, size_t count)
+{
+  std::vector<unsigned char> bytes(count);
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    return std::vector<unsigned char>();
+  }
+  bytes.resize(fread(bytes.data(), 1, count, file));
+  fclose(file);
+  return bytes;
+}
+
+std::string withoutDeclaration(const std::string& content)
+{
+  return content.substr(content.find('\n') + 1);
+}
+
+void writeFile(const char* filename, const char* content)
+{
+  FILE* file = fopen(filename, "wb");
+  ASSERT_TRUE(file != NULL);
+  fputs(content, file);
+  fclose(file);
+}
+
+} // namespace
+
+class CompressionTests : public ::testing::TestWithParam<const char*>
+{
+protected:
+  void SetUp()
+  {
+    if (!compressionSupported(compressionFormat(GetParam()))) {
+      GTEST_SKIP() << "TiXI is built without support for " << GetParam();
+    }
+
+    // more than one compressed block
+    ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+    ASSERT_EQ(SUCCESS, tixiCreateElement(handle, "/root", "values"));
+    for (int i = 1; i <= 40000; ++i) {
+      ASSERT_EQ(SUCCESS, tixiAddDoubleElement(handle, "/root/values", "value", i * 0.125, "%g"));
+    }
+    ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(handle, &content));
+    expected = content;
+    ASSERT_GT(expected.size(), 1024u * 1024u);
+  }
+
+  void TearDown()
+  {
+    if (handle != -1) {
+      ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+    }
+    remove(GetParam());
+  }
+
+  TixiDocumentHandle handle = -1;
+  char* content = NULL;
+  std::string expected;
+};
+
+TEST_P(CompressionTests, saveAndOpen)
+{
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, GetParam()));
+
+  std::vector<unsigned char> magic = readBytes(GetParam(), 4);
+  ASSERT_EQ(4u, magic.size());
+  if (compressionFormat(GetParam()) == COMPRESSION_GZIP) {
+    EXPECT_EQ(0x1f, magic[0]);
+    EXPECT_EQ(0x8b, magic[1]);
+  }
+  else {
+    EXPECT_EQ(0x28, magic[0]);
+    EXPECT_EQ(0xb5, magic[1]);
+    EXPECT_EQ(0x2f, magic[2]);
+    EXPECT_EQ(0xfd, magic[3]);
+  }
+
+  TixiDocumentHandle opened = -1;
+  ASSERT_EQ(SUCCESS, tixiOpenDocument(GetParam(), &opened));
+  char* openedContent = NULL;
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(opened, &openedContent));
+  // the saved declaration contains the encoding
+  std::string openedText = withoutDeclaration(openedContent);
+  EXPECT_EQ(withoutDeclaration(expected).size(), openedText.size());
+  EXPECT_TRUE(withoutDeclaration(expected) == openedText);
+
+  int count = 0;
+  EXPECT_EQ(SUCCESS, tixiGetNamedChildrenCount(opened, "/root/values", "value", &count));
+  EXPECT_EQ(40000, count);
+  double value = 0.;
+  EXPECT_EQ(SUCCESS, tixiGetDoubleElement(opened, "/root/values/value[40000]", &value));
+  EXPECT_EQ(5000., value);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(opened));
+}
+
+TEST_P(CompressionTests, compressedExternalData)
+{
+  const std::string included = std::string("compressed-included.xml") + strrchr(GetParam(), '.');
+  const std::string main = "<?xml version=\"1.0\"?>\n"
+                           "<plane><externaldata><path></path><filename>" + included +
+                           "</filename></externaldata></plane>\n";
+  writeFile("compressed-main.xml", main.c_str());
+
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, included.c_str()));
+
+  TixiDocumentHandle opened = -1;
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentRecursive("compressed-main.xml", &opened, OPENMODE_RECURSIVE));
+  int count = 0;
+  EXPECT_EQ(SUCCESS, tixiGetNamedChildrenCount(opened, "/plane/root/values", "value", &count));
+  EXPECT_EQ(40000, count);
+
+  // external files are written back compressed
+  ASSERT_EQ(SUCCESS, tixiUpdateDoubleElement(opened, "/plane/root/values/value[1]", 42., "%g"));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(opened, "compressed-main.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(opened));
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocument(included.c_str(), &opened));
+  double value = 0.;
+  EXPECT_EQ(SUCCESS, tixiGetDoubleElement(opened, "/root/values/value[1]", &value));
+  EXPECT_EQ(42., value);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(opened));
+
+  remove(included.c_str());
+  remove("compressed-main.xml");
+}
+
+TEST_P(CompressionTests, openCorrupt)
+{
+  writeFile(GetParam(), "no compressed data");
+
+  TixiDocumentHandle opened = -1;
+  EXPECT_NE(SUCCESS, tixiOpenDocument(GetParam(), &opened));
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, CompressionTests,
+                         ::testing::Values("compression-test.xml.gz", "compression-test.xml.zst"));
+
+TEST(Compression, saveUncompressed)
+{
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, "compression-plain.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+
+  std::vector<unsigned char> bytes = readBytes("compression-plain.xml", 5);
+  EXPECT_EQ("<?xml", std::string(bytes.begin(), bytes.end()));
+  remove("compression-plain.xml");
+}
+
+TEST(Compression, format)
+{
+  EXPECT_EQ(COMPRESSION_GZIP, compressionFormat("a.xml.gz"));
+  EXPECT_EQ(COMPRESSION_ZSTD, compressionFormat("dir/a.xml.zst"));
+  EXPECT_EQ(COMPRESSION_NONE, compressionFormat("a.xml"));
+  EXPECT_EQ(COMPRESSION_NONE, compressionFormat("a.gz.xml"));
+  EXPECT_EQ(1, compressionSupported(COMPRESSION_GZIP));
+}
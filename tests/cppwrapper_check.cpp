@@ -242,3 +242,193 @@ TEST(CppWrapper, getChildElementPaths) {
     EXPECT_EQ(0, childPaths.size());
 }
 
+
+#ifdef TIXICPP_HAS_DOCUMENT
+
+static const char* documentXml =
+    "<plane name=\"Plane\" seats=\" 42 \">"
+    "<span>+12.5</span>"
+    "<count> 3 </count>"
+    "<isJet>true</isJet>"
+    "<noNumber>1.5a</noNumber>"
+    "<empty/>"
+    "<points mapType=\"vector\">1;2.5;-3</points>"
+    "</plane>";
+
+TEST(CppWrapperDocument, moveAndClose)
+{
+    tixi::Document document = tixi::Document::fromString(documentXml);
+    const TixiDocumentHandle handle = document.handle();
+    ASSERT_TRUE(static_cast<bool>(document));
+
+    tixi::Document moved(std::move(document));
+    EXPECT_FALSE(static_cast<bool>(document));
+    EXPECT_EQ(handle, moved.handle());
+
+    tixi::Document assigned;
+    assigned = std::move(moved);
+    EXPECT_FALSE(static_cast<bool>(moved));
+    EXPECT_EQ(handle, assigned.handle());
+    EXPECT_TRUE(assigned.checkElement("/plane/span"));
+
+    assigned.close();
+    EXPECT_FALSE(static_cast<bool>(assigned));
+    char* text = NULL;
+    EXPECT_EQ(INVALID_HANDLE, tixiGetTextElement(handle, "/plane/span", &text));
+}
+
+TEST(CppWrapperDocument, closedByDestructor)
+{
+    TixiDocumentHandle handle = -1;
+    {
+        tixi::Document document = tixi::Document::create("root");
+        handle = document.handle();
+    }
+    EXPECT_EQ(INVALID_HANDLE, tixiCheckElement(handle, "/root"));
+}
+
+TEST(CppWrapperDocument, release)
+{
+    tixi::Document document = tixi::Document::fromString(documentXml);
+    const TixiDocumentHandle handle = document.release();
+    EXPECT_FALSE(static_cast<bool>(document));
+    EXPECT_EQ(SUCCESS, tixiCheckElement(handle, "/plane/span"));
+    EXPECT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+TEST(CppWrapperDocument, getText)
+{
+    const tixi::Document document = tixi::Document::fromString(documentXml);
+    EXPECT_EQ("+12.5", document.getText("/plane/span"));
+    EXPECT_EQ("", document.getText("/plane/empty"));
+    EXPECT_EQ("Plane", document.getTextAttribute("/plane", "name"));
+    EXPECT_EQ("+12.5", document.get<std::string>(std::string("/plane/span")));
+
+    // the view points to the text stored in the document
+    const std::string_view first = document.getText("/plane/span");
+    const std::string_view second = document.getText("/plane/span");
+    EXPECT_EQ(first.data(), second.data());
+
+    EXPECT_TIXI_ERROR(ELEMENT_NOT_FOUND, document.getText("/plane/missing"));
+    EXPECT_TIXI_ERROR(ATTRIBUTE_NOT_FOUND, document.getTextAttribute("/plane", "missing"));
+}
+
+TEST(CppWrapperDocument, getConverted)
+{
+    const tixi::Document document = tixi::Document::fromString(documentXml);
+    EXPECT_DOUBLE_EQ(12.5, document.get<double>("/plane/span"));
+    EXPECT_FLOAT_EQ(12.5f, document.get<float>("/plane/span"));
+    EXPECT_EQ(3, document.get<int>("/plane/count"));
+    EXPECT_EQ(3u, document.get<std::size_t>("/plane/count"));
+    EXPECT_TRUE(document.get<bool>("/plane/isJet"));
+    EXPECT_EQ(42, document.getAttribute<int>("/plane", "seats"));
+    EXPECT_EQ("Plane", document.getAttribute<std::string_view>("/plane", "name"));
+
+    EXPECT_TIXI_ERROR(NO_NUMBER, document.get<double>("/plane/noNumber"));
+    EXPECT_TIXI_ERROR(NO_NUMBER, document.get<int>("/plane/span"));
+    EXPECT_TIXI_ERROR(NO_NUMBER, document.get<int>("/plane/empty"));
+    EXPECT_TIXI_ERROR(NO_NUMBER, document.getAttribute<double>("/plane", "name"));
+    EXPECT_TIXI_ERROR(FAILED, document.get<bool>("/plane/span"));
+}
+
+TEST(CppWrapperDocument, getFloatVector)
+{
+    tixi::Document document = tixi::Document::fromString(documentXml);
+    tixi::span<const double> values = document.getFloatVector("/plane/points");
+    ASSERT_EQ(3u, values.size());
+    EXPECT_DOUBLE_EQ(1., values[0]);
+    EXPECT_DOUBLE_EQ(2.5, values[1]);
+    EXPECT_DOUBLE_EQ(-3., values[2]);
+
+    double sum = 0.;
+    for (double value : values) {
+        sum += value;
+    }
+    EXPECT_DOUBLE_EQ(0.5, sum);
+
+    EXPECT_TIXI_ERROR(ELEMENT_NOT_FOUND, document.getFloatVector("/plane/missing"));
+}
+
+TEST(CppWrapperDocument, saveElements)
+{
+    tixi::Document document = tixi::Document::create("root");
+    document.createElementsIfNotExists("/root/a/b");
+    document.saveElement("/root/a/b", 5);
+    document.saveAttribute("/root/a", "name", std::string("wing"));
+    EXPECT_EQ(5, document.get<int>("/root/a/b"));
+    EXPECT_EQ("wing", document.getTextAttribute("/root/a", "name"));
+    EXPECT_TRUE(document.checkAttribute("/root/a", "name"));
+    EXPECT_FALSE(document.checkAttribute("/root/a", "missing"));
+
+    document.removeElement("/root/a");
+    EXPECT_FALSE(document.checkElement("/root/a"));
+}
+
+TEST(CppWrapperXPath, splitAtCompileTime)
+{
+    constexpr tixi::XPath path("/plane/wings/wing[2]/p:name");
+    static_assert(path.isSimple(), "path consists of child steps");
+    static_assert(path.stepCount() == 4, "path has 4 steps");
+    static_assert(path.steps()[2].index == 2, "index of third step is 2");
+    static_assert(path.steps()[3].nameLength == 6, "name of last step is p:name");
+
+    using namespace tixi::literals;
+    static_assert(!"/plane//wing"_xpath.isSimple(), "descendant axis is evaluated at runtime");
+    static_assert(!"/plane/wing[@uID='w1']"_xpath.isSimple(), "predicates are evaluated at runtime");
+    static_assert(!"/plane/@name"_xpath.isSimple(), "attributes are evaluated at runtime");
+    static_assert(!"/plane/wing[0]"_xpath.isSimple(), "invalid index is evaluated at runtime");
+    static_assert(!"plane/wing"_xpath.isSimple(), "relative paths are evaluated at runtime");
+    static_assert(!"/plane/text()"_xpath.isSimple(), "functions are evaluated at runtime");
+    static_assert(!"/plane/child::wing"_xpath.isSimple(), "axes are evaluated at runtime");
+
+    EXPECT_EQ(std::string("/plane/wings/wing[2]/p:name"), path.str());
+    EXPECT_EQ(std::string("wing"), std::string(path.steps()[2].name, path.steps()[2].nameLength));
+}
+
+TEST(CppWrapperXPath, invalidXPath)
+{
+    EXPECT_TIXI_ERROR(INVALID_XPATH, tixi::XPath(""));
+    EXPECT_TIXI_ERROR(INVALID_XPATH, tixi::XPath("/plane/wing[1"));
+    EXPECT_TIXI_ERROR(INVALID_XPATH, tixi::XPath("/plane/wing[1)]"));
+    EXPECT_TIXI_ERROR(INVALID_XPATH, tixi::XPath("/plane/wing[@uID='w1]"));
+    EXPECT_TIXI_ERROR(INVALID_XPATH, tixi::XPath(std::string("/plane)")));
+}
+
+TEST(CppWrapperXPath, resolveSteps)
+{
+    tixi::Document document = tixi::Document::open("TestData/in.xml");
+
+    constexpr tixi::XPath name("/plane/name");
+    EXPECT_EQ("Junkers JU 52", document.getText(name));
+    EXPECT_EQ("right", document.getTextAttribute("/plane/wings/wing[2]", "position"));
+    EXPECT_EQ(document.getText("/plane/wings/wing[2]/centerOfGravity/x"),
+              document.getText("//wing[@position='right']/centerOfGravity/x"));
+
+    EXPECT_TRUE(document.checkElement("/plane/wings/wing"));
+    EXPECT_TRUE(document.checkElement("/plane/wings/wing[2]"));
+    EXPECT_FALSE(document.checkElement("/plane/wings/wing[3]"));
+    EXPECT_FALSE(document.checkElement("/plane/missing/name"));
+
+    EXPECT_TIXI_ERROR(ELEMENT_PATH_NOT_UNIQUE, document.getText("/plane/wings/wing"));
+    EXPECT_TIXI_ERROR(ELEMENT_NOT_FOUND, document.getText("/plane/wings/wing[3]"));
+    EXPECT_TIXI_ERROR(INVALID_XPATH, document.getText("/plane/unknown:name"));
+}
+
+TEST(CppWrapperXPath, resolveStepsWithNamespaces)
+{
+    tixi::Document document = tixi::Document::fromString(
+        "<root xmlns:a=\"http://a\"><a:child><a:name>a</a:name></a:child><child><name>b</name></child></root>");
+    tixi::TixiRegisterNamespace(document.handle(), "http://a", "a");
+    EXPECT_EQ("a", document.getText("/root/a:child/a:name"));
+    EXPECT_EQ("b", document.getText("/root/child/name"));
+}
+
+TEST(CppWrapperXPath, stepsAsXPathForUnionOfElements)
+{
+    // the second wing contains the only name, like the XPath expression the steps are unique
+    tixi::Document document = tixi::Document::fromString(
+        "<root><wing/><wing><name>w2</name></wing></root>");
+    EXPECT_EQ("w2", document.getText("/root/wing/name"));
+}
+
+#endif // TIXICPP_HAS_DOCUMENT
@@ -83,6 +83,22 @@ TEST_F(GetAttributeTests, notUnique)
   ASSERT_TRUE( tixiGetTextAttribute( documentHandle, elementPath, attributeName, &text ) == ELEMENT_PATH_NOT_UNIQUE );
 }
 
+TEST_F(GetAttributeTests, getTextAttributeView)
+{
+  char* text = NULL;
+  char* second = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetTextAttributeView( documentHandle, "/plane/wings/wing[2]", "position", &text ));
+  EXPECT_STREQ("right", text);
+
+  // the text is not copied
+  ASSERT_EQ(SUCCESS, tixiGetTextAttributeView( documentHandle, "/plane/wings/wing[2]", "position", &second ));
+  EXPECT_EQ(text, second);
+
+  EXPECT_EQ(ATTRIBUTE_NOT_FOUND, tixiGetTextAttributeView( documentHandle, "/plane/name", "non_existing_attribute", &text ));
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiGetTextAttributeView( documentHandle, "/plane/name/pp", "position", &text ));
+  EXPECT_EQ(INVALID_HANDLE, tixiGetTextAttributeView( -1, "/plane/name", "position", &text ));
+}
+
 TEST_F(GetAttributeTests, getDoubleAttribute)
 {
   double number = 0.;
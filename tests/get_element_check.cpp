@@ -62,6 +62,26 @@ TEST_F(GetElementTests, getElementText)
   ASSERT_TRUE( !strcmp(text, "Junkers JU 52"));
 }
 
+TEST_F(GetElementTests, getElementTextView)
+{
+  char* text = NULL;
+  char* second = NULL;
+  const char* elementPath = "/plane/name";
+  ASSERT_EQ(SUCCESS, tixiGetTextElementView( documentHandle, elementPath, &text ));
+  EXPECT_STREQ("Junkers JU 52", text);
+
+  // the text is not copied
+  ASSERT_EQ(SUCCESS, tixiGetTextElementView( documentHandle, elementPath, &second ));
+  EXPECT_EQ(text, second);
+
+  ASSERT_EQ(SUCCESS, tixiGetTextElementView( documentHandle, "/plane/empty", &text ));
+  EXPECT_STREQ("", text);
+
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiGetTextElementView( documentHandle, "/plane/name/pp", &text ));
+  EXPECT_EQ(NOT_AN_ELEMENT, tixiGetTextElementView( documentHandle, "/plane/wings/wing[1]/@position", &text ));
+  EXPECT_EQ(INVALID_HANDLE, tixiGetTextElementView( -1, elementPath, &text ));
+}
+
 TEST_F(GetElementTests, elementNotFound)
 {
   char* text = NULL;
@@ -181,6 +201,27 @@ TEST_F(GetElementTests, getPointElement)
 }
 
 
+TEST_F(GetElementTests, getPointList)
+{
+  double x[4], y[4], z[4];
+  y[3] = -1.0;
+
+  ASSERT_EQ( SUCCESS, tixiGetPointList( documentHandle, "/plane/points/point", x, y, z, 4 ) );
+  EXPECT_TRUE( x[0] == 1.0 && y[0] == 1.2 && z[0] == 1.3 );
+  EXPECT_TRUE( x[2] == 3.1 && y[2] == 3.2 && z[2] == 3.3 );
+  // missing coordinates are not modified
+  EXPECT_TRUE( x[3] == 4.1 && y[3] == -1.0 && z[3] == 4.3 );
+
+  // reading less points than available
+  ASSERT_EQ( SUCCESS, tixiGetPointList( documentHandle, "/plane/points/point", x, y, z, 1 ) );
+  ASSERT_EQ( SUCCESS, tixiGetPointList( documentHandle, "/plane/points/point", NULL, NULL, NULL, 0 ) );
+
+  ASSERT_EQ( INDEX_OUT_OF_RANGE, tixiGetPointList( documentHandle, "/plane/points/point[2]", x, y, z, 2 ) );
+  ASSERT_EQ( ELEMENT_NOT_FOUND, tixiGetPointList( documentHandle, "/plane/points/missing", x, y, z, 1 ) );
+  ASSERT_EQ( NOT_AN_ELEMENT, tixiGetPointList( documentHandle, "/plane/points/point/x/text()", x, y, z, 1 ) );
+  ASSERT_EQ( FAILED, tixiGetPointList( documentHandle, "/plane/points/point", NULL, y, z, 1 ) );
+}
+
 TEST_F(GetElementTests, getMatrixOfPoints)
 {
   int i;
@@ -256,3 +297,68 @@ TEST_F(GetElementTests, GetChildElements)
   ASSERT_STREQ("#comment", string);
 }
 
+
+TEST_F(GetElementTests, GetChildNodeList)
+{
+  int nChilds = 0;
+  char** names = NULL;
+  char** paths = NULL;
+  char** types = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiGetChildNodeList(documentHandle, "/plane/wings/wing[1]", &nChilds, &names, &paths, &types));
+  ASSERT_EQ(2, nChilds);
+  EXPECT_STREQ("centerOfGravity", names[0]);
+  EXPECT_STREQ("#comment", names[1]);
+  EXPECT_STREQ("/plane/wings/wing[1]/centerOfGravity[1]", paths[0]);
+  EXPECT_STREQ("/plane/wings/wing[1]/comment()[1]", paths[1]);
+  EXPECT_STREQ("ELEMENT_NODE", types[0]);
+  EXPECT_STREQ("COMMENT_NODE", types[1]);
+
+  // the generated paths must point to the child nodes
+  for (int i = 0; i < nChilds; ++i) {
+    int count = 0;
+    ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(documentHandle, paths[i], &count));
+    EXPECT_EQ(1, count);
+  }
+
+  // names only
+  ASSERT_EQ(SUCCESS, tixiGetChildNodeList(documentHandle, "/plane/wings", &nChilds, &names, NULL, NULL));
+  ASSERT_EQ(2, nChilds);
+  EXPECT_STREQ("wing", names[0]);
+  EXPECT_STREQ("wing", names[1]);
+
+  ASSERT_EQ(SUCCESS, tixiGetChildNodeList(documentHandle, "/plane/wings", &nChilds, &names, &paths, NULL));
+  EXPECT_STREQ("/plane/wings/wing[1]", paths[0]);
+  EXPECT_STREQ("/plane/wings/wing[2]", paths[1]);
+
+  ASSERT_EQ(SUCCESS, tixiGetChildNodeList(documentHandle, "/plane/wings/wing[1]/centerOfGravity/x", &nChilds, &names, &paths, &types));
+  ASSERT_EQ(1, nChilds);
+  EXPECT_STREQ("#text", names[0]);
+  EXPECT_STREQ("/plane/wings/wing[1]/centerOfGravity/x/text()[1]", paths[0]);
+  EXPECT_STREQ("TEXT_NODE", types[0]);
+
+  ASSERT_EQ(SUCCESS, tixiGetChildNodeList(documentHandle, "/", &nChilds, &names, &paths, NULL));
+  ASSERT_EQ(1, nChilds);
+  EXPECT_STREQ("plane", names[0]);
+  EXPECT_STREQ("/plane[1]", paths[0]);
+
+  EXPECT_EQ(ELEMENT_NOT_FOUND, tixiGetChildNodeList(documentHandle, "/plane/notthere", &nChilds, &names, NULL, NULL));
+  EXPECT_EQ(INVALID_HANDLE, tixiGetChildNodeList(-1, "/plane", &nChilds, &names, NULL, NULL));
+}
+
+TEST_F(GetElementTests, checkElementSteps)
+{
+  TixiPathStep steps[3] = {{"plane", 5, 0}, {"wings", 5, 0}, {"wing", 4, 2}};
+  char* text = NULL;
+
+  EXPECT_EQ(SUCCESS, tixiCheckElementSteps(documentHandle, steps, 3));
+  EXPECT_EQ(SUCCESS, tixiCheckElementSteps(documentHandle, steps, 2));
+  steps[2].index = 0;
+  EXPECT_EQ(ELEMENT_PATH_NOT_UNIQUE, tixiCheckElementSteps(documentHandle, steps, 3));
+
+  // the document node is not an element
+  EXPECT_EQ(INVALID_XPATH, tixiCheckElementSteps(documentHandle, steps, 0));
+  EXPECT_EQ(INVALID_XPATH, tixiCheckElementSteps(documentHandle, steps, -1));
+  EXPECT_EQ(INVALID_XPATH, tixiCheckElementSteps(documentHandle, NULL, 1));
+  EXPECT_EQ(INVALID_XPATH, tixiGetTextElementViewSteps(documentHandle, steps, 0, &text));
+}
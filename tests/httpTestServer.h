@@ -0,0 +1,228 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIXI_HTTPTESTSERVER_H
+#define TIXI_HTTPTESTSERVER_H
+
+#ifndef _WIN32
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Minimal HTTP/1.1 server on localhost serving files from memory.
+ *
+ * It supports keep-alive connections and conditional requests with
+ * If-None-Match, and counts requests and connections.
+ */
+class HttpTestServer
+{
+public:
+  HttpTestServer()
+    : m_stop(false), m_requests(0), m_notModified(0), m_connections(0), m_port(0)
+  {
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    if (bind(m_listenSocket, (sockaddr*) &address, sizeof(address)) != 0 || listen(m_listenSocket, 64) != 0) {
+      close(m_listenSocket);
+      m_listenSocket = -1;
+      return;
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(m_listenSocket, (sockaddr*) &address, &length);
+    m_port = ntohs(address.sin_port);
+    m_thread = std::thread(&HttpTestServer::run, this);
+  }
+
+  ~HttpTestServer()
+  {
+    m_stop = true;
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+    if (m_listenSocket >= 0) {
+      close(m_listenSocket);
+    }
+  }
+
+  bool isRunning() const
+  {
+    return m_listenSocket >= 0;
+  }
+
+  std::string url(const std::string& path = "") const
+  {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/" + path;
+  }
+
+  /// Serves content at path, an empty etag disables conditional requests
+  void setFile(const std::string& path, const std::string& content, const std::string& etag = "")
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files["/" + path] = File{content, etag};
+  }
+
+  int requests() const { return m_requests; }
+  int notModified() const { return m_notModified; }
+  int connections() const { return m_connections; }
+
+private:
+  struct File
+  {
+    std::string content;
+    std::string etag;
+  };
+
+  struct Client
+  {
+    int socket;
+    std::string buffer;
+  };
+
+  void run()
+  {
+    std::vector<Client> clients;
+
+    while (!m_stop) {
+      std::vector<pollfd> fds(1 + clients.size());
+      fds[0].fd = m_listenSocket;
+      fds[0].events = POLLIN;
+      for (size_t i = 0; i < clients.size(); ++i) {
+        fds[i + 1].fd = clients[i].socket;
+        fds[i + 1].events = POLLIN;
+      }
+
+      if (poll(fds.data(), fds.size(), 20) <= 0) {
+        continue;
+      }
+
+      for (size_t i = clients.size(); i > 0; --i) {
+        if (fds[i].revents && !receive(clients[i - 1])) {
+          close(clients[i - 1].socket);
+          clients.erase(clients.begin() + (i - 1));
+        }
+      }
+
+      if (fds[0].revents & POLLIN) {
+        int socket = accept(m_listenSocket, nullptr, nullptr);
+        if (socket >= 0) {
+          clients.push_back(Client{socket, std::string()});
+          m_connections++;
+        }
+      }
+    }
+
+    for (const auto& client : clients) {
+      close(client.socket);
+    }
+  }
+
+  // returns false, if the connection is closed
+  bool receive(Client& client)
+  {
+    char data[4096];
+    ssize_t length = recv(client.socket, data, sizeof(data), 0);
+    if (length <= 0) {
+      return false;
+    }
+    client.buffer.append(data, length);
+
+    size_t end;
+    while ((end = client.buffer.find("\r\n\r\n")) != std::string::npos) {
+      std::string request = client.buffer.substr(0, end + 2);
+      client.buffer.erase(0, end + 4);
+      std::string response = respond(request);
+      if (send(client.socket, response.data(), response.size(), MSG_NOSIGNAL) != (ssize_t) response.size()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static std::string header(const std::string& request, const std::string& name)
+  {
+    size_t pos = 0;
+    while ((pos = request.find("\r\n", pos)) != std::string::npos) {
+      pos += 2;
+      if (strncasecmp(request.c_str() + pos, (name + ":").c_str(), name.size() + 1) == 0) {
+        size_t start = request.find_first_not_of(' ', pos + name.size() + 1);
+        return request.substr(start, request.find("\r\n", start) - start);
+      }
+    }
+    return "";
+  }
+
+  std::string respond(const std::string& request)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_requests++;
+
+    size_t pathStart = request.find(' ') + 1;
+    std::string path = request.substr(pathStart, request.find(' ', pathStart) - pathStart);
+
+    auto it = m_files.find(path);
+    if (request.compare(0, 4, "GET ") != 0 || it == m_files.end()) {
+      return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+    }
+
+    const File& file = it->second;
+    std::string etagHeader;
+    if (!file.etag.empty()) {
+      etagHeader = "ETag: \"" + file.etag + "\"\r\n";
+      if (header(request, "If-None-Match") == "\"" + file.etag + "\"") {
+        m_notModified++;
+        return "HTTP/1.1 304 Not Modified\r\n" + etagHeader + "\r\n";
+      }
+    }
+
+    return "HTTP/1.1 200 OK\r\nContent-Type: text/xml\r\nContent-Length: " + std::to_string(file.content.size()) +
+           "\r\n" + etagHeader + "\r\n" + file.content;
+  }
+
+  std::atomic<bool> m_stop;
+  std::atomic<int> m_requests;
+  std::atomic<int> m_notModified;
+  std::atomic<int> m_connections;
+  std::mutex m_mutex;
+  std::map<std::string, File> m_files;
+  std::thread m_thread;
+  int m_listenSocket;
+  int m_port;
+};
+
+#endif // _WIN32
+
+#endif // TIXI_HTTPTESTSERVER_H
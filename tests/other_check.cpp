@@ -19,6 +19,8 @@
 #include "test.h"
 #include "tixi.h"
 
+#include <cstdio>
+
 
 /**
   @test Tests for helper routines.
@@ -183,6 +185,54 @@ TEST_F(OtherTests, addExternalLink_Errors)
   EXPECT_EQ(OPEN_FAILED, tixiAddExternalLink( outDocumentHandle, parentPath, "TestData", "this_file_does_not_exists.xml", ADDLINK_CREATE_AND_OPEN ));
 }
 
+TEST(OtherTests2, saveSplittedSameNamedIncludes)
+{
+  // three includes of the same name, each written back to its own file
+  const char* included[] = {"splitWing1.xml", "splitWing2.xml", "splitWing3.xml"};
+  for (int i = 0; i < 3; ++i) {
+    TixiDocumentHandle wing = -1;
+    ASSERT_EQ(SUCCESS, tixiCreateDocument("wing", &wing));
+    ASSERT_EQ(SUCCESS, tixiAddIntegerElement(wing, "/wing", "index", i + 1, "%d"));
+    ASSERT_EQ(SUCCESS, tixiSaveCompleteDocument(wing, included[i]));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(wing));
+  }
+
+  TixiDocumentHandle main = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("plane", &main));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(SUCCESS, tixiAddExternalLink(main, "/plane", "", included[i], ADDLINK_CREATE));
+  }
+  ASSERT_EQ(SUCCESS, tixiSaveCompleteDocument(main, "splitMain.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(main));
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentRecursive("splitMain.xml", &main, OPENMODE_RECURSIVE));
+  int count = 0;
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(main, "/plane", "wing", &count));
+  ASSERT_EQ(3, count);
+  ASSERT_EQ(SUCCESS, tixiUpdateIntegerElement(main, "/plane/wing[1]/index", 10, "%d"));
+  ASSERT_EQ(SUCCESS, tixiUpdateIntegerElement(main, "/plane/wing[2]/index", 20, "%d"));
+  ASSERT_EQ(SUCCESS, tixiUpdateIntegerElement(main, "/plane/wing[3]/index", 30, "%d"));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(main, "splitMain.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(main));
+
+  for (int i = 0; i < 3; ++i) {
+    TixiDocumentHandle wing = -1;
+    int index = 0;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(included[i], &wing));
+    EXPECT_EQ(SUCCESS, tixiGetIntegerElement(wing, "/wing/index", &index));
+    EXPECT_EQ(10 * (i + 1), index);
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(wing));
+    remove(included[i]);
+  }
+
+  // the main document only links the included files
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentRecursive("splitMain.xml", &main, OPENMODE_PLAIN));
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(main, "/plane", "externaldata", &count));
+  EXPECT_EQ(3, count);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(main));
+  remove("splitMain.xml");
+}
+
 TEST_F(OtherTests, usePrettyPrint)
 {
   ASSERT_EQ(SUCCESS, tixiUsePrettyPrint(inDocumentHandle, 0));
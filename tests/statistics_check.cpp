@@ -0,0 +1,196 @@
+/*
+* Copyright (C) 2026 German Aerospace Center (DLR/SC)
+*
+* Created: 2026-10-19
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tixi.h"
+
+#include <cstring>
+
+namespace
+{
+
+const TixiFunctionStatistics* findFunction(const TixiStatistics& statistics, const char* name)
+{
+  for (int i = 0; i < statistics.nFunctions; ++i) {
+    if (strcmp(statistics.functions[i].name, name) == 0) {
+      return &statistics.functions[i];
+    }
+  }
+  return NULL;
+}
+
+} // namespace
+
+class StatisticsTests : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+    ASSERT_EQ(SUCCESS, tixiAddTextElement(handle, "/root", "vector", "1;2;3"));
+    ASSERT_EQ(SUCCESS, tixiAddTextElement(handle, "/root", "name", "wing"));
+
+    TixiStatistics statistics;
+    if (tixiGetStatistics(handle, &statistics) == FAILED) {
+      GTEST_SKIP() << "TiXI is built without statistics";
+    }
+  }
+
+  void TearDown()
+  {
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+  }
+
+  TixiDocumentHandle handle = -1;
+};
+
+TEST(StatisticsChecks, invalidArguments)
+{
+  TixiStatistics statistics;
+  ASSERT_EQ(INVALID_HANDLE, tixiGetStatistics(-1, &statistics));
+
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+  ASSERT_EQ(FAILED, tixiGetStatistics(handle, NULL));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+TEST_F(StatisticsTests, functionCalls)
+{
+  for (int i = 0; i < 3; ++i) {
+    int number = 0;
+    ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(handle, "/root/name", &number));
+  }
+
+  TixiStatistics statistics;
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &statistics));
+  const TixiFunctionStatistics* function = findFunction(statistics, "tixiXPathEvaluateNodeNumber");
+  ASSERT_TRUE(function != NULL);
+  EXPECT_GE(function->calls, 3);
+  EXPECT_GE(function->seconds, 0.);
+  EXPECT_TRUE(findFunction(statistics, "tixiCreateDocument") != NULL);
+}
+
+TEST_F(StatisticsTests, xpathCache)
+{
+  TixiStatistics before, after;
+  ASSERT_EQ(SUCCESS, tixiSetCacheEnabled(handle, 1));
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &before));
+
+  for (int i = 0; i < 3; ++i) {
+    int number = 0;
+    ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(handle, "//name", &number));
+  }
+
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &after));
+  EXPECT_EQ(1, after.xpathEvaluations - before.xpathEvaluations);
+  EXPECT_EQ(1, after.xpathCacheMisses - before.xpathCacheMisses);
+  EXPECT_EQ(2, after.xpathCacheHits - before.xpathCacheHits);
+}
+
+TEST_F(StatisticsTests, vectorCache)
+{
+  TixiStatistics before, after;
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &before));
+
+  double* values = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/root/vector", &values, 3));
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/root/vector", &values, 3));
+
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &after));
+  EXPECT_EQ(1, after.vectorCacheMisses - before.vectorCacheMisses);
+  EXPECT_EQ(1, after.vectorCacheHits - before.vectorCacheHits);
+}
+
+TEST_F(StatisticsTests, memoryList)
+{
+  TixiStatistics before, after;
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &before));
+
+  char* text = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/root/name", &text));
+
+  // the function table of the first call is in the memory list as well
+  ASSERT_EQ(SUCCESS, tixiGetStatistics(handle, &after));
+  EXPECT_EQ(2, after.memoryListEntries - before.memoryListEntries);
+  EXPECT_GE(after.memoryListBytes, before.memoryListBytes);
+}
+
+TEST(DocumentStatisticsChecks, nodeCounts)
+{
+  const char* xml =
+      "<?xml version=\"1.0\"?>\n"
+      "<!-- comment -->\n"
+      "<root><a uID=\"a1\" x=\"1\"><b>text</b><![CDATA[cdata]]></a><?pi data?><c uID=\"c1\"/></root>";
+
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiImportFromString(xml, &handle));
+
+  TixiDocumentStatistics statistics;
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &statistics));
+  EXPECT_EQ(4, statistics.elements);
+  EXPECT_EQ(3, statistics.attributes);
+  EXPECT_EQ(1, statistics.textNodes);
+  EXPECT_EQ(1, statistics.cdataNodes);
+  EXPECT_EQ(1, statistics.comments);
+  EXPECT_EQ(1, statistics.processingInstructions);
+  EXPECT_EQ(0, statistics.otherNodes);
+  EXPECT_EQ(3, statistics.maxDepth);
+  EXPECT_EQ(9, statistics.textBytes);
+  EXPECT_EQ(2, statistics.uIDs);
+  EXPECT_EQ(0, statistics.externalIncludes);
+  EXPECT_EQ(0, statistics.memoryListEntries);
+  EXPECT_GT(statistics.estimatedDOMBytes, 10 * 4);
+
+  // the returned text is held in the memory list until the document is closed
+  char* text = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/root/a/b", &text));
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &statistics));
+  EXPECT_EQ(1, statistics.memoryListEntries);
+  EXPECT_GE(statistics.memoryListBytes, 0);
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+TEST(DocumentStatisticsChecks, externalIncludes)
+{
+  TixiDocumentHandle handle = -1;
+  TixiDocumentStatistics statistics;
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/externaldata-main.xml", &handle));
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &statistics));
+  EXPECT_EQ(2, statistics.externalIncludes);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+
+  // only the xml file is included, the text file is skipped
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentRecursive("TestData/externaldata-main.xml", &handle, OPENMODE_RECURSIVE));
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &statistics));
+  EXPECT_EQ(1, statistics.externalIncludes);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+TEST(DocumentStatisticsChecks, invalidArguments)
+{
+  TixiDocumentStatistics statistics;
+  ASSERT_EQ(INVALID_HANDLE, tixiGetDocumentStatistics(-1, &statistics));
+
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+  ASSERT_EQ(FAILED, tixiGetDocumentStatistics(handle, NULL));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
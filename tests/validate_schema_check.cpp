@@ -19,6 +19,13 @@
 #include "test.h" // Brings in the GTest framework
 #include "tixi.h"
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 
 /**
   @test Tests for validating (against) schema files.
@@ -47,6 +54,16 @@ TEST_F(ValidateSchemaTests, tixiValidateSchemaFromFile)
   ASSERT_TRUE( tixiSchemaValidateFromFile( documentHandle, schemaFilename ) == SUCCESS);
 }
 
+TEST_F(ValidateSchemaTests, tixiValidateSchemaFromFile_uri)
+{
+  const char* schemaFilename = "file://TestData/valid_cpacs_schema.xsd";
+  EXPECT_EQ(SUCCESS, tixiSchemaValidateFromFile(documentHandle, schemaFilename));
+
+  // the second validation uses the cached schema of the same file
+  EXPECT_EQ(SUCCESS, tixiSchemaValidateFromFile(documentHandle, "TestData/valid_cpacs_schema.xsd"));
+  EXPECT_EQ(OPEN_SCHEMA_FAILED, tixiSchemaValidateFromFile(documentHandle, "file://TestData/InvaLid_ScheMa_fIleE_nAmE.xsd"));
+}
+
 TEST_F(ValidateSchemaTests, tixiValidateSchemaFromFile_invalid)
 {
   const char* schemaFilename = "TestData/invalid_cpacs_schema.xsd";
@@ -89,3 +106,191 @@ TEST_F(ValidateSchemaTests, tixiValidateSchemaFromString_not_A_Schema)
 
   ASSERT_TRUE( tixiSchemaValidateFromString( documentHandle, schemaString ) == OPEN_SCHEMA_FAILED);
 }
+
+TEST_F(ValidateSchemaTests, tixiSchemaLoad)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  TixiSchemaHandle otherHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/valid_cpacs_schema.xsd", &schemaHandle));
+
+  // validate repeatedly with the compiled schema
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(documentHandle, schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(documentHandle, schemaHandle));
+
+  // an unchanged file is not parsed again
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/valid_cpacs_schema.xsd", &otherHandle));
+  EXPECT_EQ(schemaHandle, otherHandle);
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(otherHandle));
+
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(documentHandle, schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaValidate(documentHandle, schemaHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaFree(schemaHandle));
+}
+
+TEST_F(ValidateSchemaTests, tixiSchemaLoad_notCompliant)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/invalid_cpacs_schema.xsd", &schemaHandle));
+  EXPECT_EQ(NOT_SCHEMA_COMPLIANT, tixiSchemaValidate(documentHandle, schemaHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaValidate(-1, schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+}
+
+TEST_F(ValidateSchemaTests, tixiSchemaLoad_failures)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  EXPECT_EQ(OPEN_SCHEMA_FAILED, tixiSchemaLoad("TestData/InvaLid_ScheMa_fIleE_nAmE.xsd", &schemaHandle));
+  EXPECT_EQ(OPEN_SCHEMA_FAILED, tixiSchemaLoad("TestData/valid_CPACS_dokumentiert.xml_notexisting", &schemaHandle));
+  EXPECT_EQ(FAILED, tixiSchemaLoad("TestData/valid_CPACS_dokumentiert.xml", &schemaHandle));
+  EXPECT_EQ(FAILED, tixiSchemaLoad("TestData/valid_cpacs_schema.xsd", NULL));
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaValidate(documentHandle, 12345));
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaFree(12345));
+}
+
+TEST_F(ValidateSchemaTests, tixiSchemaLoad_modifiedFile)
+{
+  const char* schemaFilename = "schemaCache.xsd";
+  std::stringstream schema;
+  schema << std::ifstream("TestData/valid_cpacs_schema.xsd").rdbuf();
+  std::ofstream(schemaFilename) << schema.str();
+
+  TixiSchemaHandle schemaHandle = -1;
+  TixiSchemaHandle modifiedHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad(schemaFilename, &schemaHandle));
+
+  // the modified file is parsed again, the old handle stays valid
+  std::ofstream(schemaFilename) << schema.str() << "\n<!-- modified -->\n";
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad(schemaFilename, &modifiedHandle));
+  EXPECT_NE(schemaHandle, modifiedHandle);
+
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(documentHandle, schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(documentHandle, modifiedHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(modifiedHandle));
+
+  // validation from file uses the same cache
+  EXPECT_EQ(SUCCESS, tixiSchemaValidateFromFile(documentHandle, schemaFilename));
+}
+
+TEST(ValidateSchemaWhileOpening, tixiOpenDocumentWithSchema)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  TixiDocumentHandle handle = -1;
+  char* text = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/valid_cpacs_schema.xsd", &schemaHandle));
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentWithSchema("TestData/valid_CPACS_dokumentiert.xml", schemaHandle, &handle));
+  ASSERT_EQ(SUCCESS, tixiRegisterNamespace(handle, "http://www.w3.org/1999/xhtml", "x"));
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/x:cpacs/x:header/x:version", &text));
+  EXPECT_STREQ("1", text);
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(handle));
+
+  // the document is the same as opened without validation
+  TixiDocumentHandle plainHandle = -1;
+  char* plainText = NULL;
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentWithSchema("TestData/valid_CPACS_dokumentiert.xml", schemaHandle, &handle));
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/valid_CPACS_dokumentiert.xml", &plainHandle));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(handle, &text));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(plainHandle, &plainText));
+  EXPECT_STREQ(plainText, text);
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(plainHandle));
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(handle));
+
+  EXPECT_EQ(OPEN_FAILED, tixiOpenDocumentWithSchema("TestData/InvaLid_fIleE_nAmE.xml", schemaHandle, &handle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiOpenDocumentWithSchema("TestData/valid_CPACS_dokumentiert.xml", schemaHandle, &handle));
+}
+
+TEST(ValidateSchemaWhileOpening, tixiOpenDocumentWithSchema_invalid)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  TixiDocumentHandle handle = -1;
+
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/invalid_cpacs_schema.xsd", &schemaHandle));
+  EXPECT_EQ(NOT_SCHEMA_COMPLIANT, tixiOpenDocumentWithSchema("TestData/valid_CPACS_dokumentiert.xml", schemaHandle, &handle));
+  EXPECT_EQ(-1, handle);
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+}
+
+TEST(ValidateSchemaWhileOpening, tixiOpenDocumentWithSchema_notWellFormed)
+{
+  TixiSchemaHandle schemaHandle = -1;
+  TixiDocumentHandle handle = -1;
+
+  // a truncated, but so far valid document
+  std::stringstream document;
+  document << std::ifstream("TestData/valid_CPACS_dokumentiert.xml").rdbuf();
+  std::ofstream("truncated_CPACS.xml") << document.str().substr(0, document.str().size() / 2);
+
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad("TestData/valid_cpacs_schema.xsd", &schemaHandle));
+  EXPECT_EQ(NOT_WELL_FORMED, tixiOpenDocumentWithSchema("truncated_CPACS.xml", schemaHandle, &handle));
+  EXPECT_EQ(-1, handle);
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+}
+
+TEST(ValidateSchemaThreads, openAndValidateInParallel)
+{
+  const int nThreads = 4;
+  std::vector<int> errors(nThreads, 0);
+  std::vector<std::thread> threads;
+
+  // documents and the schema cache are shared between the threads
+  for (int i = 0; i < nThreads; ++i) {
+    threads.emplace_back([&errors, i]() {
+      for (int j = 0; j < 5; ++j) {
+        TixiDocumentHandle handle = -1;
+        if (tixiOpenDocument("TestData/valid_CPACS_dokumentiert.xml", &handle) != SUCCESS
+            || tixiSchemaValidateFromFile(handle, "TestData/valid_cpacs_schema.xsd") != SUCCESS
+            || tixiCloseDocument(handle) != SUCCESS) {
+          errors[i]++;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < nThreads; ++i) {
+    EXPECT_EQ(0, errors[i]);
+  }
+}
+
+TEST(ValidateSchemaThreads, freeHandleWhileValidating)
+{
+  const char* schemaFilename = "schemaFree.xsd";
+  std::stringstream schema;
+  schema << std::ifstream("TestData/valid_cpacs_schema.xsd").rdbuf();
+  std::ofstream(schemaFilename) << schema.str();
+
+  // the schema of the first handle is outdated and freed with its last reference
+  TixiSchemaHandle schemaHandle = -1;
+  TixiSchemaHandle modifiedHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad(schemaFilename, &schemaHandle));
+  std::ofstream(schemaFilename) << schema.str() << "\n<!-- modified -->\n";
+  ASSERT_EQ(SUCCESS, tixiSchemaLoad(schemaFilename, &modifiedHandle));
+
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/valid_CPACS_dokumentiert.xml", &handle));
+
+  // a running validation keeps the schema alive
+  int failures = 0;
+  std::thread validator([&]() {
+    for (int i = 0; i < 20; ++i) {
+      ReturnCode error = tixiSchemaValidate(handle, schemaHandle);
+      if (error != SUCCESS && error != INVALID_HANDLE) {
+        failures++;
+      }
+    }
+  });
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(schemaHandle));
+  validator.join();
+
+  EXPECT_EQ(0, failures);
+  EXPECT_EQ(INVALID_HANDLE, tixiSchemaValidate(handle, schemaHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaValidate(handle, modifiedHandle));
+  EXPECT_EQ(SUCCESS, tixiSchemaFree(modifiedHandle));
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(handle));
+  remove(schemaFilename);
+}
@@ -20,6 +20,8 @@
 #include "tixi.h"
 #include "tixiInternal.h"
 
+#include <vector>
+
 
 /**
     @test Tests for vector routines.
@@ -69,6 +71,22 @@ TEST_F(VectorTests, tixiVectorGetTests)
   ASSERT_TRUE ( tixiGetFloatVector(documentHandleGet, "/a/aeroPerformanceMap/cfx", &allPoints, count) == NO_NUMBER );
 }
 
+TEST_F(VectorTests, tixiVectorGetValuesTests)
+{
+  double values[10];
+
+  ASSERT_EQ( SUCCESS, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/cfy", values, 10) );
+  ASSERT_TRUE ( values[0] == 1.0 );
+  ASSERT_TRUE ( values[7] == 8.0 );
+  ASSERT_TRUE ( values[9] == 12.0 );
+
+  ASSERT_EQ( SUCCESS, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/cfy", NULL, 0) );
+  ASSERT_EQ( FAILED, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/cfy", NULL, 1) );
+  ASSERT_EQ( INDEX_OUT_OF_RANGE, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/cfz", values, 3) );
+  ASSERT_EQ( NO_NUMBER, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/cfx", values, 10) );
+  ASSERT_EQ( ELEMENT_NOT_FOUND, tixiGetFloatVectorValues(documentHandleGet, "/a/aeroPerformanceMap/missing", values, 1) );
+}
+
 TEST_F(VectorTests, tixiVectorAddTests)
 {
   int count = 0;
@@ -160,3 +178,255 @@ TEST(Vector, vectorToString)
     free(myvecString);
     delete [] vec;
 }
+
+static const int nBinaryValues = 5000;
+
+class BinaryVectorTests : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    for (int i = 0; i < nBinaryValues; ++i) {
+      values[i] = i * 0.1 - 7.;
+    }
+    ASSERT_EQ(SUCCESS, tixiCreateDocument("a", &handle));
+    ASSERT_EQ(SUCCESS, tixiSetBinaryVectorThreshold(handle, 100));
+  }
+
+  void TearDown()
+  {
+    if (handle != -1) {
+      ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+    }
+    remove("TestData/binaryvector.xml");
+    remove("TestData/binaryvector.xml.bin");
+    remove("binaryvector-copy.xml");
+    remove("binaryvector-copy.xml.bin");
+  }
+
+  static long fileSize(const char* filename)
+  {
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+      return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+  }
+
+  double values[nBinaryValues];
+  TixiDocumentHandle handle = -1;
+};
+
+TEST_F(BinaryVectorTests, storeInMemory)
+{
+  double small[3] = {1., 2., 3.};
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "big", values, nBinaryValues, NULL));
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "small", small, 3, NULL));
+
+  // only the large vector is binary
+  EXPECT_EQ(SUCCESS, tixiCheckAttribute(handle, "/a/big", "binarySize"));
+  EXPECT_EQ(ATTRIBUTE_NOT_FOUND, tixiCheckAttribute(handle, "/a/small", "binarySize"));
+  char* text = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/a/big", &text));
+  EXPECT_STREQ("", text);
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/a/small", &text));
+  EXPECT_STREQ("1;2;3", text);
+
+  int count = 0;
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/big", &count));
+  EXPECT_EQ(nBinaryValues, count);
+
+  double* result = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/big", &result, nBinaryValues));
+  for (int i = 0; i < nBinaryValues; ++i) {
+    ASSERT_EQ(values[i], result[i]);
+  }
+  EXPECT_EQ(INDEX_OUT_OF_RANGE, tixiGetFloatVector(handle, "/a/big", &result, nBinaryValues + 1));
+
+  // updates replace the stored vector
+  values[17] = 42.;
+  ASSERT_EQ(SUCCESS, tixiUpdateFloatVector(handle, "/a/big", values, nBinaryValues - 1, NULL));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/big", &count));
+  EXPECT_EQ(nBinaryValues - 1, count);
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/big", &result, nBinaryValues - 1));
+  EXPECT_EQ(42., result[17]);
+
+  // small updates and text turn the element into text again
+  ASSERT_EQ(SUCCESS, tixiUpdateFloatVector(handle, "/a/big", small, 3, NULL));
+  EXPECT_EQ(ATTRIBUTE_NOT_FOUND, tixiCheckAttribute(handle, "/a/big", "binarySize"));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/big", &count));
+  EXPECT_EQ(3, count);
+
+  ASSERT_EQ(SUCCESS, tixiUpdateFloatVector(handle, "/a/small", values, nBinaryValues, NULL));
+  ASSERT_EQ(SUCCESS, tixiUpdateTextElement(handle, "/a/small", "4;5"));
+  EXPECT_EQ(ATTRIBUTE_NOT_FOUND, tixiCheckAttribute(handle, "/a/small", "binarySize"));
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/small", &result, 2));
+  EXPECT_EQ(5., result[1]);
+}
+
+TEST_F(BinaryVectorTests, saveAndOpen)
+{
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "first", values, nBinaryValues, NULL));
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "second", values + 1000, 1000, NULL));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, "TestData/binaryvector.xml"));
+  EXPECT_EQ(16 + 6000 * (long) sizeof(double), fileSize("TestData/binaryvector.xml.bin"));
+
+  // the document refers to the sidecar file after saving
+  char* text = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetTextAttribute(handle, "/a/second", "binaryFile", &text));
+  EXPECT_STREQ("binaryvector.xml.bin", text);
+  ASSERT_EQ(SUCCESS, tixiGetTextAttribute(handle, "/a/second", "binaryOffset", &text));
+  EXPECT_STREQ("40016", text);
+  double* result = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/second", &result, 1000));
+  EXPECT_EQ(values[1999], result[999]);
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+
+  // the sidecar file is relative to the document
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/binaryvector.xml", &handle));
+  int count = 0;
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/first", &count));
+  EXPECT_EQ(nBinaryValues, count);
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/first", &result, nBinaryValues));
+  for (int i = 0; i < nBinaryValues; ++i) {
+    ASSERT_EQ(values[i], result[i]);
+  }
+
+  // the returned values are a private copy
+  result[0] = 1e10;
+  double* again = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/first", &again, nBinaryValues));
+  EXPECT_EQ(values[0], again[0]);
+
+  // saving under another name copies the vectors into a new sidecar file
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, "binaryvector-copy.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+  remove("TestData/binaryvector.xml.bin");
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("binaryvector-copy.xml", &handle));
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/second", &result, 1000));
+  EXPECT_EQ(values[1000], result[0]);
+  EXPECT_EQ(values[1999], result[999]);
+}
+
+TEST_F(BinaryVectorTests, copyValues)
+{
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "first", values, nBinaryValues, NULL));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, "TestData/binaryvector.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/binaryvector.xml", &handle));
+
+  TixiDocumentStatistics before, after;
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &before));
+
+  // the values are copied into the caller's array, nothing is kept in the document
+  double result[nBinaryValues + 1];
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(SUCCESS, tixiGetFloatVectorValues(handle, "/a/first", result, nBinaryValues));
+  }
+  EXPECT_EQ(values[0], result[0]);
+  EXPECT_EQ(values[nBinaryValues - 1], result[nBinaryValues - 1]);
+  EXPECT_EQ(INDEX_OUT_OF_RANGE, tixiGetFloatVectorValues(handle, "/a/first", result, nBinaryValues + 1));
+
+  ASSERT_EQ(SUCCESS, tixiGetDocumentStatistics(handle, &after));
+  EXPECT_EQ(before.memoryListEntries, after.memoryListEntries);
+}
+
+TEST_F(BinaryVectorTests, missingSidecar)
+{
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "first", values, nBinaryValues, NULL));
+  ASSERT_EQ(SUCCESS, tixiSaveDocument(handle, "TestData/binaryvector.xml"));
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+  remove("TestData/binaryvector.xml.bin");
+
+  ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/binaryvector.xml", &handle));
+  double* result = NULL;
+  EXPECT_EQ(OPEN_FAILED, tixiGetFloatVector(handle, "/a/first", &result, nBinaryValues));
+  int count = 0;
+  EXPECT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/first", &count));
+  EXPECT_EQ(nBinaryValues, count);
+}
+
+TEST_F(BinaryVectorTests, invalidThreshold)
+{
+  EXPECT_EQ(INVALID_HANDLE, tixiSetBinaryVectorThreshold(-1, 100));
+  EXPECT_EQ(FAILED, tixiSetBinaryVectorThreshold(handle, -1));
+  EXPECT_EQ(SUCCESS, tixiSetBinaryVectorThreshold(handle, 0));
+
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/a", "first", values, nBinaryValues, NULL));
+  EXPECT_EQ(ATTRIBUTE_NOT_FOUND, tixiCheckAttribute(handle, "/a/first", "binarySize"));
+}
+
+TEST(VectorCache, invalidation)
+{
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("a", &handle));
+  ASSERT_EQ(SUCCESS, tixiAddTextElement(handle, "/a", "v", "1;2;3"));
+
+  int count = 0;
+  double* values = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/v", &count));
+  EXPECT_EQ(3, count);
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/v", &values, 3));
+  EXPECT_EQ(3., values[2]);
+
+  // the returned array is a copy of the cached values
+  values[2] = 10.;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/v", &values, 3));
+  EXPECT_EQ(3., values[2]);
+
+  ASSERT_EQ(SUCCESS, tixiUpdateTextElement(handle, "/a/v", "4;5;6;7"));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/v", &count));
+  EXPECT_EQ(4, count);
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/v", &values, 4));
+  EXPECT_EQ(7., values[3]);
+
+  double update[2] = {8., 9.};
+  ASSERT_EQ(SUCCESS, tixiUpdateFloatVector(handle, "/a/v", update, 2, NULL));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/v", &count));
+  EXPECT_EQ(2, count);
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/v", &values, 2));
+  EXPECT_EQ(9., values[1]);
+
+  // replaced elements
+  ASSERT_EQ(SUCCESS, tixiRemoveElement(handle, "/a/v"));
+  ASSERT_EQ(SUCCESS, tixiAddTextElement(handle, "/a", "v", "1"));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/v", &count));
+  EXPECT_EQ(1, count);
+
+  // invalid values are reported up to the requested size only
+  ASSERT_EQ(SUCCESS, tixiUpdateTextElement(handle, "/a/v", "1;;2;x;3"));
+  ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/a/v", &count));
+  EXPECT_EQ(4, count);
+  EXPECT_EQ(SUCCESS, tixiGetFloatVector(handle, "/a/v", &values, 2));
+  EXPECT_EQ(NO_NUMBER, tixiGetFloatVector(handle, "/a/v", &values, 3));
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+// The text of a vector is parsed only once
+TEST(VectorCache, repeatedReads)
+{
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+
+  std::vector<double> vec(200000);
+  for (size_t i = 0; i < vec.size(); ++i) {
+    vec[i] = i * 0.5;
+  }
+  ASSERT_EQ(SUCCESS, tixiAddFloatVector(handle, "/root", "myvec", vec.data(), (int) vec.size(), "%g"));
+
+  for (int i = 0; i < 1000; ++i) {
+    int count = 0;
+    ASSERT_EQ(SUCCESS, tixiGetVectorSize(handle, "/root/myvec", &count));
+    ASSERT_EQ((int) vec.size(), count);
+  }
+  double* values = NULL;
+  ASSERT_EQ(SUCCESS, tixiGetFloatVector(handle, "/root/myvec", &values, (int) vec.size()));
+  EXPECT_EQ(vec.back(), values[vec.size() - 1]);
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
@@ -18,6 +18,7 @@
 
 #include "test.h"
 #include "webMethods.h"
+#include "httpCache.h"
 
 TEST(WebMethods, curlGetFileToLocalDisk)
 {
@@ -55,3 +56,498 @@ TEST(WebMethods, myrealloc)
   free(b);
 }
 
+
+#ifndef _WIN32
+
+#include "tixi.h"
+#include "fileCache.h"
+#include "httpTestServer.h"
+
+#include <dirent.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void removeDirectory(const std::string& directory)
+{
+  DIR* dir = opendir(directory.c_str());
+  if (dir) {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+      std::string name = entry->d_name;
+      if (name != "." && name != "..") {
+        remove((directory + "/" + name).c_str());
+      }
+    }
+    closedir(dir);
+  }
+  rmdir(directory.c_str());
+}
+
+static int countFiles(const std::string& directory, const std::string& extension)
+{
+  int count = 0;
+  DIR* dir = opendir(directory.c_str());
+  if (dir) {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+      std::string name = entry->d_name;
+      if (name.size() > extension.size() && name.compare(name.size() - extension.size(), extension.size(), extension) == 0) {
+        count++;
+      }
+    }
+    closedir(dir);
+  }
+  return count;
+}
+
+class WebMethodsLocalServer : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    ASSERT_TRUE(server.isRunning());
+    for (int i = 0; i < 6; ++i) {
+      server.setFile("file" + std::to_string(i) + ".xml", "<file index=\"" + std::to_string(i) + "\"/>", "v" + std::to_string(i));
+    }
+  }
+
+  void TearDown()
+  {
+    tixiSetHTTPCacheDirectory(NULL);
+    tixiSetHTTPCacheLimits(0, 0);
+    removeDirectory("httpcache");
+  }
+
+  HttpTestServer server;
+};
+
+TEST_F(WebMethodsLocalServer, getURLInMemory)
+{
+  char* text = curlGetURLInMemory(server.url("file1.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  EXPECT_STREQ("<file index=\"1\"/>", text);
+  free(text);
+
+  EXPECT_EQ(NULL, curlGetURLInMemory(server.url("missing.xml").c_str()));
+}
+
+TEST_F(WebMethodsLocalServer, getFileToLocalDisk)
+{
+  ASSERT_EQ(0, curlGetFileToLocalDisk(server.url("file2.xml").c_str(), "download.xml"));
+  std::ifstream file("download.xml");
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  EXPECT_EQ("<file index=\"2\"/>", content);
+  remove("download.xml");
+
+  EXPECT_LT(curlGetFileToLocalDisk(server.url("missing.xml").c_str(), "download.xml"), 0);
+  remove("download.xml");
+}
+
+TEST_F(WebMethodsLocalServer, connectionReuse)
+{
+  std::vector<std::string> urls;
+  std::vector<const char*> urlPtrs;
+  for (int i = 0; i < 6; ++i) {
+    urls.push_back(server.url("file" + std::to_string(i) + ".xml"));
+  }
+  for (const auto& url : urls) {
+    urlPtrs.push_back(url.c_str());
+  }
+
+  // parallel downloads
+  std::vector<char*> contents(urls.size());
+  curlGetURLsInMemory((int) urls.size(), urlPtrs.data(), contents.data());
+  for (size_t i = 0; i < urls.size(); ++i) {
+    ASSERT_TRUE(contents[i] != NULL);
+    EXPECT_EQ("<file index=\"" + std::to_string(i) + "\"/>", std::string(contents[i]));
+    free(contents[i]);
+  }
+  EXPECT_EQ(6, server.requests());
+  int connections = server.connections();
+  EXPECT_GE(connections, 1);
+
+  // later downloads reuse the open connections
+  for (const auto& url : urls) {
+    char* text = curlGetURLInMemory(url.c_str());
+    ASSERT_TRUE(text != NULL);
+    free(text);
+  }
+  EXPECT_EQ(12, server.requests());
+  EXPECT_EQ(connections, server.connections());
+}
+
+TEST_F(WebMethodsLocalServer, parallelThreads)
+{
+  // each thread runs its own transfers, the connections are shared
+  std::vector<std::thread> threads;
+  std::vector<int> failures(4, 0);
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([this, t, &failures]() {
+      for (int i = 0; i < 12; ++i) {
+        int index = (t + i) % 6;
+        char* text = curlGetURLInMemory(server.url("file" + std::to_string(index) + ".xml").c_str());
+        if (!text || std::string(text) != "<file index=\"" + std::to_string(index) + "\"/>") {
+          failures[t]++;
+        }
+        free(text);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < 4; ++t) {
+    EXPECT_EQ(0, failures[t]);
+  }
+  EXPECT_EQ(48, server.requests());
+  EXPECT_LE(server.connections(), 4 * 8);
+}
+
+TEST_F(WebMethodsLocalServer, conditionalRequests)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+
+  char* text = curlGetURLInMemory(server.url("file3.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  free(text);
+  EXPECT_EQ(0, server.notModified());
+
+  // unchanged, served from the cache
+  text = curlGetURLInMemory(server.url("file3.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  EXPECT_STREQ("<file index=\"3\"/>", text);
+  free(text);
+  EXPECT_EQ(2, server.requests());
+  EXPECT_EQ(1, server.notModified());
+
+  // modified on the server
+  server.setFile("file3.xml", "<modified/>", "v3b");
+  text = curlGetURLInMemory(server.url("file3.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  EXPECT_STREQ("<modified/>", text);
+  free(text);
+  EXPECT_EQ(1, server.notModified());
+
+  // without etag, nothing is cached
+  server.setFile("noetag.xml", "<noetag/>");
+  for (int i = 0; i < 2; ++i) {
+    text = curlGetURLInMemory(server.url("noetag.xml").c_str());
+    ASSERT_TRUE(text != NULL);
+    EXPECT_STREQ("<noetag/>", text);
+    free(text);
+  }
+  EXPECT_EQ(1, server.notModified());
+
+  // disabled cache
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory(NULL));
+  text = curlGetURLInMemory(server.url("file3.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  free(text);
+  EXPECT_EQ(1, server.notModified());
+}
+
+static void storeInHTTPCache(const char* url, const std::string& body)
+{
+  HttpCacheWriter* writer = httpCacheBeginStore();
+  ASSERT_TRUE(writer != NULL);
+  httpCacheWrite(writer, body.c_str(), body.size());
+  httpCacheEndStore(writer, url, "v1", NULL);
+}
+
+static std::string readFromHTTPCache(const char* url)
+{
+  HttpCacheEntry entry;
+  std::string body;
+  if (httpCacheLookup(url, &entry)) {
+    char* text = httpCacheRead(url, &entry, 0);
+    body = text ? text : "";
+    free(text);
+    httpCacheFreeEntry(&entry);
+  }
+  return body;
+}
+
+TEST(HttpCache, differentBodiesWithSameHash)
+{
+  const std::string body = "<a/>";
+  ASSERT_EQ(SUCCESS, httpCacheSetDirectory("httpcache"));
+
+  // a different body of the same size already stored under the hash of body
+  unsigned long long hash = 14695981039346656037ULL;
+  for (char c : body) {
+    hash = (hash ^ (unsigned char) c) * 1099511628211ULL;
+  }
+  char dataName[64];
+  snprintf(dataName, sizeof(dataName), "httpcache/%016llx-%llx.data", hash, (unsigned long long) body.size());
+  std::ofstream(dataName, std::ios::binary) << "<b/>";
+
+  storeInHTTPCache("http://localhost/a.xml", body);
+  EXPECT_EQ(body, readFromHTTPCache("http://localhost/a.xml"));
+  EXPECT_EQ(2, countFiles("httpcache", ".data"));
+
+  // identical bodies are still stored once
+  storeInHTTPCache("http://localhost/a2.xml", body);
+  EXPECT_EQ(body, readFromHTTPCache("http://localhost/a2.xml"));
+  EXPECT_EQ(2, countFiles("httpcache", ".data"));
+
+  httpCacheCleanup();
+  removeDirectory("httpcache");
+}
+
+TEST_F(WebMethodsLocalServer, openDocumentFromHTTPCached)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+
+  for (int i = 0; i < 2; ++i) {
+    TixiDocumentHandle handle = -1;
+    int index = 0;
+    ASSERT_EQ(SUCCESS, tixiOpenDocumentFromHTTP(server.url("file4.xml").c_str(), &handle));
+    ASSERT_EQ(SUCCESS, tixiGetIntegerAttribute(handle, "/file", "index", &index));
+    EXPECT_EQ(4, index);
+    tixiCloseDocument(handle);
+  }
+  EXPECT_EQ(2, server.requests());
+  EXPECT_EQ(1, server.notModified());
+}
+
+TEST_F(WebMethodsLocalServer, openDocumentFromHTTPStreamed)
+{
+  // large enough to arrive in many chunks
+  std::string xml = "<?xml version=\"1.0\"?>\n<root>\n";
+  for (int i = 0; i < 20000; ++i) {
+    xml += "  <value index=\"" + std::to_string(i) + "\">" + std::to_string(0.5 * i) + "</value>\n";
+  }
+  xml += "</root>\n";
+  server.setFile("large.xml", xml, "large");
+
+  TixiDocumentHandle handle = -1;
+  TixiDocumentHandle importHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiOpenDocumentFromHTTP(server.url("large.xml").c_str(), &handle));
+  ASSERT_EQ(SUCCESS, tixiImportFromString(xml.c_str(), &importHandle));
+
+  int count = 0;
+  double value = 0.;
+  ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root", "value", &count));
+  EXPECT_EQ(20000, count);
+  ASSERT_EQ(SUCCESS, tixiGetDoubleElement(handle, "/root/value[20000]", &value));
+  EXPECT_DOUBLE_EQ(9999.5, value);
+
+  // same result as parsing the string
+  char* text = NULL;
+  char* importText = NULL;
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(handle, &text));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(importHandle, &importText));
+  EXPECT_STREQ(importText, text);
+
+  tixiCloseDocument(handle);
+  tixiCloseDocument(importHandle);
+}
+
+TEST_F(WebMethodsLocalServer, openDocumentFromHTTPErrors)
+{
+  TixiDocumentHandle handle = -1;
+  server.setFile("illformed.xml", "<root><a></root>");
+  server.setFile("empty.xml", "");
+
+  EXPECT_EQ(NOT_WELL_FORMED, tixiOpenDocumentFromHTTP(server.url("illformed.xml").c_str(), &handle));
+  EXPECT_EQ(NOT_WELL_FORMED, tixiOpenDocumentFromHTTP(server.url("empty.xml").c_str(), &handle));
+  EXPECT_EQ(OPEN_FAILED, tixiOpenDocumentFromHTTP(server.url("missing.xml").c_str(), &handle));
+}
+
+TEST_F(WebMethodsLocalServer, getURLsAsDocuments)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+  server.setFile("illformed.xml", "<root><a></root>", "i");
+
+  const char* paths[] = {"file0.xml", "illformed.xml", "missing.xml", "file1.xml"};
+  const ReturnCode expected[] = {SUCCESS, NOT_WELL_FORMED, OPEN_FAILED, SUCCESS};
+  std::vector<std::string> urls;
+  std::vector<const char*> urlPtrs;
+  for (const char* path : paths) {
+    urls.push_back(server.url(path));
+  }
+  for (const auto& url : urls) {
+    urlPtrs.push_back(url.c_str());
+  }
+
+  // the second run parses the cached files
+  for (int run = 0; run < 2; ++run) {
+    xmlDocPtr documents[4];
+    ReturnCode errors[4];
+    curlGetURLsAsDocuments(4, urlPtrs.data(), XML_PARSE_HUGE, documents, errors);
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_EQ(expected[i], errors[i]);
+      EXPECT_EQ(expected[i] == SUCCESS, documents[i] != NULL);
+      if (documents[i]) {
+        EXPECT_STREQ("file", (const char*) xmlDocGetRootElement(documents[i])->name);
+        EXPECT_STREQ(urls[i].c_str(), (const char*) documents[i]->URL);
+        xmlFreeDoc(documents[i]);
+      }
+    }
+  }
+  EXPECT_EQ(3, server.notModified());
+}
+
+TEST_F(WebMethodsLocalServer, cacheMaxAge)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheLimits(0, 3600));
+
+  for (int i = 0; i < 3; ++i) {
+    char* text = curlGetURLInMemory(server.url("file5.xml").c_str());
+    ASSERT_TRUE(text != NULL);
+    EXPECT_STREQ("<file index=\"5\"/>", text);
+    free(text);
+  }
+  // only the first download asks the server
+  EXPECT_EQ(1, server.requests());
+
+  // changes are seen after revalidation only
+  server.setFile("file5.xml", "<modified/>", "v5b");
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheLimits(0, 0));
+  char* text = curlGetURLInMemory(server.url("file5.xml").c_str());
+  ASSERT_TRUE(text != NULL);
+  EXPECT_STREQ("<modified/>", text);
+  free(text);
+  EXPECT_EQ(2, server.requests());
+
+  EXPECT_EQ(FAILED, tixiSetHTTPCacheLimits(-1, 0));
+  EXPECT_EQ(FAILED, tixiSetHTTPCacheLimits(0, -1));
+}
+
+TEST_F(WebMethodsLocalServer, cacheContentAddressed)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+
+  server.setFile("copy1.xml", "<copy/>", "a");
+  server.setFile("copy2.xml", "<copy/>", "b");
+  for (const char* path : {"copy1.xml", "copy2.xml"}) {
+    char* text = curlGetURLInMemory(server.url(path).c_str());
+    ASSERT_TRUE(text != NULL);
+    free(text);
+  }
+
+  // one entry per url, but the identical content is stored once
+  EXPECT_EQ(2, countFiles("httpcache", ".meta"));
+  EXPECT_EQ(1, countFiles("httpcache", ".data"));
+}
+
+TEST_F(WebMethodsLocalServer, cacheEviction)
+{
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheLimits(1, 3600));
+
+  const std::string paths[] = {"a.xml", "b.xml", "c.xml"};
+  for (const auto& path : paths) {
+    server.setFile(path, "<large>" + std::string(400 * 1024, path[0]) + "</large>", path);
+  }
+
+  auto fetch = [this](const std::string& path) {
+    char* text = curlGetURLInMemory(server.url(path).c_str());
+    ASSERT_TRUE(text != NULL);
+    EXPECT_EQ(path[0], text[7]);
+    free(text);
+  };
+
+  fetch("a.xml");
+  fetch("b.xml");
+  fetch("a.xml");
+  EXPECT_EQ(2, server.requests());
+  EXPECT_EQ(2, countFiles("httpcache", ".data"));
+
+  // exceeds the limit, b.xml is the least recently used document
+  fetch("c.xml");
+  EXPECT_EQ(3, server.requests());
+  EXPECT_EQ(2, countFiles("httpcache", ".data"));
+  EXPECT_EQ(2, countFiles("httpcache", ".meta"));
+
+  fetch("a.xml");
+  fetch("c.xml");
+  EXPECT_EQ(3, server.requests());
+  fetch("b.xml");
+  EXPECT_EQ(4, server.requests());
+}
+
+TEST_F(WebMethodsLocalServer, remoteExternalData)
+{
+  const char* filename = "externaldata-http.xml";
+  {
+    std::ofstream file(filename);
+    file << "<?xml version=\"1.0\"?>\n<root>\n";
+    for (int i = 0; i < 4; ++i) {
+      file << "<externaldata><path>" << server.url() << "</path><filename>file" << i << ".xml</filename></externaldata>\n";
+    }
+    file << "</root>\n";
+  }
+
+  ASSERT_EQ(SUCCESS, tixiSetHTTPCacheDirectory("httpcache"));
+
+  for (int run = 0; run < 2; ++run) {
+    TixiDocumentHandle handle = -1;
+    int count = 0;
+    ASSERT_EQ(SUCCESS, tixiOpenDocumentRecursive(filename, &handle, OPENMODE_RECURSIVE));
+    ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(handle, "/root", "file", &count));
+    EXPECT_EQ(4, count);
+    EXPECT_EQ(SUCCESS, tixiCheckElement(handle, "/root/file[@index=\"3\"]"));
+    tixiCloseDocument(handle);
+  }
+
+  // one request per file and run, the second run is served from the cache
+  EXPECT_EQ(8, server.requests());
+  EXPECT_EQ(4, server.notModified());
+  EXPECT_LE(server.connections(), 4);
+
+  remove(filename);
+}
+
+static int loadedDocuments = 0;
+
+static ReturnCode loadRemoteDocument(const char* filename, void** data)
+{
+  char* text = curlGetURLInMemory(filename);
+  if (!text) {
+    return OPEN_FAILED;
+  }
+  xmlDocPtr document = xmlReadMemory(text, (int) strlen(text), filename, NULL, 0);
+  free(text);
+  if (!document) {
+    return OPEN_FAILED;
+  }
+  loadedDocuments++;
+  *data = document;
+  return SUCCESS;
+}
+
+static void freeRemoteDocument(void* data)
+{
+  xmlFreeDoc((xmlDocPtr) data);
+  loadedDocuments--;
+}
+
+TEST_F(WebMethodsLocalServer, fileCacheRemoteURIs)
+{
+  FileCache cache = FILE_CACHE_INIT(loadRemoteDocument, freeRemoteDocument);
+
+  // remote files are loaded on each call and freed as soon as they are released
+  for (int i = 0; i < 5; ++i) {
+    int handle = -1;
+    void* data = NULL;
+    ASSERT_EQ(SUCCESS, fileCacheLoad(&cache, server.url("file1.xml").c_str(), &handle, &data));
+    EXPECT_EQ(1, loadedDocuments);
+    EXPECT_TRUE(fileCacheAcquire(&cache, handle) == data);
+    EXPECT_EQ(SUCCESS, fileCacheRelease(&cache, handle));
+    EXPECT_EQ(1, loadedDocuments);
+    EXPECT_EQ(SUCCESS, fileCacheRelease(&cache, handle));
+    EXPECT_EQ(0, loadedDocuments);
+    EXPECT_TRUE(cache.head == NULL);
+  }
+  EXPECT_EQ(5, server.requests());
+}
+
+#endif // _WIN32
@@ -22,6 +22,9 @@
 #include "tixiInternal.h"
 #include "xpathFunctions.h"
 
+#include <string>
+#include <cstring>
+
 
 static const char* xPathXmlFilename = "TestData/xpathsEvaluate.xml";
 
@@ -189,6 +192,21 @@ TEST_F(XPathChecks, generateXPathFromNodePtr_invalidNode)
   ASSERT_STREQ("", xpath);
 }
 
+TEST_F(XPathChecks, generateXPathFromNodePtr_siblings)
+{
+  xmlNodePtr node = getParentNodeToXPath(documentHandle, "/root/a[2]/b[1]/text()");
+  ASSERT_TRUE(node != NULL);
+
+  char* xpath = generateXPathFromNodePtr(documentHandle, node);
+  ASSERT_STREQ("/root/a[@uID=\"schlumpf\"]/b[1]", xpath);
+
+  node = getParentNodeToXPath(documentHandle, "/root/ugly_elem/another_element/@my_attr");
+  ASSERT_TRUE(node != NULL);
+
+  xpath = generateXPathFromNodePtr(documentHandle, node);
+  ASSERT_STREQ("/root/ugly_elem/another_element", xpath);
+}
+
 TEST_F(XPathChecks, xPathExpressionGetElementPath)
 {
   char* xpath = NULL;
@@ -229,6 +247,159 @@ TEST_F(XPathChecks, tixiXPathExpressionGetXPath)
   ASSERT_EQ(INVALID_HANDLE, tixiXPathExpressionGetXPath(-1, "//a", 1, &xpath));
 }
 
+TEST_F(XPathChecks, tixiXPathEvaluateAll_paths)
+{
+  TixiXPathResult result;
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "//b", XPATHRESULT_PATHS, &result));
+  ASSERT_EQ(5, result.number);
+  EXPECT_STREQ("/root/a[@uID=\"test\"]/b[@uID=\"a\"]", result.paths[0]);
+  EXPECT_STREQ("/root/a[@uID=\"test\"]/b[@uID=\"b\"]", result.paths[1]);
+  EXPECT_STREQ("/root/a[@uID=\"schlumpf\"]/b[1]", result.paths[2]);
+  EXPECT_STREQ("/root/a[@uID=\"schlumpf\"]/b[@uID=\"a\"]", result.paths[3]);
+  EXPECT_STREQ("/root/a[@uID=\"schlumpf\"]/b[@uID=\"empty_element\"]", result.paths[4]);
+
+  // the generated paths must point back to the nodes
+  for (int i = 0; i < result.number; ++i) {
+    EXPECT_EQ(SUCCESS, tixiCheckElement(documentHandle, result.paths[i]));
+  }
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "/root/ugly_elem/@*", XPATHRESULT_PATHS, &result));
+  ASSERT_EQ(2, result.number);
+  EXPECT_STREQ("/root/ugly_elem/@some_attr", result.paths[0]);
+  EXPECT_STREQ("/root/ugly_elem/@some_other_attr", result.paths[1]);
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "//c", XPATHRESULT_PATHS, &result));
+  EXPECT_EQ(0, result.number);
+
+  EXPECT_EQ(INVALID_XPATH, tixiXPathEvaluateAll(documentHandle, "count(//b)", XPATHRESULT_PATHS, &result));
+  EXPECT_EQ(INVALID_HANDLE, tixiXPathEvaluateAll(-1, "//b", XPATHRESULT_PATHS, &result));
+}
+
+TEST_F(XPathChecks, tixiXPathEvaluateAll)
+{
+  TixiXPathResult result;
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "//@uID", XPATHRESULT_ALL, &result));
+  ASSERT_EQ(6, result.number);
+  ASSERT_TRUE(result.texts != NULL);
+  ASSERT_TRUE(result.paths != NULL);
+  ASSERT_TRUE(result.nodeTypes != NULL);
+
+  EXPECT_STREQ("test", result.texts[0]);
+  EXPECT_STREQ("/root/a[@uID=\"test\"]/@uID", result.paths[0]);
+  EXPECT_STREQ("empty_element", result.texts[5]);
+  EXPECT_STREQ("/root/a[@uID=\"schlumpf\"]/b[@uID=\"empty_element\"]/@uID", result.paths[5]);
+
+  // consistent with the single item functions
+  for (int i = 0; i < result.number; ++i) {
+    char* text = NULL;
+    ASSERT_EQ(SUCCESS, tixiXPathExpressionGetTextByIndex(documentHandle, "//@uID", i + 1, &text));
+    EXPECT_STREQ(text, result.texts[i]);
+    EXPECT_STREQ("ATTRIBUTE_NODE", result.nodeTypes[i]);
+    EXPECT_EQ(SUCCESS, tixiCheckAttribute(documentHandle, std::string(result.paths[i]).substr(0, strlen(result.paths[i]) - 5).c_str(), "uID"));
+  }
+
+  // only the requested arrays are filled
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "//a", XPATHRESULT_NODETYPES, &result));
+  ASSERT_EQ(2, result.number);
+  EXPECT_TRUE(result.texts == NULL);
+  EXPECT_TRUE(result.paths == NULL);
+  EXPECT_STREQ("ELEMENT_NODE", result.nodeTypes[1]);
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "//c", XPATHRESULT_ALL, &result));
+  EXPECT_EQ(0, result.number);
+
+  EXPECT_EQ(INVALID_XPATH, tixiXPathEvaluateAll(documentHandle, "count(//b)", XPATHRESULT_ALL, &result));
+  EXPECT_EQ(INVALID_HANDLE, tixiXPathEvaluateAll(-1, "//b", XPATHRESULT_ALL, &result));
+  EXPECT_EQ(FAILED, tixiXPathEvaluateAll(documentHandle, "//b", XPATHRESULT_ALL, NULL));
+}
+
+TEST_F(XPathChecks, tixiXPathEvaluateAll_nodeTypes)
+{
+  TixiXPathResult result;
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "/root/ugly_elem/node()", XPATHRESULT_ALL, &result));
+  ASSERT_EQ(6, result.number);
+
+  const char* paths[] = {
+    "/root/ugly_elem/comment()[1]", "/root/ugly_elem/text()[1]", "/root/ugly_elem/another_element",
+    "/root/ugly_elem/text()[2]", "/root/ugly_elem/comment()[2]", "/root/ugly_elem/text()[3]"
+  };
+  const char* types[] = {"COMMENT_NODE", "TEXT_NODE", "ELEMENT_NODE", "TEXT_NODE", "COMMENT_NODE", "TEXT_NODE"};
+  for (int i = 0; i < result.number; ++i) {
+    EXPECT_STREQ(paths[i], result.paths[i]);
+    EXPECT_STREQ(types[i], result.nodeTypes[i]);
+  }
+
+  EXPECT_STREQ(" some comment ", result.texts[0]);
+  EXPECT_STREQ("\n    some text\n    ", result.texts[1]);
+  EXPECT_TRUE(result.texts[2] == NULL);
+
+  // the text of an element is the text of its direct text children
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(documentHandle, "/root/a[2]/b", XPATHRESULT_TEXTS, &result));
+  ASSERT_EQ(3, result.number);
+  EXPECT_STREQ("No UID", result.texts[0]);
+  EXPECT_STREQ("Bla", result.texts[1]);
+  EXPECT_TRUE(result.texts[2] == NULL);
+}
+
+TEST(XPathChecks2, tixiXPathEvaluateAll_escapedTexts)
+{
+  const char* xml = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                    "<root><a>fish &amp; chips</a><a>x &lt; y<![CDATA[ & ]]>\xc3\xa4</a><a b=\"1 &amp; 2\"/></root>";
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiImportFromString(xml, &handle));
+
+  // element texts are escaped like in tixiXPathExpressionGetTextByIndex
+  TixiXPathResult result;
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(handle, "/root/a", XPATHRESULT_TEXTS, &result));
+  ASSERT_EQ(3, result.number);
+  EXPECT_STREQ("fish &amp; chips", result.texts[0]);
+  EXPECT_TRUE(result.texts[2] == NULL);
+  for (int i = 0; i < 2; ++i) {
+    char* text = NULL;
+    ASSERT_EQ(SUCCESS, tixiXPathExpressionGetTextByIndex(handle, "/root/a", i + 1, &text));
+    EXPECT_STREQ(text, result.texts[i]);
+  }
+
+  // attribute values are returned as they are
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(handle, "//@b", XPATHRESULT_TEXTS, &result));
+  ASSERT_EQ(1, result.number);
+  EXPECT_STREQ("1 & 2", result.texts[0]);
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
+TEST(XPathChecks2, tixiXPathEvaluateAll_manySiblings)
+{
+  TixiDocumentHandle handle = -1;
+  ASSERT_EQ(SUCCESS, tixiCreateDocument("root", &handle));
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_EQ(SUCCESS, tixiCreateElement(handle, "/root", i % 2 ? "a" : "b"));
+  }
+  ASSERT_EQ(SUCCESS, tixiCreateElement(handle, "/root", "c"));
+
+  TixiXPathResult result;
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(handle, "/root/*", XPATHRESULT_PATHS, &result));
+  ASSERT_EQ(201, result.number);
+  EXPECT_STREQ("/root/b[1]", result.paths[0]);
+  EXPECT_STREQ("/root/a[1]", result.paths[1]);
+  EXPECT_STREQ("/root/a[100]", result.paths[199]);
+  EXPECT_STREQ("/root/c", result.paths[200]);
+
+  // the positions follow changes of the document
+  ASSERT_EQ(SUCCESS, tixiCreateElement(handle, "/root", "c"));
+  ASSERT_EQ(SUCCESS, tixiRemoveElement(handle, "/root/a[1]"));
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateAll(handle, "/root/a[99] | /root/c", XPATHRESULT_PATHS, &result));
+  ASSERT_EQ(3, result.number);
+  EXPECT_STREQ("/root/a[99]", result.paths[0]);
+  EXPECT_STREQ("/root/c[1]", result.paths[1]);
+  EXPECT_STREQ("/root/c[2]", result.paths[2]);
+
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+}
+
 // get attribute text
 TEST_F(XPathChecks, tixiXPathExpressionGetTextByIndex_attributes)
 {
@@ -328,3 +499,60 @@ TEST_F(XPathChecks, tixiXPathExpressionGetTextByIndex_nontext_element)
   ASSERT_EQ(FAILED, tixiXPathExpressionGetTextByIndex(documentHandle, "/root/ugly_elem/another_element", 1, &text));
   ASSERT_EQ(NULL, text);
 }
+
+TEST_F(XPathChecks, tixiGetXPathProfile)
+{
+  int number = 0;
+  int nExpressions = 0;
+  TixiXPathProfileEntry* entries = NULL;
+
+  ASSERT_EQ(FAILED, tixiGetXPathProfile(documentHandle, &nExpressions, &entries));
+  ASSERT_EQ(SUCCESS, tixiSetXPathProfiling(documentHandle, 1));
+
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(documentHandle, "//b", &number));
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(documentHandle, "//b", &number));
+  int nodes = number;
+  ASSERT_EQ(SUCCESS, tixiXPathEvaluateNodeNumber(documentHandle, "//a[@uID=\"test\"]", &number));
+  ASSERT_EQ(SUCCESS, tixiCheckElement(documentHandle, elementPathExists));
+
+  ASSERT_EQ(SUCCESS, tixiGetXPathProfile(documentHandle, &nExpressions, &entries));
+  ASSERT_EQ(3, nExpressions);
+  for (int i = 1; i < nExpressions; ++i) {
+    EXPECT_GE(entries[i-1].seconds, entries[i].seconds);
+  }
+
+  int found = 0;
+  for (int i = 0; i < nExpressions; ++i) {
+    if (std::string(entries[i].expression) == "//b") {
+      EXPECT_EQ(2, entries[i].evaluations);
+      EXPECT_EQ(nodes, entries[i].nodes);
+      found++;
+    }
+    else if (std::string(entries[i].expression) == elementPathExists) {
+      EXPECT_EQ(1, entries[i].evaluations);
+      EXPECT_EQ(1, entries[i].nodes);
+      found++;
+    }
+  }
+  EXPECT_EQ(2, found);
+
+  // enabling again discards the recorded expressions
+  ASSERT_EQ(SUCCESS, tixiSetXPathProfiling(documentHandle, 1));
+  ASSERT_EQ(SUCCESS, tixiGetXPathProfile(documentHandle, &nExpressions, &entries));
+  ASSERT_EQ(0, nExpressions);
+
+  ASSERT_EQ(SUCCESS, tixiSetXPathProfiling(documentHandle, 0));
+  ASSERT_EQ(FAILED, tixiGetXPathProfile(documentHandle, &nExpressions, &entries));
+}
+
+TEST_F(XPathChecks, tixiGetXPathProfile_invalidArguments)
+{
+  int nExpressions = 0;
+  TixiXPathProfileEntry* entries = NULL;
+
+  ASSERT_EQ(INVALID_HANDLE, tixiSetXPathProfiling(-1, 1));
+  ASSERT_EQ(INVALID_HANDLE, tixiGetXPathProfile(-1, &nExpressions, &entries));
+  ASSERT_EQ(SUCCESS, tixiSetXPathProfiling(documentHandle, 1));
+  ASSERT_EQ(FAILED, tixiGetXPathProfile(documentHandle, NULL, &entries));
+  ASSERT_EQ(FAILED, tixiGetXPathProfile(documentHandle, &nExpressions, NULL));
+}
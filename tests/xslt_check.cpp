@@ -20,6 +20,10 @@
 
 #include "tixi.h"
 
+#include <cstring>
+#include <string>
+#include <vector>
+
 static const char* xmlFilename = "TestData/valid_CPACS_dokumentiert.xml";
 static const char* stylesheetFilename = "TestData/mappingInputRaw.xsl";
 static const char* resultFileName = "TestData/result.xml";
@@ -82,3 +86,200 @@ TEST_F(XsltChecks, xslTransformationToFile_invalidOutfile)
   ASSERT_EQ(FAILED, ret);
 }
 
+
+TEST_F(XsltChecks, stylesheetHandle)
+{
+  TixiStylesheetHandle styleHandle = -1;
+  TixiStylesheetHandle otherHandle = -1;
+  char* fromHandle = NULL;
+  char* fromFile = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiStylesheetLoad(stylesheetFilename, &styleHandle));
+  ASSERT_EQ(SUCCESS, tixiStylesheetTransformToString(documentHandle, styleHandle, &fromHandle));
+  ASSERT_EQ(SUCCESS, tixiXSLTransformationToString(documentHandle, stylesheetFilename, &fromFile));
+  ASSERT_TRUE(fromHandle != NULL);
+  EXPECT_STREQ(fromFile, fromHandle);
+
+  // the same unmodified file returns the cached stylesheet
+  ASSERT_EQ(SUCCESS, tixiStylesheetLoad(stylesheetFilename, &otherHandle));
+  EXPECT_EQ(styleHandle, otherHandle);
+
+  EXPECT_EQ(SUCCESS, tixiStylesheetTransformToFile(documentHandle, styleHandle, resultFileName));
+
+  EXPECT_EQ(SUCCESS, tixiStylesheetFree(otherHandle));
+  EXPECT_EQ(SUCCESS, tixiStylesheetFree(styleHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetFree(styleHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformToString(documentHandle, styleHandle, &fromHandle));
+}
+
+TEST_F(XsltChecks, stylesheetHandle_invalid)
+{
+  TixiStylesheetHandle styleHandle = -1;
+  char* string = NULL;
+
+  EXPECT_EQ(OPEN_FAILED, tixiStylesheetLoad("TestData/missing.xsl", &styleHandle));
+  EXPECT_EQ(FAILED, tixiStylesheetLoad(xmlFilename, &styleHandle));
+
+  ASSERT_EQ(SUCCESS, tixiStylesheetLoad(stylesheetFilename, &styleHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformToString(-1, styleHandle, &string));
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformToFile(documentHandle, styleHandle + 1000, resultFileName));
+  EXPECT_EQ(FAILED, tixiStylesheetTransformToFile(documentHandle, styleHandle, NULL));
+  EXPECT_EQ(SUCCESS, tixiStylesheetFree(styleHandle));
+}
+
+TEST_F(XsltChecks, xslTransformationToDocument)
+{
+  TixiDocumentHandle resultHandle = -1;
+  char* fromDocument = NULL;
+  char* fromString = NULL;
+  char* text = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiXSLTransformationToDocument(documentHandle, stylesheetFilename, &resultHandle));
+  ASSERT_EQ(SUCCESS, tixiCheckElement(resultHandle, "/toolInput/data/var1"));
+
+  // the result must be the same as transforming into a string and importing it
+  TixiDocumentHandle importHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiXSLTransformationToString(documentHandle, stylesheetFilename, &fromString));
+  ASSERT_EQ(SUCCESS, tixiImportFromString(fromString, &importHandle));
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(importHandle, "/toolInput/data/var1", &fromString));
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(resultHandle, "/toolInput/data/var1", &text));
+  EXPECT_STREQ(fromString, text);
+
+  // the new document is independent of the source document
+  ASSERT_EQ(SUCCESS, tixiCloseDocument(documentHandle));
+  documentHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiAddTextElement(resultHandle, "/toolInput", "comment", "modified"));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(resultHandle, &fromDocument));
+  EXPECT_TRUE(strstr(fromDocument, "<comment>modified</comment>") != NULL);
+
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(importHandle));
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(resultHandle));
+}
+
+TEST_F(XsltChecks, xslTransformationToDocument_params)
+{
+  TixiDocumentHandle resultHandle = -1;
+  char* text = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiXSLTransformationToDocument(documentHandle, "TestData/mappingWithParams.xsl", &resultHandle));
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(resultHandle, "/toolInput/tool", &text));
+  EXPECT_STREQ("defaultTool", text);
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(resultHandle));
+
+  // values are strings, quotes must not be interpreted
+  const char* names[] = {"toolName", "version", "unused"};
+  const char* values[] = {"my 'tool'", "2.5", "x"};
+  ASSERT_EQ(SUCCESS, tixiXSLTransformationToDocumentWithParams(documentHandle, "TestData/mappingWithParams.xsl",
+                                                               names, values, 3, &resultHandle));
+  ASSERT_EQ(SUCCESS, tixiGetTextElement(resultHandle, "/toolInput/tool", &text));
+  EXPECT_STREQ("my 'tool'", text);
+  ASSERT_EQ(SUCCESS, tixiGetTextAttribute(resultHandle, "/toolInput/tool", "version", &text));
+  EXPECT_STREQ("2.5", text);
+  EXPECT_EQ(SUCCESS, tixiCloseDocument(resultHandle));
+
+  const char* nullValues[] = {"tool", NULL};
+  EXPECT_EQ(FAILED, tixiXSLTransformationToDocumentWithParams(documentHandle, "TestData/mappingWithParams.xsl",
+                                                              names, nullValues, 2, &resultHandle));
+}
+
+TEST_F(XsltChecks, xslTransformationToDocument_invalid)
+{
+  TixiDocumentHandle resultHandle = -1;
+
+  EXPECT_EQ(INVALID_HANDLE, tixiXSLTransformationToDocument(-1, stylesheetFilename, &resultHandle));
+  EXPECT_EQ(OPEN_FAILED, tixiXSLTransformationToDocument(documentHandle, "TestData/missing.xsl", &resultHandle));
+  EXPECT_EQ(FAILED, tixiXSLTransformationToDocument(documentHandle, xmlFilename, &resultHandle));
+  EXPECT_EQ(FAILED, tixiXSLTransformationToDocument(documentHandle, "TestData/mappingToText.xsl", &resultHandle));
+}
+
+TEST(XsltBatch, transformDocuments)
+{
+  const int nDocuments = 12;
+  TixiDocumentHandle handles[nDocuments + 2];
+  TixiDocumentHandle resultHandles[nDocuments + 2];
+  TixiStylesheetHandle styleHandle = -1;
+  char* expected = NULL;
+  char* text = NULL;
+
+  ASSERT_EQ(SUCCESS, tixiStylesheetLoad("TestData/mappingWithParams.xsl", &styleHandle));
+  for (int i = 0; i < nDocuments; ++i) {
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(xmlFilename, &handles[i]));
+    ASSERT_EQ(SUCCESS, tixiRegisterNamespace(handles[i], "http://www.w3.org/1999/xhtml", "c"));
+    ASSERT_EQ(SUCCESS, tixiUpdateDoubleElement(handles[i], "/c:cpacs/c:aircraft/c:configurations/c:configuration/c:reference/c:area", i, "%g"));
+  }
+  // documents occuring multiple times
+  handles[nDocuments] = handles[3];
+  handles[nDocuments + 1] = handles[3];
+
+  ASSERT_EQ(SUCCESS, tixiStylesheetTransformDocuments(styleHandle, handles, nDocuments + 2, 4, resultHandles));
+  for (int i = 0; i < nDocuments + 2; ++i) {
+    ASSERT_NE(-1, resultHandles[i]);
+    ASSERT_EQ(SUCCESS, tixiGetTextElement(resultHandles[i], "/toolInput/data/var1", &text));
+    EXPECT_STREQ(std::to_string(i < nDocuments ? i : 3).c_str(), text);
+  }
+
+  // same result as the sequential transformation
+  TixiDocumentHandle sequentialHandle = -1;
+  ASSERT_EQ(SUCCESS, tixiStylesheetTransformToString(handles[5], styleHandle, &expected));
+  ASSERT_EQ(SUCCESS, tixiImportFromString(expected, &sequentialHandle));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(sequentialHandle, &expected));
+  ASSERT_EQ(SUCCESS, tixiExportDocumentAsString(resultHandles[5], &text));
+  EXPECT_STREQ(expected, text);
+  tixiCloseDocument(sequentialHandle);
+
+  for (int i = 0; i < nDocuments + 2; ++i) {
+    EXPECT_EQ(SUCCESS, tixiCloseDocument(resultHandles[i]));
+  }
+
+  // invalid handles
+  handles[nDocuments] = -1;
+  for (int i = 0; i < nDocuments + 1; ++i) {
+    resultHandles[i] = 4711;
+  }
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformDocuments(styleHandle, handles, nDocuments + 1, 4, resultHandles));
+  for (int i = 0; i < nDocuments + 1; ++i) {
+    EXPECT_EQ(-1, resultHandles[i]);
+  }
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformDocuments(styleHandle + 1000, handles, nDocuments, 4, resultHandles));
+
+  for (int i = 0; i < nDocuments; ++i) {
+    tixiCloseDocument(handles[i]);
+  }
+  EXPECT_EQ(SUCCESS, tixiStylesheetFree(styleHandle));
+}
+
+TEST(XsltBatch, transformFiles)
+{
+  const int nFiles = 8;
+  std::vector<std::string> outputs;
+  const char* inputFilenames[nFiles];
+  const char* outputFilenames[nFiles];
+  TixiStylesheetHandle styleHandle = -1;
+
+  for (int i = 0; i < nFiles; ++i) {
+    outputs.push_back("TestData/batchResult" + std::to_string(i) + ".xml");
+  }
+  for (int i = 0; i < nFiles; ++i) {
+    inputFilenames[i] = xmlFilename;
+    outputFilenames[i] = outputs[i].c_str();
+  }
+
+  ASSERT_EQ(SUCCESS, tixiStylesheetLoad(stylesheetFilename, &styleHandle));
+  ASSERT_EQ(SUCCESS, tixiStylesheetTransformFiles(styleHandle, inputFilenames, outputFilenames, nFiles, 0));
+
+  for (int i = 0; i < nFiles; ++i) {
+    TixiDocumentHandle handle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(outputFilenames[i], &handle));
+    EXPECT_EQ(SUCCESS, tixiCheckElement(handle, "/toolInput/data/var1"));
+    tixiCloseDocument(handle);
+  }
+
+  inputFilenames[2] = "TestData/missing.xml";
+  EXPECT_EQ(OPEN_FAILED, tixiStylesheetTransformFiles(styleHandle, inputFilenames, outputFilenames, nFiles, 3));
+  inputFilenames[2] = "TestData/illformed.xml";
+  EXPECT_EQ(NOT_WELL_FORMED, tixiStylesheetTransformFiles(styleHandle, inputFilenames, outputFilenames, nFiles, 3));
+  EXPECT_EQ(SUCCESS, tixiStylesheetTransformFiles(styleHandle, inputFilenames, outputFilenames, 0, 3));
+
+  EXPECT_EQ(SUCCESS, tixiStylesheetFree(styleHandle));
+  EXPECT_EQ(INVALID_HANDLE, tixiStylesheetTransformFiles(styleHandle, inputFilenames, outputFilenames, nFiles, 3));
+}